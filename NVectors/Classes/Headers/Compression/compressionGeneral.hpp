@@ -0,0 +1,156 @@
+/*
+    File that contains the lossless transformations and compression of raw
+    bytes: the byte shuffle of fixed width elements, the run length encoding,
+    the Huffman coding and the coding of the byte planes of shuffled bytes.
+*/
+#pragma once
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+
+//##############################################################################
+// Namespaces
+//##############################################################################
+
+
+namespace CompressionGeneral
+{
+    //##########################################################################
+    // Variables
+    //##########################################################################
+
+
+    // Maximum number of bytes of a literal token, i.e., of copied bytes.
+    constexpr size_t maximumLiteral{128};
+
+
+    // Minimum number of equal bytes that are encoded as a run.
+    constexpr size_t minimumRun{3};
+
+
+    // Maximum number of equal bytes of a run token.
+    constexpr size_t maximumRun{minimumRun + 127};
+
+
+    // Number of distinct bytes, i.e., of symbols of the Huffman codes.
+    constexpr size_t symbols{256};
+
+
+    // Maximum number of bits of a Huffman code, such that the codes are
+    // decoded with a single table lookup.
+    constexpr size_t maximumCodeLength{12};
+
+
+    //##########################################################################
+    // Enumerations
+    //##########################################################################
+
+
+    /**
+     * The way in which a byte plane of shuffled bytes is stored.
+    */
+    enum class Coding : uint8_t
+    {
+        // The bytes, as they are; when they do not compress.
+        Stored,
+
+        // The run length encoding of the bytes.
+        RunLength,
+
+        // The Huffman coding of the bytes.
+        Huffman
+    };
+
+
+    //##########################################################################
+    // Function Specification
+    //##########################################################################
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Non-Template
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    //--------------------------------------------------------------------------
+    // Shuffle Functions
+    //--------------------------------------------------------------------------
+
+
+    // Groups the bytes of the elements by their position in the element.
+    void shuffle(
+        const uint8_t* bytes, size_t count, size_t width, uint8_t* shuffled
+    ) noexcept;
+
+
+    // Restores the bytes of the elements grouped by shuffle.
+    void unshuffle(
+        const uint8_t* shuffled, size_t count, size_t width, uint8_t* bytes
+    ) noexcept;
+
+
+    //--------------------------------------------------------------------------
+    // Run Length Functions
+    //--------------------------------------------------------------------------
+
+
+    // Appends the run length encoding of the given bytes.
+    void runLengthEncode(
+        const uint8_t* bytes, size_t size, std::vector<uint8_t>& encoded
+    );
+
+
+    // Decodes the given run length encoded bytes.
+    bool runLengthDecode(
+        const uint8_t* encoded, size_t size, uint8_t* bytes, size_t expected
+    ) noexcept;
+
+
+    //--------------------------------------------------------------------------
+    // Huffman Functions
+    //--------------------------------------------------------------------------
+
+
+    // Appends the Huffman coding of the given bytes.
+    void huffmanEncode(
+        const uint8_t* bytes, size_t size, std::vector<uint8_t>& encoded
+    );
+
+
+    // Decodes the given Huffman coded bytes.
+    bool huffmanDecode(
+        const uint8_t* encoded, size_t size, uint8_t* bytes, size_t expected
+    ) noexcept;
+
+
+    //--------------------------------------------------------------------------
+    // Plane Functions
+    //--------------------------------------------------------------------------
+
+
+    // Appends the coding of each byte plane of the given shuffled bytes.
+    void planesEncode(
+        const uint8_t* shuffled, size_t count, size_t width,
+        std::vector<uint8_t>& encoded
+    );
+
+
+    // Decodes the byte planes coded by planesEncode.
+    bool planesDecode(
+        const uint8_t* encoded, size_t size, size_t count, size_t width,
+        uint8_t* shuffled
+    ) noexcept;
+}
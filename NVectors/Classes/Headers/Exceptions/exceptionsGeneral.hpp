@@ -11,8 +11,10 @@
 
 
 // General.
+#include <cstddef>
+#include <cstdio>
 #include <exception>
-#include <string>
+#include <mutex>
 
 
 //##############################################################################
@@ -22,6 +24,111 @@
 
 namespace ExceptionsGeneral
 {
+    //##########################################################################
+    // Variables.
+    //##########################################################################
+
+
+    // Number of characters of the buffers of the exception messages.
+    constexpr size_t messageSize{256};
+
+
+    //##########################################################################
+    // Message Classes.
+    //##########################################################################
+
+
+    /**
+     * Class that holds the message of an exception, formatted on the first
+     * request and only once, even if several threads request it at the same
+     * time. The copies start unformatted, since the flag can not be copied.
+    */
+    class Message
+    {
+        //######################################################################
+        // Public Interface.
+        //######################################################################
+
+
+        public:
+        //----------------------------------------------------------------------
+        // Constructors.
+        //----------------------------------------------------------------------
+
+
+        /**
+         * Constructs a new, unformatted, message.
+        */
+        Message() noexcept
+        {}
+
+
+        /**
+         * Constructs a new, unformatted, message; the formatter of the copied
+         * exception formats it again on request.
+        */
+        Message(const Message&) noexcept
+        {}
+
+
+        /**
+         * The flag can not be reset, so the messages are not assignable.
+        */
+        Message& operator = (const Message&) = delete;
+
+
+        //----------------------------------------------------------------------
+        // Functions.
+        //----------------------------------------------------------------------
+
+
+        /**
+         * Returns the message, formatted by the given function on the first
+         * request.
+         * 
+         * @param formatter The function, with signature
+         * formatter(char* buffer, size_t size), that writes the message into
+         * the buffer of the given size.
+         * 
+         * @return The formatted message.
+        */
+        template <typename F>
+        const char* format(F formatter) const noexcept
+        {
+            try
+            {
+                std::call_once(formatted, formatter, buffer, sizeof(buffer));
+            }
+            catch(...)
+            {
+                return "The exception message could not be created.";
+            }
+
+            return buffer;
+        }
+
+
+        //######################################################################
+        // Private Interface.
+        //######################################################################
+
+
+        private:
+        //----------------------------------------------------------------------
+        // Variables.
+        //----------------------------------------------------------------------
+
+
+        // Flag that is set once the message has been formatted.
+        mutable std::once_flag formatted{};
+
+
+        // Buffer that contains the message, such that formatting it does not
+        // allocate.
+        mutable char buffer[messageSize]{};
+    };
+
+
     //##########################################################################
     // Exception Classes.
     //##########################################################################
@@ -51,23 +158,28 @@ namespace ExceptionsGeneral
          * 
          * @param requested The requested number of dimensions.
         */
-        Dimensions(size_t expected, size_t requested)
-        {
-            // Create the message.
-            message = "The requested number of dimensions doesn't match the "
-            "expected number of dimensions.\n" 
-            "\n\tExpected: " + std::to_string(expected) + "" 
-            "\n\tRequested: " + std::to_string(requested) + "\n";
-        }
+        Dimensions(size_t expected, size_t requested) :
+        expectedDimensions{expected},
+        requestedDimensions{requested}
+        {}
 
 
         /**
-         * Throws the exception.
+         * Throws the exception. The message is only created when requested,
+         * such that throwing the exception is cheap.
         */
         virtual const char * what() const throw()
         {   
-            // Set the custom message.
-            return message.c_str();
+            // Create the message, once.
+            return message.format([this](char* buffer, size_t size)
+            {
+                std::snprintf(
+                    buffer, size, "The requested number of dimensions "
+                    "doesn't match the expected number of dimensions.\n\n\t"
+                    "Expected: %zu\n\tRequested: %zu\n", expectedDimensions,
+                    requestedDimensions
+                );
+            });
         }
 
 
@@ -82,8 +194,16 @@ namespace ExceptionsGeneral
         //----------------------------------------------------------------------
 
 
-        // String that contains the exception message.
-        std::string message{};
+        // The exception message, created on request.
+        Message message{};
+
+
+        // The expected number of dimensions.
+        size_t expectedDimensions{0};
+
+
+        // The requested number of dimensions.
+        size_t requestedDimensions{0};
     };
 
 
@@ -107,11 +227,7 @@ namespace ExceptionsGeneral
          * Constructor for the exception, customizes the exception message.
         */
         DivisionByZero()
-        {
-            // Create the message.
-            message = "A division by zero has been attempted, this is not "
-            "possible.";
-        }
+        {}
 
 
         /**
@@ -119,24 +235,10 @@ namespace ExceptionsGeneral
         */
         virtual const char * what() const throw()
         {   
-            // Set the custom message.
-            return message.c_str();
+            // The message is constant.
+            return "A division by zero has been attempted, this is not "
+            "possible.";
         }
-
-
-        //######################################################################
-        // Private Interface.
-        //######################################################################
-
-
-        private:
-        //----------------------------------------------------------------------
-        // Variables.
-        //----------------------------------------------------------------------
-
-
-        // String that contains the exception message.
-        std::string message{};
     };
 
 
@@ -165,23 +267,29 @@ namespace ExceptionsGeneral
          * 
          * @param requested The requested number.
         */
-        IndexOutOfRange(size_t expectedl, size_t expectedh, size_t requested)
-        {
-            // Create the message.
-            message = "The requested number is out of bounds, i.e., it is not "
-            "in the given range.\n\tRange, including both ends: [" +
-            std::to_string(expectedl) + ", " + std::to_string(expectedh) + ""
-            "]\n\tRequested: " + std::to_string(requested) + "\n";
-        }
+        IndexOutOfRange(size_t expectedl, size_t expectedh, size_t requested) :
+        lowerBound{expectedl},
+        higherBound{expectedh},
+        requestedIndex{requested}
+        {}
 
 
         /**
-         * Throws the exception.
+         * Throws the exception. The message is only created when requested,
+         * such that throwing the exception is cheap.
         */
         virtual const char * what() const throw()
         {   
-            // Set the custom message.
-            return message.c_str();
+            // Create the message, once.
+            return message.format([this](char* buffer, size_t size)
+            {
+                std::snprintf(
+                    buffer, size, "The requested number is out of bounds, "
+                    "i.e., it is not in the given range.\n\tRange, including "
+                    "both ends: [%zu, %zu]\n\tRequested: %zu\n", lowerBound,
+                    higherBound, requestedIndex
+                );
+            });
         }
 
 
@@ -196,7 +304,19 @@ namespace ExceptionsGeneral
         //----------------------------------------------------------------------
 
 
-        // String that contains the exception message.
-        std::string message{};
+        // The exception message, created on request.
+        Message message{};
+
+
+        // The expected lower bound.
+        size_t lowerBound{0};
+
+
+        // The expected higher bound.
+        size_t higherBound{0};
+
+
+        // The requested number.
+        size_t requestedIndex{0};
     };
-}
\ No newline at end of file
+}
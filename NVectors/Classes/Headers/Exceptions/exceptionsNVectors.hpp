@@ -10,8 +10,12 @@
 
 
 // General.
+#include <cstdio>
 #include <exception>
-#include <string>
+
+
+// User defined.
+#include "./exceptionsGeneral.hpp"
 
 
 //##############################################################################
@@ -49,22 +53,95 @@ namespace ExceptionsNVector
          * 
          * @param requested The requested index value.
         */
-        Index(size_t expected, size_t requested)
-        {
-            // Create the message.
-            message = "The requested index fall out of range.\nRange: [0," + 
-            std::to_string(expected) + "]\nRequested: " +
-            std::to_string(requested);
+        Index(size_t expected, size_t requested) :
+        maximumIndex{expected},
+        requestedIndex{requested}
+        {}
+
+
+        /**
+         * Throws the exception. The message is only created when requested,
+         * such that throwing the exception is cheap.
+        */
+        virtual const char * what() const throw()
+        {   
+            // Create the message, once.
+            return message.format([this](char* buffer, size_t size)
+            {
+                std::snprintf(
+                    buffer, size, "The requested index fall out of range.\n"
+                    "Range: [0,%zu]\nRequested: %zu", maximumIndex,
+                    requestedIndex
+                );
+            });
         }
 
 
+        //######################################################################
+        // Private Interface.
+        //######################################################################
+
+
+        private:
+        //----------------------------------------------------------------------
+        // Variables.
+        //----------------------------------------------------------------------
+
+
+        // The exception message, created on request.
+        ExceptionsGeneral::Message message{};
+
+
+        // The maximum expected index value.
+        size_t maximumIndex{0};
+
+
+        // The requested index value.
+        size_t requestedIndex{0};
+    };
+
+    /**
+     * Class that builds the exceptions when an index appears more than once
+     * in a permutation.
+    */
+    class Permutation : virtual public std::exception
+    {
+        //######################################################################
+        // Public Interface.
+        //######################################################################
+
+
+        public:
+        //----------------------------------------------------------------------
+        // Constructor.
+        //----------------------------------------------------------------------
+
+
         /**
-         * Throws the exception.
+         * Constructor for the exception, customizes the exception message.
+         * 
+         * @param repeated The index that appears more than once.
+        */
+        Permutation(size_t repeated) :
+        repeatedIndex{repeated}
+        {}
+
+
+        /**
+         * Throws the exception. The message is only created when requested,
+         * such that throwing the exception is cheap.
         */
         virtual const char * what() const throw()
         {   
-            // Set the custom message.
-            return message.c_str();
+            // Create the message, once.
+            return message.format([this](char* buffer, size_t size)
+            {
+                std::snprintf(
+                    buffer, size, "The given indexes are not a permutation, "
+                    "an index appears more than once.\nRepeated: %zu",
+                    repeatedIndex
+                );
+            });
         }
 
 
@@ -79,7 +156,152 @@ namespace ExceptionsNVector
         //----------------------------------------------------------------------
 
 
-        // String that contains the exception message.
-        std::string message{};
+        // The exception message, created on request.
+        ExceptionsGeneral::Message message{};
+
+
+        // The index that appears more than once.
+        size_t repeatedIndex{0};
+    };
+
+    /**
+     * Class that builds the exceptions when a snapshot can not be decoded,
+     * because it is truncated, malformed or of another type.
+    */
+    class Snapshot : virtual public std::exception
+    {
+        //######################################################################
+        // Public Interface.
+        //######################################################################
+
+
+        public:
+        //----------------------------------------------------------------------
+        // Constructor.
+        //----------------------------------------------------------------------
+
+
+        /**
+         * Constructor for the exception, customizes the exception message.
+         * 
+         * @param problem The description of the problem of the snapshot, a
+         * string literal that is used as the format of the number, if any.
+         * 
+         * @param number The number that the description refers to, if any.
+        */
+        Snapshot(const char* problem, size_t number = 0) :
+        problemFormat{problem},
+        problemNumber{number}
+        {}
+
+
+        /**
+         * Throws the exception. The message is only created when requested,
+         * such that throwing the exception is cheap.
+        */
+        virtual const char * what() const throw()
+        {   
+            // Create the message, once.
+            return message.format([this](char* buffer, size_t size)
+            {
+                int prefix = std::snprintf(
+                    buffer, size, "The snapshot can not be decoded.\n"
+                    "Problem: "
+                );
+
+                if(prefix > 0 && (size_t) prefix < size)
+                    std::snprintf(
+                        buffer + prefix, size - prefix, problemFormat,
+                        problemNumber
+                    );
+            });
+        }
+
+
+        //######################################################################
+        // Private Interface.
+        //######################################################################
+
+
+        private:
+        //----------------------------------------------------------------------
+        // Variables.
+        //----------------------------------------------------------------------
+
+
+        // The exception message, created on request.
+        ExceptionsGeneral::Message message{};
+
+
+        // The description of the problem, used as the format of the number.
+        const char* problemFormat{nullptr};
+
+
+        // The number that the description refers to.
+        size_t problemNumber{0};
+    };
+
+    /**
+     * Class that builds the exceptions when the checksum of a block of a
+     * snapshot does not match its decoded bytes.
+    */
+    class Checksum : virtual public std::exception
+    {
+        //######################################################################
+        // Public Interface.
+        //######################################################################
+
+
+        public:
+        //----------------------------------------------------------------------
+        // Constructor.
+        //----------------------------------------------------------------------
+
+
+        /**
+         * Constructor for the exception, customizes the exception message.
+         * 
+         * @param corrupted The index of the block whose checksum fails.
+        */
+        Checksum(size_t corrupted) :
+        corruptedBlock{corrupted}
+        {}
+
+
+        /**
+         * Throws the exception. The message is only created when requested,
+         * such that throwing the exception is cheap.
+        */
+        virtual const char * what() const throw()
+        {   
+            // Create the message, once.
+            return message.format([this](char* buffer, size_t size)
+            {
+                std::snprintf(
+                    buffer, size, "The checksum of a block of the snapshot "
+                    "does not match, the data is corrupted.\nBlock: %zu",
+                    corruptedBlock
+                );
+            });
+        }
+
+
+        //######################################################################
+        // Private Interface.
+        //######################################################################
+
+
+        private:
+        //----------------------------------------------------------------------
+        // Variables.
+        //----------------------------------------------------------------------
+
+
+        // The exception message, created on request.
+        ExceptionsGeneral::Message message{};
+
+
+        // The index of the block whose checksum fails.
+        size_t corruptedBlock{0};
     };
 }
\ No newline at end of file
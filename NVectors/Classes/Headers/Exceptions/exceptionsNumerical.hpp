@@ -11,8 +11,13 @@
 
 
 // General.
+#include <cstdio>
 #include <exception>
-#include <string>
+#include <type_traits>
+
+
+// User defined.
+#include "./exceptionsGeneral.hpp"
 
 
 //##############################################################################
@@ -47,11 +52,7 @@ namespace ExceptionsNumerical
          * Constructor for the exception, customizes the exception message.
         */
         DivisionByZero()
-        {
-            // Create the message.
-            message = "A division by zero has been attempted, this is not "
-            "possible.";
-        }
+        {}
 
 
         /**
@@ -59,24 +60,10 @@ namespace ExceptionsNumerical
         */
         virtual const char * what() const throw()
         {   
-            // Set the custom message.
-            return message.c_str();
+            // The message is constant.
+            return "A division by zero has been attempted, this is not "
+            "possible.";
         }
-
-
-        //######################################################################
-        // Private Interface.
-        //######################################################################
-
-
-        private:
-        //----------------------------------------------------------------------
-        // Variables.
-        //----------------------------------------------------------------------
-
-
-        // String that contains the exception message.
-        std::string message{};
     };
 
 
@@ -106,23 +93,48 @@ namespace ExceptionsNumerical
          * @param variable The variable that is being validated and must be 
          * greater than the value.
         */
-        GreaterThan(T value, T variable)
-        {
-            // Create the message.
-            message = "The given variable value, " +
-            std::to_string(variable) + ", is not greater than the required "
-            "value, " + std::to_string(value) + "; i.e., the variable must be " 
-            "greater than the required value.";
-        }
+        GreaterThan(T value, T variable) :
+        requiredValue{value},
+        variableValue{variable}
+        {}
 
 
         /**
-         * Throws the exception.
+         * Throws the exception. The message is only created when requested,
+         * such that throwing the exception is cheap.
         */
         virtual const char * what() const throw()
         {   
-            // Set the custom message.
-            return message.c_str();
+            // Create the message, once.
+            return message.format([this](char* buffer, size_t size)
+            {
+                // The integers are written exactly.
+                if constexpr(
+                    std::is_integral<T>::value && std::is_signed<T>::value
+                )
+                    std::snprintf(
+                        buffer, size, "The given variable value, %lld, is not "
+                        "greater than the required value, %lld; i.e., the "
+                        "variable must be greater than the required value.",
+                        (long long) variableValue, (long long) requiredValue
+                    );
+                else if constexpr(std::is_integral<T>::value)
+                    std::snprintf(
+                        buffer, size, "The given variable value, %llu, is not "
+                        "greater than the required value, %llu; i.e., the "
+                        "variable must be greater than the required value.",
+                        (unsigned long long) variableValue,
+                        (unsigned long long) requiredValue
+                    );
+                else
+                    std::snprintf(
+                        buffer, size, "The given variable value, %Lg, is not "
+                        "greater than the required value, %Lg; i.e., the "
+                        "variable must be greater than the required value.",
+                        (long double) variableValue,
+                        (long double) requiredValue
+                    );
+            });
         }
 
 
@@ -137,8 +149,16 @@ namespace ExceptionsNumerical
         //----------------------------------------------------------------------
 
 
-        // String that contains the exception message.
-        std::string message{};
+        // The exception message, created on request.
+        ExceptionsGeneral::Message message{};
+
+
+        // The lower bound to which the variable is being compared.
+        T requiredValue{};
+
+
+        // The variable that must be greater than the value.
+        T variableValue{};
     };
 
 
@@ -162,10 +182,7 @@ namespace ExceptionsNumerical
          * Constructor for the exception, customizes the exception message.
         */
         Numerical()
-        {
-            // Create the message.
-            message = "The requested variable is not of numerical type.";
-        }
+        {}
 
 
         /**
@@ -173,22 +190,44 @@ namespace ExceptionsNumerical
         */
         virtual const char * what() const throw()
         {   
-            // Set the custom message.
-            return message.c_str();
+            // The message is constant.
+            return "The requested variable is not of numerical type.";
         }
+    };
 
 
+    /**
+     * Class that builds the exceptions when an integer operation overflows
+     * the range of its type.
+    */
+    class Overflow : virtual public std::exception
+    {
         //######################################################################
-        // Private Interface.
+        // Public Interface.
         //######################################################################
 
-        private:
+
+        public:
         //----------------------------------------------------------------------
-        // Variables.
+        // Constructor.
         //----------------------------------------------------------------------
 
 
-        // String that contains the exception message.
-        std::string message{};
+        /**
+         * Constructor for the exception, customizes the exception message.
+        */
+        Overflow()
+        {}
+
+
+        /**
+         * Throws the exception.
+        */
+        virtual const char * what() const throw()
+        {   
+            // The message is constant.
+            return "The result of the operation does not fit in the range of "
+            "its type.";
+        }
     };
 }
\ No newline at end of file
@@ -0,0 +1,173 @@
+/*
+    File that contains the error codes and results of the functions that
+    report their errors without throwing exceptions.
+*/
+#pragma once
+
+
+//##############################################################################
+// Imports.
+//##############################################################################
+
+
+// General.
+#include <utility>
+
+
+//##############################################################################
+// Namespaces.
+//##############################################################################
+
+
+namespace ExceptionsResults
+{
+    //##########################################################################
+    // Enumerations.
+    //##########################################################################
+
+
+    /**
+     * The errors that can be reported without throwing; each one corresponds
+     * to one of the general exceptions.
+    */
+    enum class Error
+    {
+        // No error happened.
+        None,
+
+        // The number of dimensions doesn't match the expected one.
+        Dimensions,
+
+        // A division by zero was attempted.
+        DivisionByZero,
+
+        // An index is out of range.
+        IndexOutOfRange,
+
+        // An integer result does not fit in the range of its type.
+        Overflow
+    };
+
+
+    //##########################################################################
+    // Classes.
+    //##########################################################################
+
+
+    /**
+     * Class that holds either the value returned by a function or the error
+     * that prevented the function from returning a value.
+    */
+    template <typename T>
+    class Result
+    {
+        //######################################################################
+        // Public Interface.
+        //######################################################################
+
+
+        public:
+        //----------------------------------------------------------------------
+        // Constructors.
+        //----------------------------------------------------------------------
+
+
+        /**
+         * Constructs a successful result.
+         * 
+         * @param value The value returned by the function.
+        */
+        Result(T value) noexcept :
+        result{std::move(value)}
+        {}
+
+
+        /**
+         * Constructs a failed result.
+         * 
+         * @param code The error that prevented the function from returning a
+         * value; it must not be Error::None.
+        */
+        Result(Error code) noexcept :
+        error{code}
+        {}
+
+
+        //----------------------------------------------------------------------
+        // Operator Overloads.
+        //----------------------------------------------------------------------
+
+
+        /**
+         * Conversion operator. To check if the result holds a value.
+         * 
+         * @return True, if the result holds a value; False, otherwise.
+        */
+        explicit operator bool() const noexcept
+        {
+            return error == Error::None;
+        }
+
+
+        //----------------------------------------------------------------------
+        // Functions.
+        //----------------------------------------------------------------------
+
+
+        /**
+         * Returns the error of the result.
+         * 
+         * @return The error of the result; Error::None, if it holds a value.
+        */
+        Error code() const noexcept
+        {
+            return error;
+        }
+
+
+        /**
+         * Returns the value of the result; only meaningful if the result
+         * holds a value.
+         * 
+         * @return A reference to the value of the result.
+        */
+        T& value() noexcept
+        {
+            return result;
+        }
+
+
+        /**
+         * Returns the value of the result, or the given fallback if the result
+         * holds an error.
+         * 
+         * @param fallback The value to be returned if the result holds an
+         * error.
+         * 
+         * @return The value of the result or the fallback.
+        */
+        T valueOr(T fallback) const noexcept
+        {
+            return error == Error::None ? result : fallback;
+        }
+
+
+        //######################################################################
+        // Private Interface.
+        //######################################################################
+
+
+        private:
+        //----------------------------------------------------------------------
+        // Variables.
+        //----------------------------------------------------------------------
+
+
+        // The value returned by the function.
+        T result{};
+
+
+        // The error that prevented the function from returning a value.
+        Error error{Error::None};
+    };
+}
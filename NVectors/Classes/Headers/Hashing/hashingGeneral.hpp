@@ -0,0 +1,218 @@
+/*
+    File that contains the functions to hash the raw storage of the vectors
+    and to compute the checksums of raw bytes.
+*/
+#pragma once
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+
+//##############################################################################
+// Namespaces
+//##############################################################################
+
+
+namespace HashingGeneral
+{
+    //##########################################################################
+    // Classes
+    //##########################################################################
+
+
+    /**
+     * Class that hashes a stream of 64 bit words, with four independent lanes
+     * that are merged and mixed at the end; the rounds and the final mixing
+     * follow the 64 bit xxHash design.
+    */
+    class Hasher
+    {
+        //######################################################################
+        // Public Interface.
+        //######################################################################
+
+
+        public:
+        //----------------------------------------------------------------------
+        // Constructor.
+        //----------------------------------------------------------------------
+
+
+        /**
+         * Constructs a new hasher.
+         * 
+         * @param seed The seed of the hash.
+        */
+        Hasher(uint64_t seed)
+        {
+            lanes[0] = seed + prime1 + prime2;
+            lanes[1] = seed + prime2;
+            lanes[2] = seed;
+            lanes[3] = seed - prime1;
+        }
+
+
+        //----------------------------------------------------------------------
+        // Functions.
+        //----------------------------------------------------------------------
+
+
+        /**
+         * Adds the given word to the hash.
+         * 
+         * @param word The word to be added.
+        */
+        void add(uint64_t word)
+        {
+            lanes[count & 3] = round(lanes[count & 3], word);
+            ++count;
+        }
+
+
+        /**
+         * Adds the bits of the given value to the hash, where positive and
+         * negative zeros are considered the same value; only the significant
+         * bytes of the extended precision type are used, since the rest are
+         * padding.
+         * 
+         * @param value The value to be added.
+        */
+        template <typename T>
+        void addValue(T value)
+        {
+            // Auxiliary variables.
+            constexpr size_t size =
+                std::numeric_limits<T>::digits == 64 && sizeof(T) > 10 ?
+                10 : sizeof(T);
+            unsigned char bytes[size];
+
+            // Both zeros compare equal, they must hash equal.
+            if(value == (T) 0) value = (T) 0;
+            std::memcpy(bytes, &value, size);
+
+            // Add the bytes, one word at a time.
+            for(size_t i = 0; i < size; i += sizeof(uint64_t))
+            {
+                uint64_t word{0};
+                size_t length = size - i < sizeof(uint64_t) ?
+                    size - i : sizeof(uint64_t);
+
+                std::memcpy(&word, bytes + i, length);
+                add(word);
+            }
+        }
+
+
+        /**
+         * Returns the hash of all the words that have been added.
+         * 
+         * @return The hash of all the words that have been added.
+        */
+        uint64_t digest() const
+        {
+            // Merge the lanes.
+            uint64_t hash = rotate(lanes[0], 1) + rotate(lanes[1], 7) +
+                rotate(lanes[2], 12) + rotate(lanes[3], 18);
+
+            hash += count * sizeof(uint64_t);
+
+            // Mix the bits.
+            hash ^= hash >> 33;
+            hash *= prime2;
+            hash ^= hash >> 29;
+            hash *= prime3;
+            hash ^= hash >> 32;
+
+            return hash;
+        }
+
+
+        //######################################################################
+        // Private Interface.
+        //######################################################################
+
+
+        private:
+        //----------------------------------------------------------------------
+        // Functions.
+        //----------------------------------------------------------------------
+
+
+        /**
+         * Rotates the bits of the given word to the left.
+         * 
+         * @param word The word to be rotated.
+         * 
+         * @param bits The number of bits to rotate; between 1 and 63.
+         * 
+         * @return The rotated word.
+        */
+        static uint64_t rotate(uint64_t word, int bits)
+        {
+            return (word << bits) | (word >> (64 - bits));
+        }
+
+
+        /**
+         * Mixes the given word into the given lane.
+         * 
+         * @param lane The lane where the word is mixed.
+         * 
+         * @param word The word to be mixed.
+         * 
+         * @return The new value of the lane.
+        */
+        static uint64_t round(uint64_t lane, uint64_t word)
+        {
+            return rotate(lane + word * prime2, 31) * prime1;
+        }
+
+
+        //----------------------------------------------------------------------
+        // Variables.
+        //----------------------------------------------------------------------
+
+
+        // Primes of the rounds and the final mixing.
+        static constexpr uint64_t prime1{0x9E3779B185EBCA87ull};
+        static constexpr uint64_t prime2{0xC2B2AE3D27D4EB4Full};
+        static constexpr uint64_t prime3{0x165667B19E3779F9ull};
+
+
+        // The state of each of the lanes.
+        uint64_t lanes[4];
+
+
+        // The number of words that have been added.
+        uint64_t count{0};
+    };
+
+
+    //##########################################################################
+    // Function Specification
+    //##########################################################################
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Non-Template
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    //--------------------------------------------------------------------------
+    // Checksum Functions
+    //--------------------------------------------------------------------------
+
+
+    // Updates the CRC-32 checksum with the given bytes.
+    uint32_t crc32(const uint8_t* bytes, size_t size, uint32_t crc) noexcept;
+}
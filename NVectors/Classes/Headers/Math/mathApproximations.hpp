@@ -0,0 +1,283 @@
+/*
+    File that contains the branch free approximations of the elementary
+    functions, such that the loops that use them can be vectorized.
+*/
+#pragma once
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+
+//##############################################################################
+// Namespaces
+//##############################################################################
+
+
+namespace MathApproximations
+{
+    //##########################################################################
+    // Function Specification
+    //##########################################################################
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Template
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    //--------------------------------------------------------------------------
+    // Arithmetic Functions
+    //--------------------------------------------------------------------------
+
+
+    // Gets the product of the first two numbers plus the third number.
+    template <typename T>
+    T multiplyAdd(T a, T b, T c) noexcept;
+
+
+    //--------------------------------------------------------------------------
+    // Exponential Functions
+    //--------------------------------------------------------------------------
+
+
+    // Gets the exponential of the given number.
+    template <typename T>
+    T exp(T x) noexcept;
+
+
+    // Gets the natural logarithm of the given number.
+    template <typename T>
+    T log(T x) noexcept;
+
+
+    //##########################################################################
+    // Auxiliary Types
+    //##########################################################################
+
+
+    /**
+     * Structure with the layout of the binary representation of the single
+     * and double precision numbers.
+     * 
+     * @param T The floating point type.
+    */
+    template <typename T>
+    struct Bits
+    {
+        // Integer type with the size of the floating point type.
+        typedef std::conditional_t<sizeof(T) == 4, int32_t, int64_t> Integer;
+
+
+        // Number of explicit bits of the significand.
+        static constexpr int significand{std::numeric_limits<T>::digits - 1};
+
+
+        // Bias of the exponent.
+        static constexpr int bias{std::numeric_limits<T>::max_exponent - 1};
+    };
+
+
+    //##########################################################################
+    // Functions
+    //##########################################################################
+
+
+    //--------------------------------------------------------------------------
+    // Arithmetic Functions
+    //--------------------------------------------------------------------------
+
+
+    /**
+     * Gets the product of the first two numbers plus the third number. The
+     * operation is fused, i.e., rounded once, when the hardware has a fast
+     * fused multiply-add for the type; otherwise, the product is rounded
+     * before the addition, since the software emulation is much slower.
+     * 
+     * @param a The first factor.
+     * 
+     * @param b The second factor.
+     * 
+     * @param c The number to be added.
+     * 
+     * @return The product of the factors plus the given number.
+    */
+    template <typename T>
+    T multiplyAdd(T a, T b, T c) noexcept
+    {
+        #ifdef FP_FAST_FMA
+        if constexpr(std::is_same<T, double>::value) return std::fma(a, b, c);
+        #endif
+
+        #ifdef FP_FAST_FMAF
+        if constexpr(std::is_same<T, float>::value) return std::fma(a, b, c);
+        #endif
+
+        return a * b + c;
+    }
+
+
+    //--------------------------------------------------------------------------
+    // Exponential Functions
+    //--------------------------------------------------------------------------
+
+
+    /**
+     * Gets the exponential of the given number. The argument is reduced to
+     * x = n * ln(2) + r, with |r| <= ln(2) / 2, the exponential of r is
+     * evaluated with its Taylor polynomial, and 2^n is built from its bits.
+     * For single and double precision, the error is below 1.5 units in the
+     * last place for the results in the normal range; the results that would
+     * be subnormal are flushed to zero. The rest of the types use std::exp.
+     * 
+     * @param x The number whose exponential is to be determined.
+     * 
+     * @return The exponential of the given number.
+    */
+    template <typename T>
+    T exp(T x) noexcept
+    {
+        if constexpr(
+            !std::is_same<T, float>::value && !std::is_same<T, double>::value
+        )
+            return (T) std::exp((long double) x);
+        else
+        {
+            // Auxiliary variables.
+            typedef typename Bits<T>::Integer I;
+            constexpr bool single = std::is_same<T, float>::value;
+            constexpr int terms = single ? 7 : 13;
+            constexpr T log2e = (T) 1.44269504088896340736;
+            constexpr T ln2hi = single ? (T) 0.693145751953125 :
+                (T) 0.693147180369123816490;
+            constexpr T ln2lo = single ? (T) 1.428606765330187045e-06 :
+                (T) 1.90821492927058770002e-10;
+            constexpr T upper = single ? (T) 88.7228 : (T) 709.782712893384;
+            constexpr T lower = single ? (T) -87.3365 : (T) -708.396418532264;
+            constexpr T coefficients[14] = {
+                (T) 1.0, (T) 1.0, (T) (1.0 / 2), (T) (1.0 / 6), (T) (1.0 / 24),
+                (T) (1.0 / 120), (T) (1.0 / 720), (T) (1.0 / 5040),
+                (T) (1.0 / 40320), (T) (1.0 / 362880), (T) (1.0 / 3628800),
+                (T) (1.0 / 39916800), (T) (1.0 / 479001600),
+                (T) (1.0 / 6227020800.0)
+            };
+
+            // Adding and subtracting 1.5 * 2^significand rounds to integer.
+            constexpr T shifter =
+                (T) 1.5 * (T) ((I) 1 << Bits<T>::significand);
+
+            // Reduce the argument, within the normal range.
+            T y = std::min(std::max(x, lower), upper);
+            T n = (y * log2e + shifter) - shifter;
+            T r = (y - n * ln2hi) - n * ln2lo;
+
+            // Evaluate the polynomial.
+            T p = coefficients[terms];
+            for(int k = terms - 1; k >= 0; --k) p = p * r + coefficients[k];
+
+            // Scale by 2^n, in two halves, such that 2^n does not overflow.
+            I half = (I) n / 2;
+            I exponent1 = (half + Bits<T>::bias) << Bits<T>::significand;
+            I exponent2 =
+                ((I) n - half + Bits<T>::bias) << Bits<T>::significand;
+            T scale1, scale2;
+            std::memcpy(&scale1, &exponent1, sizeof(T));
+            std::memcpy(&scale2, &exponent2, sizeof(T));
+            T result = p * scale1 * scale2;
+
+            // Saturate the arguments out of range and propagate not a number.
+            result = x > upper ? std::numeric_limits<T>::infinity() : result;
+            result = x < lower ? (T) 0 : result;
+
+            return x != x ? x : result;
+        }
+    }
+
+
+    /**
+     * Gets the natural logarithm of the given number. The number is split as
+     * x = m * 2^e, with sqrt(1/2) <= m < sqrt(2), and the logarithm of m is
+     * evaluated with the series of 2 * atanh(s), s = (m - 1) / (m + 1). For
+     * single and double precision, the error is below 1 unit in the last
+     * place, for the subnormal numbers too; zero gives -infinity and the
+     * negative numbers give not a number. The rest of the types use std::log.
+     * 
+     * @param x The number whose natural logarithm is to be determined.
+     * 
+     * @return The natural logarithm of the given number.
+    */
+    template <typename T>
+    T log(T x) noexcept
+    {
+        if constexpr(
+            !std::is_same<T, float>::value && !std::is_same<T, double>::value
+        )
+            return (T) std::log((long double) x);
+        else
+        {
+            // Auxiliary variables.
+            typedef typename Bits<T>::Integer I;
+            constexpr bool single = std::is_same<T, float>::value;
+            constexpr int terms = single ? 4 : 9;
+            constexpr int significand = Bits<T>::significand;
+            constexpr I mantissa = ((I) 1 << significand) - 1;
+            constexpr T ln2hi = single ? (T) 0.693145751953125 :
+                (T) 0.693147180369123816490;
+            constexpr T ln2lo = single ? (T) 1.428606765330187045e-06 :
+                (T) 1.90821492927058770002e-10;
+            constexpr T sqrt2 = (T) 1.41421356237309504880;
+            constexpr T normal = std::numeric_limits<T>::min();
+            constexpr T subnormal = (T) ((I) 1 << (significand + 2));
+            constexpr T coefficients[10] = {
+                (T) (2.0 / 3), (T) (2.0 / 5), (T) (2.0 / 7), (T) (2.0 / 9),
+                (T) (2.0 / 11), (T) (2.0 / 13), (T) (2.0 / 15), (T) (2.0 / 17),
+                (T) (2.0 / 19), (T) (2.0 / 21)
+            };
+
+            // Make the subnormal numbers normal.
+            bool tiny = x < normal;
+            T y = tiny ? x * subnormal : x;
+            I bits;
+            std::memcpy(&bits, &y, sizeof(T));
+
+            // Split the number into its exponent and its significand.
+            I e = (bits >> significand) - Bits<T>::bias;
+            bits = (bits & mantissa) | ((I) Bits<T>::bias << significand);
+            T m;
+            std::memcpy(&m, &bits, sizeof(T));
+
+            // Center the significand around one.
+            bool high = m > sqrt2;
+            m = high ? m * (T) 0.5 : m;
+            T exponent = (T) (e + (high ? 1 : 0));
+            exponent -= tiny ? (T) (significand + 2) : (T) 0;
+
+            // Evaluate the series, as log(1 + f) = f - f^2 / 2 + s * (f^2 / 2
+            // + R), such that the small corrections are added to f last.
+            T f = m - (T) 1;
+            T s = f / ((T) 2 + f);
+            T z = s * s;
+            T q = coefficients[terms - 1];
+            for(int k = terms - 2; k >= 0; --k) q = q * z + coefficients[k];
+            T h = (T) 0.5 * f * f;
+            T result = exponent * ln2hi -
+                ((h - (s * (h + z * q) + exponent * ln2lo)) - f);
+
+            // Handle the special values.
+            result = x == std::numeric_limits<T>::infinity() ? x : result;
+            result = x == (T) 0 ? -std::numeric_limits<T>::infinity() : result;
+            result = x < (T) 0 ? std::numeric_limits<T>::quiet_NaN() : result;
+
+            return x != x ? x : result;
+        }
+    }
+}
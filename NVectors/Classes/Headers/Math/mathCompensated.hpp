@@ -0,0 +1,315 @@
+/*
+    File that contains the compensated reductions, i.e., the sums and dot
+    products whose rounding errors are computed exactly and added back, such
+    that the results are as accurate as if computed with twice the working
+    precision.
+*/
+#pragma once
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+
+//##############################################################################
+// Namespaces
+//##############################################################################
+
+
+namespace MathCompensated
+{
+    //##########################################################################
+    // Variables
+    //##########################################################################
+
+
+    // Number of independent compensated sums used by the reductions, such
+    // that the compiler can vectorize them without reordering the additions.
+    constexpr size_t lanes{8};
+
+
+    //##########################################################################
+    // Function Specification
+    //##########################################################################
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Template
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    //--------------------------------------------------------------------------
+    // Error Free Functions
+    //--------------------------------------------------------------------------
+
+
+    // Gets the rounded product of the numbers and its exact rounding error.
+    template <typename T>
+    void twoProduct(T a, T b, T& product, T& error) noexcept;
+
+
+    // Gets the rounded sum of the numbers and its exact rounding error.
+    template <typename T>
+    void twoSum(T a, T b, T& sum, T& error) noexcept;
+
+
+    //--------------------------------------------------------------------------
+    // Reduction Functions
+    //--------------------------------------------------------------------------
+
+
+    // Gets the compensated dot product of the given entries.
+    template <typename T, typename A>
+    A dot2(const T* entries_1, const T* entries_2, size_t size) noexcept;
+
+
+    // Gets the compensated sum of the given entries.
+    template <typename T, typename A>
+    A sum2(const T* entries, size_t size) noexcept;
+
+
+    //##########################################################################
+    // Functions
+    //##########################################################################
+
+
+    //--------------------------------------------------------------------------
+    // Auxiliary Functions
+    //--------------------------------------------------------------------------
+
+
+    /**
+     * Adds the compensated sums of the lanes, with their accumulated errors.
+     * 
+     * @param sum The rounded sums of the lanes.
+     * 
+     * @param error The accumulated rounding errors of the lanes.
+     * 
+     * @return The compensated sum of the lanes.
+    */
+    template <typename A>
+    A sumLanes(const A (&sum)[lanes], const A (&error)[lanes]) noexcept
+    {
+        // Auxiliary variables.
+        A total = (A) 0;
+        A correction = (A) 0;
+
+        for(size_t l = 0; l < lanes; ++l)
+        {
+            A rounding;
+            twoSum(total, sum[l], total, rounding);
+            correction += rounding + error[l];
+        }
+
+        return total + correction;
+    }
+
+
+    /**
+     * Splits the number in two halves with the splitting of Dekker, i.e.,
+     * x = high + low, where each half has at most half of the digits, such
+     * that their products are exact. The numbers for which splitter * x
+     * overflows are split scaled down by a power of two, which is exact.
+     * 
+     * @param x The number to be split.
+     * 
+     * @param high Where the half with the most significant digits is stored.
+     * 
+     * @param low Where the half with the least significant digits is stored.
+    */
+    template <typename T>
+    void split(T x, T& high, T& low) noexcept
+    {
+        // Auxiliary variables.
+        constexpr int half = (std::numeric_limits<T>::digits + 1) / 2;
+        constexpr T splitter = (T) ((1ULL << half) + 1);
+        constexpr T limit = std::numeric_limits<T>::max() / splitter;
+        constexpr T scale = (T) (1ULL << (half + 1));
+
+        if(std::fabs(x) > limit)
+        {
+            T y = x / scale;
+            high = (splitter * y - (splitter * y - y)) * scale;
+        }
+        else
+            high = splitter * x - (splitter * x - x);
+
+        low = x - high;
+    }
+
+
+    //--------------------------------------------------------------------------
+    // Error Free Functions
+    //--------------------------------------------------------------------------
+
+
+    /**
+     * Gets the rounded product of the numbers and its exact rounding error,
+     * i.e., a * b = product + error. The error is computed with a fused
+     * multiply-add when the hardware has a fast one for the type, i.e., when
+     * the build targets it, see CXXFLAGS in build.sh; otherwise, with the
+     * splitting of Dekker, which only uses multiplications and additions and
+     * is exact unless the product overflows or underflows, see split.
+     * 
+     * @param a The first factor.
+     * 
+     * @param b The second factor.
+     * 
+     * @param product Where the rounded product is stored.
+     * 
+     * @param error Where the rounding error of the product is stored.
+    */
+    template <typename T>
+    void twoProduct(T a, T b, T& product, T& error) noexcept
+    {
+        product = a * b;
+
+        #ifdef FP_FAST_FMA
+        if constexpr(std::is_same<T, double>::value)
+        {
+            error = std::fma(a, b, -product);
+            return;
+        }
+        #endif
+
+        #ifdef FP_FAST_FMAF
+        if constexpr(std::is_same<T, float>::value)
+        {
+            error = std::fma(a, b, -product);
+            return;
+        }
+        #endif
+
+        // Auxiliary variables.
+        T a_1, a_2, b_1, b_2;
+
+        split(a, a_1, a_2);
+        split(b, b_1, b_2);
+
+        error = a_2 * b_2 - (((product - a_1 * b_1) - a_2 * b_1) - a_1 * b_2);
+    }
+
+
+    /**
+     * Gets the rounded sum of the numbers and its exact rounding error,
+     * i.e., a + b = sum + error, with the branch free algorithm of Knuth.
+     * 
+     * @param a The first number.
+     * 
+     * @param b The second number.
+     * 
+     * @param sum Where the rounded sum is stored.
+     * 
+     * @param error Where the rounding error of the sum is stored.
+    */
+    template <typename T>
+    void twoSum(T a, T b, T& sum, T& error) noexcept
+    {
+        // Auxiliary variables.
+        T s = a + b;
+        T b_virtual = s - a;
+
+        error = (a - (s - b_virtual)) + (b - b_virtual);
+        sum = s;
+    }
+
+
+    //--------------------------------------------------------------------------
+    // Reduction Functions
+    //--------------------------------------------------------------------------
+
+
+    /**
+     * Gets the dot product of the given entries with the Dot2 algorithm of
+     * Ogita, Rump and Oishi, i.e., as accurate as if computed with twice the
+     * working precision and then rounded. The products and sums are split
+     * into several lanes, each one with its own compensation, such that the
+     * loop is vectorized; the results do not depend on the hardware. The
+     * compensation is lost if the compiler is allowed to reassociate, e.g.,
+     * with -ffast-math.
+     * 
+     * @param entries_1 The first entries.
+     * 
+     * @param entries_2 The second entries.
+     * 
+     * @param size The number of entries.
+     * 
+     * @return The compensated dot product, computed with the accumulation
+     * type.
+    */
+    template <typename T, typename A>
+    A dot2(const T* entries_1, const T* entries_2, size_t size) noexcept
+    {
+        // Auxiliary variables.
+        A sum[lanes] = {};
+        A error[lanes] = {};
+        size_t blocks = size - size % lanes;
+
+        auto step = [](A& s, A& e, A x, A y)
+        {
+            A product, product_error, rounding;
+
+            twoProduct(x, y, product, product_error);
+            twoSum(s, product, s, rounding);
+            e += product_error + rounding;
+        };
+
+        for(size_t i = 0; i < blocks; i += lanes)
+            for(size_t l = 0; l < lanes; ++l)
+                step(
+                    sum[l], error[l], (A) entries_1[i + l],
+                    (A) entries_2[i + l]
+                );
+
+        for(size_t i = blocks; i < size; ++i)
+            step(sum[0], error[0], (A) entries_1[i], (A) entries_2[i]);
+
+        return sumLanes(sum, error);
+    }
+
+
+    /**
+     * Gets the sum of the given entries with the Sum2 algorithm of Ogita,
+     * Rump and Oishi, i.e., as accurate as if computed with twice the working
+     * precision and then rounded; split into lanes like dot2.
+     * 
+     * @param entries The entries to be added.
+     * 
+     * @param size The number of entries.
+     * 
+     * @return The compensated sum, computed with the accumulation type.
+    */
+    template <typename T, typename A>
+    A sum2(const T* entries, size_t size) noexcept
+    {
+        // Auxiliary variables.
+        A sum[lanes] = {};
+        A error[lanes] = {};
+        size_t blocks = size - size % lanes;
+
+        auto step = [](A& s, A& e, A x)
+        {
+            A rounding;
+
+            twoSum(s, x, s, rounding);
+            e += rounding;
+        };
+
+        for(size_t i = 0; i < blocks; i += lanes)
+            for(size_t l = 0; l < lanes; ++l)
+                step(sum[l], error[l], (A) entries[i + l]);
+
+        for(size_t i = blocks; i < size; ++i)
+            step(sum[0], error[0], (A) entries[i]);
+
+        return sumLanes(sum, error);
+    }
+}
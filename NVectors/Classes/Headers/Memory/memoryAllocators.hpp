@@ -0,0 +1,112 @@
+/*
+    File that contains the allocators used by the containers of the vectors.
+*/
+#pragma once
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <memory>
+#include <new>
+#include <utility>
+
+
+//##############################################################################
+// Namespaces
+//##############################################################################
+
+
+namespace MemoryAllocators
+{
+    //##########################################################################
+    // Classes
+    //##########################################################################
+
+
+    /**
+     * Allocator that default initializes the elements constructed without
+     * arguments, instead of value initializing them; i.e., resizing a
+     * container of numbers leaves the new numbers uninitialized, instead of
+     * setting them to zero, when they are going to be overwritten anyway.
+    */
+    template <typename T>
+    class DefaultInit : public std::allocator<T>
+    {
+        //######################################################################
+        // Public Interface.
+        //######################################################################
+
+
+        public:
+        //----------------------------------------------------------------------
+        // Types.
+        //----------------------------------------------------------------------
+
+
+        /**
+         * The same allocator for a different type.
+        */
+        template <typename U>
+        struct rebind
+        {
+            typedef DefaultInit<U> other;
+        };
+
+
+        //----------------------------------------------------------------------
+        // Constructors.
+        //----------------------------------------------------------------------
+
+
+        /**
+         * Constructs a new allocator.
+        */
+        DefaultInit() = default;
+
+
+        /**
+         * Constructs a new allocator from an allocator of a different type.
+         * 
+         * @param allocator The allocator to be copied.
+        */
+        template <typename U>
+        DefaultInit(const DefaultInit<U>& allocator) noexcept :
+        std::allocator<T>(allocator)
+        {}
+
+
+        //----------------------------------------------------------------------
+        // Functions.
+        //----------------------------------------------------------------------
+
+
+        /**
+         * Constructs an element without arguments, default initializing it.
+         * 
+         * @param pointer The location of the element.
+        */
+        template <typename U>
+        void construct(U* pointer)
+        {
+            ::new((void*) pointer) U;
+        }
+
+
+        /**
+         * Constructs an element with the given arguments.
+         * 
+         * @param pointer The location of the element.
+         * 
+         * @param args The arguments of the constructor of the element.
+        */
+        template <typename U, typename... Args>
+        void construct(U* pointer, Args&&... args)
+        {
+            ::new((void*) pointer) U(std::forward<Args>(args)...);
+        }
+    };
+}
@@ -0,0 +1,230 @@
+/*
+    File that contains the functions to split work among several threads.
+*/
+#pragma once
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+
+//##############################################################################
+// Namespaces
+//##############################################################################
+
+
+namespace ParallelGeneral
+{
+    //##########################################################################
+    // Function Specification
+    //##########################################################################
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Template
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    //--------------------------------------------------------------------------
+    // Execution Functions
+    //--------------------------------------------------------------------------
+
+
+    // Runs the given function over the given range, split among threads.
+    template <typename F>
+    void parallelFor(size_t begin, size_t end, size_t grain, F function);
+
+
+    //--------------------------------------------------------------------------
+    // Sorting Functions
+    //--------------------------------------------------------------------------
+
+
+    // Sorts the given range, split among threads.
+    template <typename I, typename C>
+    void parallelSort(I first, I last, size_t grain, C compare);
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Non-Template
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    //--------------------------------------------------------------------------
+    // Query Functions
+    //--------------------------------------------------------------------------
+
+
+    // Gets the number of threads to be used for the given amount of work.
+    size_t threads(size_t work, size_t grain);
+
+
+    //##########################################################################
+    // Functions
+    //##########################################################################
+
+
+    //--------------------------------------------------------------------------
+    // Execution Functions
+    //--------------------------------------------------------------------------
+
+
+    /**
+     * Runs the given function over the given range, where the range is split
+     * in contiguous chunks and each chunk is processed by a different thread.
+     * The calling thread processes the last chunk. The chunks are never
+     * empty, i.e., the function is always called with first < last.
+     * 
+     * @param begin The first index of the range.
+     * 
+     * @param end The index after the last index of the range.
+     * 
+     * @param grain The minimum number of indexes that a chunk must have, such
+     * that small ranges are processed by the calling thread only.
+     * 
+     * @param function The function to be run, with signature
+     * function(size_t first, size_t last), that processes the indexes in the
+     * range [first, last).
+     * 
+     * @throw The first exception thrown by any of the chunks, after all the
+     * threads have finished.
+    */
+    template <typename F>
+    void parallelFor(size_t begin, size_t end, size_t grain, F function)
+    {
+        // Auxiliary variables.
+        size_t work = end > begin ? end - begin : 0;
+        size_t nthreads = threads(work, grain);
+
+        // Run serially if there is not enough work.
+        if(nthreads < 2)
+        {
+            if(work > 0) function(begin, end);
+            return;
+        }
+
+        // Auxiliary variables; the rounding up of the chunk can leave fewer
+        // chunks than threads, recounted such that none of them is empty.
+        size_t chunk = (work + nthreads - 1) / nthreads;
+        nthreads = (work + chunk - 1) / chunk;
+        std::vector<std::exception_ptr> errors(nthreads);
+        std::vector<std::thread> workers;
+        workers.reserve(nthreads - 1);
+
+        // Launch the workers; if a thread cannot be started, the ones that
+        // were must be joined before the error leaves, since destroying a
+        // joinable thread terminates the program.
+        try
+        {
+            for(size_t i = 0; i + 1 < nthreads; ++i)
+            {
+                size_t first = begin + i * chunk;
+                size_t last = std::min(end, first + chunk);
+
+                workers.emplace_back([&function, &errors, i, first, last]()
+                {
+                    try { function(first, last); }
+                    catch(...) { errors[i] = std::current_exception(); }
+                });
+            }
+        }
+        catch(...)
+        {
+            for(std::thread& worker : workers) worker.join();
+            throw;
+        }
+
+        // The calling thread processes the last chunk.
+        try { function(begin + (nthreads - 1) * chunk, end); }
+        catch(...) { errors[nthreads - 1] = std::current_exception(); }
+
+        // Wait for the workers.
+        for(std::thread& worker : workers) worker.join();
+
+        // Propagate the errors.
+        for(std::exception_ptr& error : errors)
+            if(error) std::rethrow_exception(error);
+    }
+
+
+    //--------------------------------------------------------------------------
+    // Sorting Functions
+    //--------------------------------------------------------------------------
+
+
+    /**
+     * Sorts the given range with a merge sort, where the range is split in
+     * contiguous chunks that are sorted by different threads, and then the
+     * sorted chunks are merged pairwise, with the merges of each level also
+     * split among threads.
+     * 
+     * @param first The random access iterator to the first element.
+     * 
+     * @param last The random access iterator after the last element.
+     * 
+     * @param grain The minimum number of elements that a chunk must have, such
+     * that small ranges are sorted by the calling thread only.
+     * 
+     * @param compare The strict weak ordering of the elements, with signature
+     * compare(a, b), that determines if a goes before b.
+     * 
+     * @throw The first exception thrown by any of the comparisons, after all
+     * the threads have finished.
+    */
+    template <typename I, typename C>
+    void parallelSort(I first, I last, size_t grain, C compare)
+    {
+        // Auxiliary variables.
+        size_t work = (size_t) std::distance(first, last);
+        size_t nthreads = threads(work, grain);
+
+        // Sort serially if there is not enough work.
+        if(nthreads < 2)
+        {
+            std::sort(first, last, compare);
+            return;
+        }
+
+        // Auxiliary variables.
+        size_t chunk = (work + nthreads - 1) / nthreads;
+
+        // Sort each of the chunks.
+        parallelFor(0, nthreads, 1, [&](size_t begin, size_t end)
+        {
+            for(size_t i = begin; i < end; ++i)
+                std::sort(
+                    first + std::min(work, i * chunk),
+                    first + std::min(work, (i + 1) * chunk), compare
+                );
+        });
+
+        // Merge the sorted runs, doubling their width at each level.
+        for(size_t width = chunk; width < work; width *= 2)
+        {
+            size_t merges = (work + 2 * width - 1) / (2 * width);
+
+            parallelFor(0, merges, 1, [&](size_t begin, size_t end)
+            {
+                for(size_t i = begin; i < end; ++i)
+                {
+                    size_t low = i * 2 * width;
+                    size_t middle = std::min(work, low + width);
+                    size_t high = std::min(work, low + 2 * width);
+
+                    std::inplace_merge(
+                        first + low, first + middle, first + high, compare
+                    );
+                }
+            });
+        }
+    }
+}
@@ -0,0 +1,271 @@
+/*
+    File that contains the counter based random number generator and the
+    conversions of its words to floating point numbers and to bounded
+    integers.
+*/
+#pragma once
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <array>
+#include <cstdint>
+
+
+//##############################################################################
+// Namespaces
+//##############################################################################
+
+
+namespace RandomGeneral
+{
+    //##########################################################################
+    // Classes
+    //##########################################################################
+
+
+    /**
+     * Class with the Philox4x32-10 generator of Salmon et al., i.e., a keyed
+     * bijection of 128 bit counters; the n-th block of random words is the
+     * bijection of n, such that any block can be generated without the
+     * previous ones and the results do not depend on the order.
+    */
+    class Philox
+    {
+        //######################################################################
+        // Public Interface.
+        //######################################################################
+
+
+        public:
+        //----------------------------------------------------------------------
+        // Constructor.
+        //----------------------------------------------------------------------
+
+
+        /**
+         * Constructs a new generator.
+         * 
+         * @param seed The key of the generator.
+        */
+        Philox(uint64_t seed) :
+        key{(uint32_t) seed, (uint32_t) (seed >> 32)}
+        {}
+
+
+        //----------------------------------------------------------------------
+        // Functions.
+        //----------------------------------------------------------------------
+
+
+        /**
+         * Returns the block of four random words of the given counter.
+         * 
+         * @param counter The 128 bit counter, from the least significant
+         * word to the most significant one.
+         * 
+         * @return The block of four random words.
+        */
+        std::array<uint32_t, 4> operator () (
+            std::array<uint32_t, 4> counter
+        ) const noexcept
+        {
+            // Auxiliary variables.
+            uint32_t k0 = key[0], k1 = key[1];
+
+            for(int round = 0; round < rounds; ++round)
+            {
+                uint64_t product0 = (uint64_t) multiplier0 * counter[0];
+                uint64_t product1 = (uint64_t) multiplier1 * counter[2];
+
+                counter = {
+                    (uint32_t) (product1 >> 32) ^ counter[1] ^ k0,
+                    (uint32_t) product1,
+                    (uint32_t) (product0 >> 32) ^ counter[3] ^ k1,
+                    (uint32_t) product0
+                };
+
+                k0 += weyl0;
+                k1 += weyl1;
+            }
+
+            return counter;
+        }
+
+
+        /**
+         * Returns the block of four random words with the given index.
+         * 
+         * @param index The index of the block.
+         * 
+         * @return The block of four random words.
+        */
+        std::array<uint32_t, 4> block(uint64_t index) const noexcept
+        {
+            return (*this)({(uint32_t) index, (uint32_t) (index >> 32), 0, 0});
+        }
+
+
+        //######################################################################
+        // Private Interface.
+        //######################################################################
+
+
+        private:
+        //----------------------------------------------------------------------
+        // Variables.
+        //----------------------------------------------------------------------
+
+
+        // Multipliers of the rounds.
+        static constexpr uint32_t multiplier0{0xD2511F53};
+        static constexpr uint32_t multiplier1{0xCD9E8D57};
+
+
+        // Increments of the key between rounds.
+        static constexpr uint32_t weyl0{0x9E3779B9};
+        static constexpr uint32_t weyl1{0xBB67AE85};
+
+
+        // Number of rounds.
+        static constexpr int rounds{10};
+
+
+        // Key of the generator.
+        uint32_t key[2];
+    };
+
+
+    //##########################################################################
+    // Function Specification
+    //##########################################################################
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Template
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    //--------------------------------------------------------------------------
+    // Conversion Functions
+    //--------------------------------------------------------------------------
+
+
+    // Converts a random word into a number in [0, 1), with 24 bits.
+    template <typename T>
+    T unit(uint32_t word) noexcept;
+
+
+    // Converts two random words into a number in [0, 1), with 53 bits.
+    template <typename T>
+    T unit(uint32_t high, uint32_t low) noexcept;
+
+
+    // Gets the unbiased integer in [lower, upper) with the given index.
+    template <typename T>
+    T bounded(const Philox& generator, uint64_t index, T lower, T upper)
+    noexcept;
+
+
+    //##########################################################################
+    // Functions
+    //##########################################################################
+
+
+    //--------------------------------------------------------------------------
+    // Conversion Functions
+    //--------------------------------------------------------------------------
+
+
+    /**
+     * Returns the integer in [lower, upper) with the given index, without
+     * bias, with the multiplication and rejection of Lemire: a 64 bit word
+     * times the size of the range gives the integer in its high half, and
+     * the words whose low half falls in the biased remainder are rejected.
+     * The candidates of each index come from their own counters, with the
+     * index and the attempt, such that the integer only depends on the seed
+     * and on the index; the blocks of the unit numbers have a zero attempt.
+     * 
+     * @param generator The counter based generator.
+     * 
+     * @param index The index of the integer.
+     * 
+     * @param lower The lower end of the range.
+     * 
+     * @param upper The upper end of the range, greater than the lower one.
+     * 
+     * @return The integer in [lower, upper).
+    */
+    template <typename T>
+    T bounded(const Philox& generator, uint64_t index, T lower, T upper)
+    noexcept
+    {
+        // Auxiliary variables.
+        uint64_t range = (uint64_t) upper - (uint64_t) lower;
+        uint64_t threshold = (0 - range) % range;
+        uint64_t high = 0, low = 0;
+
+        for(uint32_t attempt = 1; attempt == 1 || low < threshold; ++attempt)
+        {
+            std::array<uint32_t, 4> words = generator({
+                (uint32_t) index, (uint32_t) (index >> 32), attempt, 0
+            });
+
+            for(size_t w = 0; w < 4; w += 2)
+            {
+                // The 128 bit product of the word and the range, by halves.
+                uint64_t a0 = words[w + 1], a1 = words[w];
+                uint64_t b0 = (uint32_t) range, b1 = range >> 32;
+                uint64_t cross = (a0 * b0 >> 32) + (uint32_t) (a1 * b0) +
+                    (uint32_t) (a0 * b1);
+
+                high = a1 * b1 + (a1 * b0 >> 32) + (a0 * b1 >> 32) +
+                    (cross >> 32);
+                low = ((a1 << 32) | a0) * range;
+
+                if(low >= threshold) break;
+            }
+        }
+
+        return (T) ((uint64_t) lower + high);
+    }
+
+
+    /**
+     * Converts a random word into a number in [0, 1), using its 24 most
+     * significant bits, such that it is exact in single precision.
+     * 
+     * @param word The random word.
+     * 
+     * @return The number in [0, 1).
+    */
+    template <typename T>
+    T unit(uint32_t word) noexcept
+    {
+        return (T) (word >> 8) * (T) (1.0 / 16777216.0);
+    }
+
+
+    /**
+     * Converts two random words into a number in [0, 1), using their 53 most
+     * significant bits, such that it is exact in double precision.
+     * 
+     * @param high The most significant random word.
+     * 
+     * @param low The least significant random word.
+     * 
+     * @return The number in [0, 1).
+    */
+    template <typename T>
+    T unit(uint32_t high, uint32_t low) noexcept
+    {
+        // Auxiliary variables.
+        uint64_t bits = ((uint64_t) high << 32 | low) >> 11;
+
+        return (T) bits * (T) (1.0 / 9007199254740992.0);
+    }
+}
@@ -0,0 +1,179 @@
+/*
+    File that contains the reduced precision floating point types, that are
+    meant to be used for storage only.
+*/
+#pragma once
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cstdint>
+#include <cstring>
+
+
+//##############################################################################
+// Namespaces
+//##############################################################################
+
+
+namespace TypesFloating
+{
+    //##########################################################################
+    // Types
+    //##########################################################################
+
+
+// Half precision type, only if the compiler supports it.
+#ifdef __FLT16_MAX__
+    typedef _Float16 Float16;
+#endif
+
+
+    //##########################################################################
+    // Classes
+    //##########################################################################
+
+
+    /**
+     * Class that stores a brain floating point number, i.e., the upper 16 bits
+     * of a single precision number. All the arithmetic is done in single
+     * precision, and the results are rounded to the nearest even value when
+     * stored.
+    */
+    class BFloat16
+    {
+        //######################################################################
+        // Public Interface.
+        //######################################################################
+
+
+        public:
+        //----------------------------------------------------------------------
+        // Constructors.
+        //----------------------------------------------------------------------
+
+
+        /**
+         * Constructs a number with a value of zero.
+        */
+        BFloat16() = default;
+
+
+        /**
+         * Constructs a number from the given single precision value, rounded
+         * to the nearest even value.
+         * 
+         * @param value The value to be stored.
+        */
+        BFloat16(float value)
+        {
+            // Auxiliary variables.
+            uint32_t word;
+            std::memcpy(&word, &value, sizeof(word));
+
+            // Keep NaNs quiet, instead of rounding them to infinity.
+            if((word & 0x7FFFFFFFu) > 0x7F800000u)
+            {
+                bits = (uint16_t) ((word >> 16) | 0x0040u);
+                return;
+            }
+
+            // Round to the nearest even value.
+            word += 0x7FFFu + ((word >> 16) & 1u);
+            bits = (uint16_t) (word >> 16);
+        }
+
+
+        //----------------------------------------------------------------------
+        // Operator Overloads.
+        //----------------------------------------------------------------------
+
+
+        /**
+         * Conversion operator. To do all the arithmetic in single precision.
+         * 
+         * @return The single precision value of the number.
+        */
+        operator float() const
+        {
+            // Auxiliary variables.
+            uint32_t word = ((uint32_t) bits) << 16;
+            float value;
+
+            std::memcpy(&value, &word, sizeof(value));
+
+            return value;
+        }
+
+
+        /**
+         * Addition assignment operator.
+         * 
+         * @param value The value to be added.
+         * 
+         * @return A reference to the number.
+        */
+        BFloat16& operator += (float value)
+        {
+            return *this = BFloat16((float) *this + value);
+        }
+
+
+        /**
+         * Division assignment operator.
+         * 
+         * @param value The value by which the number will be divided.
+         * 
+         * @return A reference to the number.
+        */
+        BFloat16& operator /= (float value)
+        {
+            return *this = BFloat16((float) *this / value);
+        }
+
+
+        /**
+         * Multiplication assignment operator.
+         * 
+         * @param value The value by which the number will be multiplied.
+         * 
+         * @return A reference to the number.
+        */
+        BFloat16& operator *= (float value)
+        {
+            return *this = BFloat16((float) *this * value);
+        }
+
+
+        /**
+         * Subtraction assignment operator.
+         * 
+         * @param value The value to be subtracted.
+         * 
+         * @return A reference to the number.
+        */
+        BFloat16& operator -= (float value)
+        {
+            return *this = BFloat16((float) *this - value);
+        }
+
+
+        //######################################################################
+        // Private Interface.
+        //######################################################################
+
+
+        private:
+        //----------------------------------------------------------------------
+        // Variables.
+        //----------------------------------------------------------------------
+
+
+        // The upper 16 bits of the single precision number.
+        uint16_t bits{0};
+    };
+}
@@ -0,0 +1,721 @@
+/*
+    File that contains the integer support of the vectors: the accumulation
+    types of the reductions, the saturating and checked arithmetic, and the
+    signed fixed point numbers in Q format.
+*/
+#pragma once
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+
+//##############################################################################
+// Namespaces
+//##############################################################################
+
+
+namespace TypesInteger
+{
+    //##########################################################################
+    // Types
+    //##########################################################################
+
+
+    /**
+     * Integer type with the given number of bytes and signedness; the 128 bit
+     * integers are only defined if the compiler supports them.
+    */
+    template <size_t S, bool Signed>
+    struct Sized;
+
+    template <> struct Sized<2, true> { typedef int16_t type; };
+    template <> struct Sized<4, true> { typedef int32_t type; };
+    template <> struct Sized<8, true> { typedef int64_t type; };
+    template <> struct Sized<2, false> { typedef uint16_t type; };
+    template <> struct Sized<4, false> { typedef uint32_t type; };
+    template <> struct Sized<8, false> { typedef uint64_t type; };
+
+// The 128 bit integers are an extension, only if the compiler supports it;
+// marked as such, such that -pedantic does not warn about them.
+#ifdef __SIZEOF_INT128__
+    template <> struct Sized<16, true>
+    {
+        __extension__ typedef __int128 type;
+    };
+    template <> struct Sized<16, false>
+    {
+        __extension__ typedef unsigned __int128 type;
+    };
+#endif
+
+
+    /**
+     * Integer type with twice the bits of the given integer type, where the
+     * product of two integers is exact.
+    */
+    template <typename I>
+    using Wider = typename Sized<2 * sizeof(I), std::is_signed<I>::value>::type;
+
+
+    //##########################################################################
+    // Function Specification
+    //##########################################################################
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Template
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    //--------------------------------------------------------------------------
+    // Conversion Functions
+    //--------------------------------------------------------------------------
+
+
+    // Converts the given integer to the given type, clamped to its range.
+    template <typename I, typename W>
+    constexpr I saturate(W value) noexcept;
+
+
+    //--------------------------------------------------------------------------
+    // Overflow Functions
+    //--------------------------------------------------------------------------
+
+
+    // Adds the integers, wrapping around, and reports the overflow.
+    template <typename I>
+    bool overflowAdd(I a, I b, I& result) noexcept;
+
+
+    // Multiplies the integers, wrapping around, and reports the overflow.
+    template <typename I>
+    bool overflowMultiply(I a, I b, I& result) noexcept;
+
+
+    // Subtracts the integers, wrapping around, and reports the overflow.
+    template <typename I>
+    bool overflowSubtract(I a, I b, I& result) noexcept;
+
+
+    //--------------------------------------------------------------------------
+    // Saturation Functions
+    //--------------------------------------------------------------------------
+
+
+    // Adds the integers, clamping the result to the range of the type.
+    template <typename I>
+    I saturateAdd(I a, I b) noexcept;
+
+
+    // Multiplies the integers, clamping the result to the range of the type.
+    template <typename I>
+    I saturateMultiply(I a, I b) noexcept;
+
+
+    // Subtracts the integers, clamping the result to the range of the type.
+    template <typename I>
+    I saturateSubtract(I a, I b) noexcept;
+
+
+    //##########################################################################
+    // Classes
+    //##########################################################################
+
+
+    /**
+     * Class of signed fixed point numbers in Q format, i.e., integers of
+     * type I that count units of 2^-F; e.g., Fixed<int16_t, 15> is Q15, in
+     * [-1, 1). The arithmetic is exact up to the rounding of the products and
+     * quotients, to the nearest unit, and saturates instead of overflowing.
+    */
+    template <typename I, int F>
+    class Fixed
+    {
+        static_assert(
+            std::is_integral<I>::value && std::is_signed<I>::value,
+            "The fixed point numbers must be stored in signed integers."
+        );
+        static_assert(
+            F >= 0 && F <= std::numeric_limits<I>::digits,
+            "The fraction bits cannot exceed the value bits of the type."
+        );
+
+
+        //######################################################################
+        // Public Interface.
+        //######################################################################
+
+
+        public:
+        //----------------------------------------------------------------------
+        // Constructors.
+        //----------------------------------------------------------------------
+
+
+        /**
+         * Constructs a number with a value of zero.
+        */
+        Fixed() = default;
+
+
+        /**
+         * Constructs a number from the given arithmetic value, rounded to the
+         * nearest unit and clamped to the range of the type.
+         * 
+         * @param value The value to be stored.
+        */
+        template <
+            typename U,
+            typename = std::enable_if_t<std::is_arithmetic<U>::value>
+        >
+        explicit Fixed(U value)
+        {
+            if constexpr(std::is_floating_point<U>::value)
+            {
+                // Auxiliary variables.
+                U scaled = std::round(std::ldexp(value, F));
+                U upper = (U) std::numeric_limits<I>::max();
+                U lower = (U) std::numeric_limits<I>::min();
+
+                // The upper limit can round up, it must be compared first.
+                bits = scaled >= upper ? std::numeric_limits<I>::max() :
+                    scaled <= lower ? std::numeric_limits<I>::min() :
+                    (I) scaled;
+            }
+            else
+                bits = saturate<I>((Wide) value * ((Wide) 1 << F));
+        }
+
+
+        /**
+         * Constructs a number from a number with the same fraction bits and
+         * another storage, clamped to the range of the type.
+         * 
+         * @param value The number to be converted.
+        */
+        template <typename J>
+        explicit Fixed(Fixed<J, F> value) :
+        bits{saturate<I>(value.raw())}
+        {}
+
+
+        //----------------------------------------------------------------------
+        // Operator Overloads.
+        //----------------------------------------------------------------------
+
+
+        /**
+         * Conversion operator. To get the value as a floating point number.
+         * 
+         * @return The value of the number.
+        */
+        template <
+            typename U,
+            typename = std::enable_if_t<std::is_floating_point<U>::value>
+        >
+        explicit operator U() const
+        {
+            return std::ldexp((U) bits, -F);
+        }
+
+
+        /**
+         * Negation operator; the lowest number saturates to the highest one.
+         * 
+         * @return The negated number.
+        */
+        Fixed<I, F> operator - () const
+        {
+            return fromRaw(saturateSubtract<I>(0, bits));
+        }
+
+
+        /**
+         * Addition operator, saturating.
+         * 
+         * @param a The first number.
+         * 
+         * @param b The second number.
+         * 
+         * @return The sum of the numbers.
+        */
+        friend Fixed<I, F> operator + (Fixed<I, F> a, Fixed<I, F> b)
+        {
+            return fromRaw(saturateAdd(a.bits, b.bits));
+        }
+
+
+        /**
+         * Subtraction operator, saturating.
+         * 
+         * @param a The first number.
+         * 
+         * @param b The number to be subtracted.
+         * 
+         * @return The difference of the numbers.
+        */
+        friend Fixed<I, F> operator - (Fixed<I, F> a, Fixed<I, F> b)
+        {
+            return fromRaw(saturateSubtract(a.bits, b.bits));
+        }
+
+
+        /**
+         * Multiplication operator; the exact product is rounded to the
+         * nearest unit, with ties up, and saturated.
+         * 
+         * @param a The first number.
+         * 
+         * @param b The second number.
+         * 
+         * @return The product of the numbers.
+        */
+        friend Fixed<I, F> operator * (Fixed<I, F> a, Fixed<I, F> b)
+        {
+            return fromProduct((Wide) a.bits * (Wide) b.bits);
+        }
+
+
+        /**
+         * Division operator; the quotient is truncated towards zero and
+         * saturated, and a division by zero saturates to the sign of the
+         * dividend.
+         * 
+         * @param a The dividend.
+         * 
+         * @param b The divisor.
+         * 
+         * @return The quotient of the numbers.
+        */
+        friend Fixed<I, F> operator / (Fixed<I, F> a, Fixed<I, F> b)
+        {
+            if(b.bits == 0)
+                return fromRaw(
+                    a.bits > 0 ? std::numeric_limits<I>::max() :
+                    a.bits < 0 ? std::numeric_limits<I>::min() : 0
+                );
+
+            return fromRaw(
+                saturate<I>((Wide) a.bits * ((Wide) 1 << F) / (Wide) b.bits)
+            );
+        }
+
+
+        /**
+         * Addition assignment operator.
+         * 
+         * @param value The value to be added.
+         * 
+         * @return A reference to the number.
+        */
+        Fixed<I, F>& operator += (Fixed<I, F> value)
+        {
+            return *this = *this + value;
+        }
+
+
+        /**
+         * Division assignment operator.
+         * 
+         * @param value The value by which the number will be divided.
+         * 
+         * @return A reference to the number.
+        */
+        Fixed<I, F>& operator /= (Fixed<I, F> value)
+        {
+            return *this = *this / value;
+        }
+
+
+        /**
+         * Multiplication assignment operator.
+         * 
+         * @param value The value by which the number will be multiplied.
+         * 
+         * @return A reference to the number.
+        */
+        Fixed<I, F>& operator *= (Fixed<I, F> value)
+        {
+            return *this = *this * value;
+        }
+
+
+        /**
+         * Subtraction assignment operator.
+         * 
+         * @param value The value to be subtracted.
+         * 
+         * @return A reference to the number.
+        */
+        Fixed<I, F>& operator -= (Fixed<I, F> value)
+        {
+            return *this = *this - value;
+        }
+
+
+        /**
+         * Comparison operators, by value.
+         * 
+         * @param a The first number.
+         * 
+         * @param b The second number.
+        */
+        friend bool operator == (Fixed<I, F> a, Fixed<I, F> b)
+        {
+            return a.bits == b.bits;
+        }
+
+        friend bool operator != (Fixed<I, F> a, Fixed<I, F> b)
+        {
+            return a.bits != b.bits;
+        }
+
+        friend bool operator < (Fixed<I, F> a, Fixed<I, F> b)
+        {
+            return a.bits < b.bits;
+        }
+
+        friend bool operator <= (Fixed<I, F> a, Fixed<I, F> b)
+        {
+            return a.bits <= b.bits;
+        }
+
+        friend bool operator > (Fixed<I, F> a, Fixed<I, F> b)
+        {
+            return a.bits > b.bits;
+        }
+
+        friend bool operator >= (Fixed<I, F> a, Fixed<I, F> b)
+        {
+            return a.bits >= b.bits;
+        }
+
+
+        //----------------------------------------------------------------------
+        // Functions.
+        //----------------------------------------------------------------------
+
+
+        /**
+         * Constructs a number from its stored integer.
+         * 
+         * @param raw The number of units of 2^-F.
+         * 
+         * @return The number.
+        */
+        static Fixed<I, F> fromRaw(I raw) noexcept
+        {
+            // Auxiliary variables.
+            Fixed<I, F> number;
+
+            number.bits = raw;
+
+            return number;
+        }
+
+
+        /**
+         * Constructs a number from the exact product, or sum of products, of
+         * stored integers, which has 2F fraction bits; it is rounded to the
+         * nearest unit, with ties up, and saturated.
+         * 
+         * @param product The product of stored integers.
+         * 
+         * @return The number.
+        */
+        static Fixed<I, F> fromProduct(Wider<I> product) noexcept
+        {
+            if constexpr(F > 0)
+                product = (product + ((Wider<I>) 1 << (F - 1))) >> F;
+
+            return fromRaw(saturate<I>(product));
+        }
+
+
+        /**
+         * Returns the stored integer.
+         * 
+         * @return The number of units of 2^-F.
+        */
+        I raw() const noexcept
+        {
+            return bits;
+        }
+
+
+        //######################################################################
+        // Private Interface.
+        //######################################################################
+
+
+        private:
+        //----------------------------------------------------------------------
+        // Types.
+        //----------------------------------------------------------------------
+
+
+        // Type where the products and the scaled dividends are exact.
+        typedef Wider<I> Wide;
+
+
+        //----------------------------------------------------------------------
+        // Variables.
+        //----------------------------------------------------------------------
+
+
+        // The number of units of 2^-F.
+        I bits{0};
+    };
+
+
+    //##########################################################################
+    // Types
+    //##########################################################################
+
+
+    /**
+     * Type with which the reductions of the entries of type T, i.e., the dot
+     * products and norms, are accumulated by default: 64 bit integers for
+     * the integers, 64 bit fixed point numbers for the fixed point numbers,
+     * and the type itself otherwise. The integer reductions are checked, a
+     * result outside of the range of the accumulation type throws
+     * ExceptionsNumerical::Overflow instead of wrapping around.
+    */
+    template <typename T, typename = void>
+    struct Accumulator
+    {
+        typedef T type;
+    };
+
+    template <typename T>
+    struct Accumulator<T, std::enable_if_t<std::is_integral<T>::value>>
+    {
+        typedef std::conditional_t<std::is_signed<T>::value, int64_t, uint64_t>
+            type;
+    };
+
+    template <typename I, int F>
+    struct Accumulator<Fixed<I, F>>
+    {
+        typedef Fixed<int64_t, F> type;
+    };
+
+
+    /**
+     * Determines if the given type is a fixed point number.
+    */
+    template <typename T>
+    struct IsFixed : std::false_type {};
+
+    template <typename I, int F>
+    struct IsFixed<Fixed<I, F>> : std::true_type {};
+
+
+    //##########################################################################
+    // Functions
+    //##########################################################################
+
+
+    //--------------------------------------------------------------------------
+    // Conversion Functions
+    //--------------------------------------------------------------------------
+
+
+    /**
+     * Converts the given integer to the given type, clamped to its range;
+     * both types must have the same signedness.
+     * 
+     * @param value The integer to be converted.
+     * 
+     * @return The closest integer of the given type.
+    */
+    template <typename I, typename W>
+    constexpr I saturate(W value) noexcept
+    {
+        // A narrower integer always fits.
+        if constexpr(sizeof(W) <= sizeof(I))
+            return (I) value;
+        else
+            return value > (W) std::numeric_limits<I>::max() ?
+                std::numeric_limits<I>::max() :
+                value < (W) std::numeric_limits<I>::min() ?
+                std::numeric_limits<I>::min() : (I) value;
+    }
+
+
+    //--------------------------------------------------------------------------
+    // Overflow Functions
+    //--------------------------------------------------------------------------
+
+
+    /**
+     * Adds the integers, wrapping around, and reports if the exact sum does
+     * not fit; branchless, such that the loops vectorize.
+     * 
+     * @param a The first integer.
+     * 
+     * @param b The second integer.
+     * 
+     * @param result Where the wrapped sum is stored.
+     * 
+     * @return True, if the sum overflows; False, otherwise.
+    */
+    template <typename I>
+    bool overflowAdd(I a, I b, I& result) noexcept
+    {
+        static_assert(
+            std::is_integral<I>::value, "The operands must be integers."
+        );
+
+        // Auxiliary variables.
+        typedef std::make_unsigned_t<I> U;
+
+        result = (I) (U) ((U) a + (U) b);
+
+        // Signed sums overflow when both signs differ from the result's.
+        if constexpr(std::is_signed<I>::value)
+            return ((a ^ result) & (b ^ result)) < 0;
+        else
+            return result < a;
+    }
+
+
+    /**
+     * Multiplies the integers, wrapping around, and reports if the exact
+     * product does not fit.
+     * 
+     * @param a The first integer.
+     * 
+     * @param b The second integer.
+     * 
+     * @param result Where the wrapped product is stored.
+     * 
+     * @return True, if the product overflows; False, otherwise.
+    */
+    template <typename I>
+    bool overflowMultiply(I a, I b, I& result) noexcept
+    {
+        static_assert(
+            std::is_integral<I>::value, "The operands must be integers."
+        );
+
+        // Auxiliary variables.
+        Wider<I> product = (Wider<I>) a * (Wider<I>) b;
+        typedef std::make_unsigned_t<I> U;
+
+        result = (I) (U) product;
+
+        return product != (Wider<I>) result;
+    }
+
+
+    /**
+     * Subtracts the integers, wrapping around, and reports if the exact
+     * difference does not fit.
+     * 
+     * @param a The first integer.
+     * 
+     * @param b The integer to be subtracted.
+     * 
+     * @param result Where the wrapped difference is stored.
+     * 
+     * @return True, if the difference overflows; False, otherwise.
+    */
+    template <typename I>
+    bool overflowSubtract(I a, I b, I& result) noexcept
+    {
+        static_assert(
+            std::is_integral<I>::value, "The operands must be integers."
+        );
+
+        // Auxiliary variables.
+        typedef std::make_unsigned_t<I> U;
+
+        result = (I) (U) ((U) a - (U) b);
+
+        // Signed differences overflow when the operands have different signs
+        // and the result has the sign of the subtrahend.
+        if constexpr(std::is_signed<I>::value)
+            return ((a ^ b) & (a ^ result)) < 0;
+        else
+            return a < b;
+    }
+
+
+    //--------------------------------------------------------------------------
+    // Saturation Functions
+    //--------------------------------------------------------------------------
+
+
+    /**
+     * Adds the integers, clamping the result to the range of the type.
+     * 
+     * @param a The first integer.
+     * 
+     * @param b The second integer.
+     * 
+     * @return The saturated sum.
+    */
+    template <typename I>
+    I saturateAdd(I a, I b) noexcept
+    {
+        // Auxiliary variables.
+        I result;
+        bool overflow = overflowAdd(a, b, result);
+        I limit = std::is_signed<I>::value && a < (I) 0 ?
+            std::numeric_limits<I>::min() : std::numeric_limits<I>::max();
+
+        return overflow ? limit : result;
+    }
+
+
+    /**
+     * Multiplies the integers, clamping the result to the range of the type.
+     * 
+     * @param a The first integer.
+     * 
+     * @param b The second integer.
+     * 
+     * @return The saturated product.
+    */
+    template <typename I>
+    I saturateMultiply(I a, I b) noexcept
+    {
+        static_assert(
+            std::is_integral<I>::value, "The operands must be integers."
+        );
+
+        return saturate<I>((Wider<I>) a * (Wider<I>) b);
+    }
+
+
+    /**
+     * Subtracts the integers, clamping the result to the range of the type.
+     * 
+     * @param a The first integer.
+     * 
+     * @param b The integer to be subtracted.
+     * 
+     * @return The saturated difference.
+    */
+    template <typename I>
+    I saturateSubtract(I a, I b) noexcept
+    {
+        // Auxiliary variables.
+        I result;
+        bool overflow = overflowSubtract(a, b, result);
+        I limit = std::is_signed<I>::value && a >= (I) 0 ?
+            std::numeric_limits<I>::max() : std::numeric_limits<I>::min();
+
+        return overflow ? limit : result;
+    }
+}
@@ -11,10 +11,12 @@
 
 // General.
 #include <cmath>
+#include <type_traits>
 
 
 // User defined.
 #include "../Exceptions/exceptionsGeneral.hpp"
+#include "../Exceptions/exceptionsResults.hpp"
 
 
 //##############################################################################
@@ -34,6 +36,16 @@ namespace ValidationGeneral
     ////////////////////////////////////////////////////////////////////////////
     
 
+    //--------------------------------------------------------------------------
+    // Check Functions
+    //--------------------------------------------------------------------------
+
+
+    // Gets the error, if any, of dividing by the given number.
+    template <typename T>
+    ExceptionsResults::Error checkDivision(T variable) noexcept;
+
+
     //--------------------------------------------------------------------------
     // Is Functions
     //--------------------------------------------------------------------------
@@ -45,30 +57,146 @@ namespace ValidationGeneral
 
 
     ////////////////////////////////////////////////////////////////////////////
-    // Non-Template
+    // Inline
     ////////////////////////////////////////////////////////////////////////////
 
 
+    //--------------------------------------------------------------------------
+    // Check Functions
+    //--------------------------------------------------------------------------
+
+
+    // Gets the error, if any, of the consistency of number of dimensions.
+    inline ExceptionsResults::Error checkDimensions(
+        size_t expected, size_t requested
+    ) noexcept;
+
+
+    // Gets the error, if any, of the number being out of the given range.
+    inline ExceptionsResults::Error checkInRange(
+        size_t requested, size_t expectedl, size_t expectedh
+    ) noexcept;
+
+
     //--------------------------------------------------------------------------
     // Validation Functions
     //--------------------------------------------------------------------------
 
 
     // Validates consistency of number of dimensions.
-    bool validateDimensions(size_t expected, size_t requested, bool exception);
+    inline bool validateDimensions(
+        size_t expected, size_t requested, bool exception
+    );
 
 
     // Validates if the number is in the given range.
-    bool validateInRange(
+    inline bool validateInRange(
         size_t requested, size_t expectedl, size_t expectedh,  bool exception
     );
 
 
+    ////////////////////////////////////////////////////////////////////////////
+    // Non-Template
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    //--------------------------------------------------------------------------
+    // Throw Functions
+    //--------------------------------------------------------------------------
+
+
+    // Throws the exception of inconsistent number of dimensions.
+    [[noreturn]] void throwDimensions(size_t expected, size_t requested);
+
+
+    // Throws the exception of a number out of the given range.
+    [[noreturn]] void throwInRange(
+        size_t requested, size_t expectedl, size_t expectedh
+    );
+
+
     //##########################################################################
     // Functions
     //##########################################################################
 
 
+    //--------------------------------------------------------------------------
+    // Check Functions
+    //--------------------------------------------------------------------------
+
+
+    /**
+     * Gets the error, if any, of dividing a finite quantity by the given
+     * variable; without throwing exceptions.
+     * 
+     * @param variable The variable whose division value is to be determined.
+     * 
+     * @return ExceptionsResults::Error::None, if the division is finite.
+     * ExceptionsResults::Error::DivisionByZero, otherwise.
+    */ 
+    template <typename T>
+    ExceptionsResults::Error checkDivision(T variable) noexcept
+    {
+        // Initialize the variables; the exact types only fail on zero.
+        bool valid{variable != (T) 0};
+
+        if constexpr(std::is_floating_point<T>::value)
+        {
+            T var = (T) 1 / variable; 
+            valid = !(std::isnan(var) || std::isinf(var));
+        }
+
+        return valid ?
+            ExceptionsResults::Error::None :
+            ExceptionsResults::Error::DivisionByZero;
+    }
+
+
+    /**
+     * Gets the error, if any, of the requested number of dimensions not
+     * matching the expected one; without throwing exceptions.
+     * 
+     * @param expected The expected number of dimensions.
+     * 
+     * @param requested The requested number of dimensions.
+     * 
+     * @return ExceptionsResults::Error::None, if the requested number of
+     * dimensions matches the expected number of dimensions.
+     * ExceptionsResults::Error::Dimensions, otherwise.
+    */ 
+    inline ExceptionsResults::Error checkDimensions(
+        size_t expected, size_t requested
+    ) noexcept
+    {
+        return expected == requested ?
+            ExceptionsResults::Error::None :
+            ExceptionsResults::Error::Dimensions;
+    }
+
+
+    /**
+     * Gets the error, if any, of the requested number being out of the given
+     * range; without throwing exceptions.
+     * 
+     * @param requested The requested number.
+     * 
+     * @param expectedl The expected lower bound, inclusive.
+     * 
+     * @param expectedh The expected higher bound, inclusive.
+     * 
+     * @return ExceptionsResults::Error::None, if the requested number is in
+     * the range. ExceptionsResults::Error::IndexOutOfRange, otherwise.
+    */ 
+    inline ExceptionsResults::Error checkInRange(
+        size_t requested, size_t expectedl, size_t expectedh
+    ) noexcept
+    {
+        return expectedl <= requested && requested <= expectedh ?
+            ExceptionsResults::Error::None :
+            ExceptionsResults::Error::IndexOutOfRange;
+    }
+
+
     //--------------------------------------------------------------------------
     // Is Functions
     //--------------------------------------------------------------------------
@@ -93,11 +221,87 @@ namespace ValidationGeneral
     bool isNotDivingByZero(T variable, bool exception)
     {   
         // Initialize the variables.
-        T var = (T) 1 / variable; 
-        bool valid = !(std::isnan(var) || std::isinf(var));
+        bool valid = checkDivision(variable) == ExceptionsResults::Error::None;
+
+        // Throw an exception if needed.
+        if(!valid && exception) throw ExceptionsGeneral::DivisionByZero();
+
+        return valid;
+    }
+
+
+    //--------------------------------------------------------------------------
+    // Validation Functions
+    //--------------------------------------------------------------------------
+
+
+    /**
+     * Determines if the requested number of dimensions is consistent; defined
+     * in the header, such that the check is inlined in the hot loops and only
+     * the exception is thrown out of line.
+     * 
+     * @param expected The expected number of dimensions.
+     * 
+     * @param requested The requested number of dimensions.
+     * 
+     * @param exception A boolean flag that indicates if an exception must be
+     * thrown if validation fails. True, if an exception must be thrown if 
+     * validation fails; False, otherwise.
+     * 
+     * @return True, if the requested number of dimensions matches the expected
+     * number of dimensions. False, otherwise.
+     * 
+     * @throw ExceptionsVector::Dimensional, if the requested number of
+     * dimensions doesn't match the expected number of dimensions.
+    */ 
+    inline bool validateDimensions(
+        size_t expected, size_t requested, bool exception
+    )
+    {   
+        // Initialize the variable
+        bool valid =
+            checkDimensions(expected, requested) ==
+            ExceptionsResults::Error::None;
+
+        // Throw an exception if needed.
+        if(!valid && exception) throwDimensions(expected, requested);
+
+        return valid;
+    }
+
+
+    /**
+     * Determines if the requested number is in the given range, e.g., if an
+     * index is valid; defined in the header, like validateDimensions.
+     * 
+     * @param requested The requested number.
+     * 
+     * @param expectedl The expected lower bound, inclusive.
+     * 
+     * @param expectedh The expected higher bound, inclusive.
+     * 
+     * @param exception A boolean flag that indicates if an exception must be
+     * thrown if validation fails. True, if an exception must be thrown if 
+     * validation fails; False, otherwise.
+     * 
+     * @return True, if the requested number is in the range. False,
+     * otherwise.
+     * 
+     * @throw ExceptionsGeneral::IndexOutOfRange, if the requested number is
+     * out of the range.
+    */ 
+    inline bool validateInRange(
+        size_t requested, size_t expectedl, size_t expectedh,  bool exception
+    )
+    {   
+        // Initialize the variable.
+        bool valid =
+            checkInRange(requested, expectedl, expectedh) ==
+            ExceptionsResults::Error::None;
 
         // Throw an exception if needed.
-        if(!valid && exception) ExceptionsGeneral::DivisionByZero();
+        if(!valid && exception)
+            throwInRange(requested, expectedl, expectedh);
 
         return valid;
     }
@@ -11,11 +11,14 @@
 
 // General.
 #include <cmath>
+#include <type_traits>
 #include <typeinfo>
 
 
 // User defined.
 #include "../Exceptions/exceptionsNumerical.hpp"
+#include "../Types/typesFloating.hpp"
+#include "../Types/typesInteger.hpp"
 
 
 //##############################################################################
@@ -40,6 +43,11 @@ namespace ValidationNumerical
     //--------------------------------------------------------------------------
 
 
+    // Determines if the given variable is of a type that can accumulate.
+    template <typename T>
+    bool isAccumulator(T variable, bool exception);
+
+
     // Determines if the given variable is of a floting point numerical type.
     template <typename T>
     bool isFloating(T variable, bool exception);
@@ -65,6 +73,11 @@ namespace ValidationNumerical
     bool isNumber(T variable, bool exception);
 
 
+    // Determines if the given variable is of a type that can store entries.
+    template <typename T>
+    bool isStorage(T variable, bool exception);
+
+
     //--------------------------------------------------------------------------
     // Range Functions
     //--------------------------------------------------------------------------
@@ -85,6 +98,42 @@ namespace ValidationNumerical
     //--------------------------------------------------------------------------
 
 
+    /**
+     * Determines if the given variable is of a type with which the reductions
+     * can be accumulated, i.e., a standard floating point type, an integer
+     * type or a fixed point type.
+     * 
+     * @param variable The variable whose nature is to be determined.
+     * 
+     * @param exception A boolean flag that indicates if an exception must be
+     * thrown if validation fails. True, if an exception must be thrown if 
+     * validation fails; False, otherwise.
+     * 
+     * @return True, if the variable is of an accumulation type. False,
+     * otherwise.
+     * 
+     * @throw ExceptionsNumerical::Numerical, if the variable being checked is
+     * not of an accumulation type.
+    */ 
+    template <typename T>
+    bool isAccumulator(T variable, bool exception)
+    {   
+        // Initialize the variable
+        bool valid{false};
+
+        // The fixed point types are templates, compared at compile time.
+        if constexpr (TypesInteger::IsFixed<T>::value)
+            valid = true;
+        else
+            valid = isNumber(variable, false);
+
+        // Throw an exception if needed.
+        if(!valid && exception) throw ExceptionsNumerical::Numerical();
+
+        return valid;
+    }
+
+
     /**
      * Determines if the given variable is a floating point number type.
      * 
@@ -265,6 +314,53 @@ namespace ValidationNumerical
     }
 
 
+    /**
+     * Determines if the given variable is of a type that can be used to store
+     * values, i.e., a standard floating point type, one of the reduced
+     * precision types whose arithmetic must be done in a wider type, an
+     * integer type or a fixed point type.
+     * 
+     * @param variable The variable whose nature is to be determined.
+     * 
+     * @param exception A boolean flag that indicates if an exception must be
+     * thrown if validation fails. True, if an exception must be thrown if 
+     * validation fails; False, otherwise.
+     * 
+     * @return True, if the variable is of a storage type. False, otherwise.
+     * 
+     * @throw ExceptionsNumerical::Numerical, if the variable being checked is
+     * not of a storage type.
+    */ 
+    template <typename T>
+    bool isStorage(T variable, bool exception)
+    {   
+        // Initialize the variable
+        bool valid{false};
+
+// The runtime library may not provide the type information of the half
+// precision type, it must be compared at compile time.
+#ifdef __FLT16_MAX__
+        if constexpr (std::is_same<T, TypesFloating::Float16>::value)
+            valid = true;
+        else
+#endif
+        if constexpr (TypesInteger::IsFixed<T>::value)
+            valid = true;
+        else
+        {
+            // Compare with all the known floating point and integer types.
+            valid = valid || isNumber(variable, false);
+            valid = valid || 
+                typeid(variable) == typeid(TypesFloating::BFloat16);
+        }
+
+        // Throw an exception if needed.
+        if(!valid && exception) throw ExceptionsNumerical::Numerical();
+
+        return valid;
+    }
+
+
     //--------------------------------------------------------------------------
     // Range Functions
     //--------------------------------------------------------------------------
@@ -0,0 +1,569 @@
+/*
+    File that contains the implementation functions of the lossless
+    transformations and compression of raw bytes.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+#include "../../Headers/Compression/compressionGeneral.hpp"
+
+
+//##############################################################################
+// Namespaces
+//##############################################################################
+
+
+namespace CompressionGeneral
+{
+    //##########################################################################
+    // Functions
+    //##########################################################################
+
+
+    //--------------------------------------------------------------------------
+    // Auxiliary Functions
+    //--------------------------------------------------------------------------
+
+
+    /**
+     * Appends the given bytes as literal tokens, i.e., a token with the
+     * number of bytes minus one followed by the bytes, of at most
+     * maximumLiteral bytes each.
+     * 
+     * @param bytes The bytes to be appended.
+     * 
+     * @param size The number of bytes.
+     * 
+     * @param encoded Where the tokens are appended.
+    */
+    static void appendLiterals(
+        const uint8_t* bytes, size_t size, std::vector<uint8_t>& encoded
+    )
+    {
+        while(size > 0)
+        {
+            size_t length = size < maximumLiteral ? size : maximumLiteral;
+
+            encoded.push_back((uint8_t) (length - 1));
+            encoded.insert(encoded.end(), bytes, bytes + length);
+
+            bytes += length;
+            size -= length;
+        }
+    }
+
+
+    /**
+     * Computes the lengths of the Huffman codes of the bytes with the given
+     * counts, of at most maximumCodeLength bits. While the codes are too
+     * long, the counts are halved, which flattens the tree.
+     * 
+     * @param counts The number of times each byte appears.
+     * 
+     * @param lengths Where the number of bits of the code of each byte is
+     * stored; zero for the bytes that do not appear.
+    */
+    static void codeLengths(const uint64_t* counts, uint8_t* lengths)
+    {
+        // Auxiliary variables.
+        typedef std::pair<uint64_t, size_t> Node;
+        std::vector<uint64_t> weights(counts, counts + symbols);
+        std::vector<size_t> parents(2 * symbols);
+        std::vector<uint8_t> depths(2 * symbols);
+
+        while(true)
+        {
+            // Auxiliary variables.
+            std::priority_queue<Node, std::vector<Node>, std::greater<Node>>
+                heap;
+            size_t nodes{symbols}, longest{0};
+
+            for(size_t s = 0; s < symbols; ++s)
+            {
+                lengths[s] = 0;
+                if(weights[s] > 0) heap.push(Node(weights[s], s));
+            }
+
+            // A single byte still needs a code of one bit.
+            if(heap.size() == 1) lengths[heap.top().second] = 1;
+            if(heap.size() <= 1) return;
+
+            // Merge the two lightest nodes until there is a single tree.
+            while(heap.size() > 1)
+            {
+                Node a = heap.top();
+                heap.pop();
+                Node b = heap.top();
+                heap.pop();
+
+                parents[a.second] = nodes;
+                parents[b.second] = nodes;
+                heap.push(Node(a.first + b.first, nodes++));
+            }
+
+            // The parents are created after their children.
+            depths[nodes - 1] = 0;
+            for(size_t n = nodes - 1; n-- > symbols;)
+                depths[n] = depths[parents[n]] + 1;
+
+            for(size_t s = 0; s < symbols; ++s)
+            {
+                if(weights[s] == 0) continue;
+
+                lengths[s] = depths[parents[s]] + 1;
+                longest = std::max<size_t>(longest, lengths[s]);
+            }
+
+            if(longest <= maximumCodeLength) return;
+
+            for(uint64_t& weight : weights)
+                if(weight > 0) weight = (weight + 1) / 2;
+        }
+    }
+
+
+    /**
+     * Computes the canonical Huffman codes of the given lengths, with their
+     * bits reversed, such that they are written and read least significant
+     * bit first.
+     * 
+     * @param lengths The number of bits of the code of each byte.
+     * 
+     * @param codes Where the reversed code of each byte is stored.
+    */
+    static void canonicalCodes(const uint8_t* lengths, uint16_t* codes)
+    {
+        // Auxiliary variables.
+        uint16_t next[maximumCodeLength + 2]{0};
+        size_t counts[maximumCodeLength + 1]{0};
+
+        for(size_t s = 0; s < symbols; ++s) ++counts[lengths[s]];
+        counts[0] = 0;
+
+        // The first code of each length.
+        for(size_t l = 1; l <= maximumCodeLength; ++l)
+            next[l + 1] = (uint16_t) ((next[l] + counts[l]) << 1);
+
+        for(size_t s = 0; s < symbols; ++s)
+        {
+            // Auxiliary variables.
+            size_t length = lengths[s];
+            uint16_t code{0}, reversed{0};
+
+            if(length == 0) continue;
+
+            code = next[length]++;
+            for(size_t b = 0; b < length; ++b)
+                reversed |= (uint16_t) (((code >> b) & 1) << (length - 1 - b));
+
+            codes[s] = reversed;
+        }
+    }
+
+
+    //--------------------------------------------------------------------------
+    // Shuffle Functions
+    //--------------------------------------------------------------------------
+
+
+    /**
+     * Groups the bytes of the elements by their position in the element,
+     * i.e., the first bytes of all the elements, then the second ones and so
+     * on. The bytes of similar numbers, like the sign and exponent, become
+     * long runs of equal bytes that compress well.
+     * 
+     * @param bytes The bytes of the elements, one element after the other.
+     * 
+     * @param count The number of elements.
+     * 
+     * @param width The number of bytes of each element.
+     * 
+     * @param shuffled Where the count * width grouped bytes are stored; must
+     * not overlap with the bytes.
+    */
+    void shuffle(
+        const uint8_t* bytes, size_t count, size_t width, uint8_t* shuffled
+    ) noexcept
+    {
+        for(size_t k = 0; k < width; ++k)
+        {
+            // Auxiliary variables.
+            uint8_t* group = shuffled + k * count;
+
+            for(size_t i = 0; i < count; ++i)
+                group[i] = bytes[i * width + k];
+        }
+    }
+
+
+    /**
+     * Restores the bytes of the elements grouped by shuffle.
+     * 
+     * @param shuffled The bytes grouped by their position in the element.
+     * 
+     * @param count The number of elements.
+     * 
+     * @param width The number of bytes of each element.
+     * 
+     * @param bytes Where the count * width bytes of the elements are stored;
+     * must not overlap with the shuffled bytes.
+    */
+    void unshuffle(
+        const uint8_t* shuffled, size_t count, size_t width, uint8_t* bytes
+    ) noexcept
+    {
+        for(size_t k = 0; k < width; ++k)
+        {
+            // Auxiliary variables.
+            const uint8_t* group = shuffled + k * count;
+
+            for(size_t i = 0; i < count; ++i)
+                bytes[i * width + k] = group[i];
+        }
+    }
+
+
+    //--------------------------------------------------------------------------
+    // Run Length Functions
+    //--------------------------------------------------------------------------
+
+
+    /**
+     * Appends the run length encoding of the given bytes. Each token is a
+     * byte followed by its data: when its highest bit is set, it is a run of
+     * (token & 0x7F) + minimumRun copies of the next byte; otherwise, it is
+     * a literal of token + 1 bytes. At most one byte is added for every
+     * maximumLiteral bytes that do not compress.
+     * 
+     * @param bytes The bytes to be encoded.
+     * 
+     * @param size The number of bytes.
+     * 
+     * @param encoded Where the tokens are appended.
+    */
+    void runLengthEncode(
+        const uint8_t* bytes, size_t size, std::vector<uint8_t>& encoded
+    )
+    {
+        // Auxiliary variables.
+        size_t literal{0}, i{0};
+
+        while(i < size)
+        {
+            // Find the number of equal bytes starting at i.
+            size_t run{1};
+            while(
+                i + run < size && run < maximumRun && bytes[i + run] == bytes[i]
+            )
+                ++run;
+
+            // Short runs are left in the literals.
+            if(run >= minimumRun)
+            {
+                appendLiterals(bytes + literal, i - literal, encoded);
+                encoded.push_back((uint8_t) (0x80 | (run - minimumRun)));
+                encoded.push_back(bytes[i]);
+                literal = i + run;
+            }
+
+            i += run;
+        }
+
+        appendLiterals(bytes + literal, size - literal, encoded);
+    }
+
+
+    /**
+     * Decodes the given run length encoded bytes, checking that the tokens
+     * are complete and that they decode to exactly the expected number of
+     * bytes.
+     * 
+     * @param encoded The tokens to be decoded.
+     * 
+     * @param size The number of bytes of the tokens.
+     * 
+     * @param bytes Where the decoded bytes are stored.
+     * 
+     * @param expected The number of decoded bytes.
+     * 
+     * @return True, if the tokens are valid; False, otherwise.
+    */
+    bool runLengthDecode(
+        const uint8_t* encoded, size_t size, uint8_t* bytes, size_t expected
+    ) noexcept
+    {
+        // Auxiliary variables.
+        size_t in{0}, out{0};
+
+        while(in < size)
+        {
+            // Auxiliary variables.
+            uint8_t token = encoded[in++];
+
+            if(token & 0x80)
+            {
+                size_t run = (token & 0x7F) + minimumRun;
+                if(in == size || expected - out < run) return false;
+
+                std::memset(bytes + out, encoded[in++], run);
+                out += run;
+            }
+            else
+            {
+                size_t length = (size_t) token + 1;
+                if(size - in < length || expected - out < length)
+                    return false;
+
+                std::memcpy(bytes + out, encoded + in, length);
+                in += length;
+                out += length;
+            }
+        }
+
+        return out == expected;
+    }
+
+
+    //--------------------------------------------------------------------------
+    // Huffman Functions
+    //--------------------------------------------------------------------------
+
+
+    /**
+     * Appends the Huffman coding of the given bytes: the lengths of the
+     * codes of the 256 bytes, four bits each, followed by the canonical
+     * codes of the bytes, least significant bit first. The bytes with a
+     * skewed distribution, like the exponents of similar numbers, take less
+     * than eight bits each.
+     * 
+     * @param bytes The bytes to be coded.
+     * 
+     * @param size The number of bytes.
+     * 
+     * @param encoded Where the coding is appended.
+    */
+    void huffmanEncode(
+        const uint8_t* bytes, size_t size, std::vector<uint8_t>& encoded
+    )
+    {
+        // Auxiliary variables.
+        uint64_t counts[symbols]{0};
+        uint8_t lengths[symbols]{0};
+        uint16_t codes[symbols]{0};
+        uint64_t buffer{0};
+        size_t bits{0};
+
+        for(size_t i = 0; i < size; ++i) ++counts[bytes[i]];
+
+        codeLengths(counts, lengths);
+        canonicalCodes(lengths, codes);
+
+        for(size_t s = 0; s < symbols; s += 2)
+            encoded.push_back((uint8_t) (lengths[s] | lengths[s + 1] << 4));
+
+        // Write the codes, flushing the whole bytes of the buffer.
+        for(size_t i = 0; i < size; ++i)
+        {
+            buffer |= (uint64_t) codes[bytes[i]] << bits;
+            bits += lengths[bytes[i]];
+
+            for(; bits >= 8; bits -= 8, buffer >>= 8)
+                encoded.push_back((uint8_t) buffer);
+        }
+
+        if(bits > 0) encoded.push_back((uint8_t) buffer);
+    }
+
+
+    /**
+     * Decodes the given Huffman coded bytes, checking that the lengths form
+     * a valid code and that the codes decode to exactly the expected number
+     * of bytes.
+     * 
+     * @param encoded The coding to be decoded.
+     * 
+     * @param size The number of bytes of the coding.
+     * 
+     * @param bytes Where the decoded bytes are stored.
+     * 
+     * @param expected The number of decoded bytes.
+     * 
+     * @return True, if the coding is valid; False, otherwise.
+    */
+    bool huffmanDecode(
+        const uint8_t* encoded, size_t size, uint8_t* bytes, size_t expected
+    ) noexcept
+    {
+        // Auxiliary variables.
+        constexpr size_t entries{(size_t) 1 << maximumCodeLength};
+        uint8_t lengths[symbols]{0};
+        uint16_t codes[symbols]{0};
+        uint16_t table[entries]{0};
+        size_t kraft{0}, in{symbols / 2}, bits{0};
+        uint64_t buffer{0};
+
+        if(size < in) return false;
+
+        // Validate the lengths do not oversubscribe the codes.
+        for(size_t s = 0; s < symbols; ++s)
+        {
+            lengths[s] = (encoded[s / 2] >> (4 * (s % 2))) & 0x0F;
+            if(lengths[s] > maximumCodeLength) return false;
+            if(lengths[s] > 0) kraft += entries >> lengths[s];
+        }
+        if(kraft > entries) return false;
+
+        // Each entry holds the byte and the length of its code; the entries
+        // of the unused codes have a length of zero.
+        canonicalCodes(lengths, codes);
+        for(size_t s = 0; s < symbols; ++s)
+            for(
+                size_t e = codes[s]; lengths[s] > 0 && e < entries;
+                e += (size_t) 1 << lengths[s]
+            )
+                table[e] = (uint16_t) (s | lengths[s] << 8);
+
+        for(size_t out = 0; out < expected; ++out)
+        {
+            for(; bits <= 56 && in < size; bits += 8)
+                buffer |= (uint64_t) encoded[in++] << bits;
+
+            // Auxiliary variables.
+            uint16_t entry = table[buffer & (entries - 1)];
+            size_t length = entry >> 8;
+
+            if(length == 0 || length > bits) return false;
+
+            bytes[out] = (uint8_t) entry;
+            buffer >>= length;
+            bits -= length;
+        }
+
+        // Only the padding of the last byte can be left.
+        return in == size && bits < 8;
+    }
+
+
+    //--------------------------------------------------------------------------
+    // Plane Functions
+    //--------------------------------------------------------------------------
+
+
+    /**
+     * Appends the coding of each byte plane of the given shuffled bytes,
+     * i.e., of the count bytes with the same position in the elements. Each
+     * plane is stored, run length encoded or Huffman coded, whichever is the
+     * smallest, as a Coding byte, its number of bytes, least significant byte
+     * first, in four bytes, and its bytes.
+     * 
+     * @param shuffled The bytes grouped by shuffle.
+     * 
+     * @param count The number of elements.
+     * 
+     * @param width The number of bytes of each element.
+     * 
+     * @param encoded Where the coding is appended.
+    */
+    void planesEncode(
+        const uint8_t* shuffled, size_t count, size_t width,
+        std::vector<uint8_t>& encoded
+    )
+    {
+        // Auxiliary variables.
+        std::vector<uint8_t> runs, codes;
+
+        for(size_t k = 0; k < width; ++k)
+        {
+            // Auxiliary variables.
+            const uint8_t* plane = shuffled + k * count;
+            const uint8_t* best = plane;
+            size_t size = count;
+            Coding coding{Coding::Stored};
+
+            runs.clear();
+            codes.clear();
+            runLengthEncode(plane, count, runs);
+            huffmanEncode(plane, count, codes);
+
+            if(runs.size() < size)
+            {
+                best = runs.data();
+                size = runs.size();
+                coding = Coding::RunLength;
+            }
+            if(codes.size() < size)
+            {
+                best = codes.data();
+                size = codes.size();
+                coding = Coding::Huffman;
+            }
+
+            encoded.push_back((uint8_t) coding);
+            for(size_t b = 0; b < 4; ++b)
+                encoded.push_back((uint8_t) (size >> (8 * b)));
+            encoded.insert(encoded.end(), best, best + size);
+        }
+    }
+
+
+    /**
+     * Decodes the byte planes coded by planesEncode, checking that each plane
+     * decodes to exactly count bytes and that nothing is left.
+     * 
+     * @param encoded The coding to be decoded.
+     * 
+     * @param size The number of bytes of the coding.
+     * 
+     * @param count The number of elements.
+     * 
+     * @param width The number of bytes of each element.
+     * 
+     * @param shuffled Where the count * width shuffled bytes are stored.
+     * 
+     * @return True, if the coding is valid; False, otherwise.
+    */
+    bool planesDecode(
+        const uint8_t* encoded, size_t size, size_t count, size_t width,
+        uint8_t* shuffled
+    ) noexcept
+    {
+        // Auxiliary variables.
+        size_t in{0};
+
+        for(size_t k = 0; k < width; ++k)
+        {
+            // Auxiliary variables.
+            uint8_t* plane = shuffled + k * count;
+            size_t length{0};
+            bool valid{false};
+
+            if(size - in < 5) return false;
+
+            Coding coding = (Coding) encoded[in++];
+            for(size_t b = 0; b < 4; ++b)
+                length |= (size_t) encoded[in++] << (8 * b);
+
+            if(size - in < length) return false;
+
+            if(coding == Coding::Stored)
+            {
+                valid = length == count;
+                if(valid && count > 0) std::memcpy(plane, encoded + in, count);
+            }
+            else if(coding == Coding::RunLength)
+                valid = runLengthDecode(encoded + in, length, plane, count);
+            else if(coding == Coding::Huffman)
+                valid = huffmanDecode(encoded + in, length, plane, count);
+
+            if(!valid) return false;
+
+            in += length;
+        }
+
+        return in == size;
+    }
+}
@@ -0,0 +1,115 @@
+/*
+    File that contains the implementation functions to compute the checksums
+    of raw bytes.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+#include "../../Headers/Hashing/hashingGeneral.hpp"
+
+
+//##############################################################################
+// Namespaces
+//##############################################################################
+
+
+namespace HashingGeneral
+{
+    //##########################################################################
+    // Functions
+    //##########################################################################
+
+
+    //--------------------------------------------------------------------------
+    // Auxiliary Functions
+    //--------------------------------------------------------------------------
+
+
+    /**
+     * Builds the tables of the remainders for the reflected CRC-32
+     * polynomial, 0xEDB88320: the first one of each byte, and the k-th one
+     * of each byte followed by k zero bytes, such that eight bytes are
+     * processed at a time.
+     * 
+     * @return The eight tables of the remainders, one after the other.
+    */
+    static const uint32_t (*crc32Tables() noexcept)[256]
+    {
+        // The tables are built only once, the first time they are requested.
+        static const struct Tables
+        {
+            Tables()
+            {
+                for(uint32_t i = 0; i < 256; ++i)
+                {
+                    uint32_t remainder = i;
+
+                    for(int bit = 0; bit < 8; ++bit)
+                        remainder = (remainder >> 1) ^
+                            (0xEDB88320u & (0u - (remainder & 1u)));
+
+                    entries[0][i] = remainder;
+                }
+
+                for(size_t k = 1; k < 8; ++k)
+                    for(size_t i = 0; i < 256; ++i)
+                        entries[k][i] = (entries[k - 1][i] >> 8) ^
+                            entries[0][entries[k - 1][i] & 0xFFu];
+            }
+
+            uint32_t entries[8][256];
+        } tables;
+
+        return tables.entries;
+    }
+
+
+    //--------------------------------------------------------------------------
+    // Checksum Functions
+    //--------------------------------------------------------------------------
+
+
+    /**
+     * Updates the CRC-32 checksum, as used by zlib and PNG, with the given
+     * bytes; a checksum is started with a crc of zero and the bytes can be
+     * added in several calls.
+     * 
+     * @param bytes The bytes to be added.
+     * 
+     * @param size The number of bytes.
+     * 
+     * @param crc The checksum of the previous bytes; zero for the first ones.
+     * 
+     * @return The checksum of the previous bytes and the given ones.
+    */
+    uint32_t crc32(const uint8_t* bytes, size_t size, uint32_t crc) noexcept
+    {
+        // Auxiliary variables.
+        const uint32_t (*tables)[256] = crc32Tables();
+        size_t i{0};
+
+        crc = ~crc;
+
+        // Eight bytes at a time, without the carried dependency per byte.
+        for(; i + 8 <= size; i += 8)
+        {
+            uint32_t low = crc ^ ((uint32_t) bytes[i] |
+                (uint32_t) bytes[i + 1] << 8 | (uint32_t) bytes[i + 2] << 16 |
+                (uint32_t) bytes[i + 3] << 24);
+
+            crc = tables[7][low & 0xFFu] ^ tables[6][(low >> 8) & 0xFFu] ^
+                tables[5][(low >> 16) & 0xFFu] ^ tables[4][low >> 24] ^
+                tables[3][bytes[i + 4]] ^ tables[2][bytes[i + 5]] ^
+                tables[1][bytes[i + 6]] ^ tables[0][bytes[i + 7]];
+        }
+
+        for(; i < size; ++i)
+            crc = tables[0][(crc ^ bytes[i]) & 0xFFu] ^ (crc >> 8);
+
+        return ~crc;
+    }
+}
@@ -0,0 +1,37 @@
+/*
+    File that contains the explicit instantiations of the vectors for the
+    common floating point types, such that they are compiled, optimized, only
+    once in the library.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+#include "../../nvectors.hpp"
+#include "../../vnvectors.hpp"
+
+
+//##############################################################################
+// Explicit Instantiations
+//##############################################################################
+
+
+// NVectors.
+template class NVector::NVector<float>;
+template class NVector::NVector<double>;
+template class NVector::NVector<long double>;
+
+
+// Member templates of the norms of the NVectors.
+NVECTORS_NORM_MEMBERS(template, float)
+NVECTORS_NORM_MEMBERS(template, double)
+NVECTORS_NORM_MEMBERS(template, long double)
+
+
+// Vectors of NVectors.
+template class VNVectors::VNVectors<float>;
+template class VNVectors::VNVectors<double>;
+template class VNVectors::VNVectors<long double>;
@@ -0,0 +1,54 @@
+/*
+    File that contains the implementation functions to split work among
+    several threads.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+#include "../../Headers/Parallel/parallelGeneral.hpp"
+
+
+//##############################################################################
+// Namespaces
+//##############################################################################
+
+
+namespace ParallelGeneral
+{
+    //##########################################################################
+    // Functions
+    //##########################################################################
+
+
+    //--------------------------------------------------------------------------
+    // Query Functions
+    //--------------------------------------------------------------------------
+
+
+    /**
+     * Gets the number of threads to be used for the given amount of work, such
+     * that each thread gets at least the given grain of work and no more
+     * threads than the hardware supports are used.
+     * 
+     * @param work The amount of work to be split.
+     * 
+     * @param grain The minimum amount of work per thread.
+     * 
+     * @return The number of threads to be used; at least one.
+    */
+    size_t threads(size_t work, size_t grain)
+    {
+        // Auxiliary variables.
+        size_t hardware = std::thread::hardware_concurrency();
+        size_t chunks = work / std::max<size_t>(grain, 1);
+
+        // The hardware concurrency can be unknown, i.e., zero.
+        hardware = std::max<size_t>(hardware, 1);
+
+        return std::max<size_t>(std::min(hardware, chunks), 1);
+    }
+}
@@ -25,70 +25,43 @@ namespace ValidationGeneral
 
 
     //--------------------------------------------------------------------------
-    // Validation Functions
+    // Throw Functions
     //--------------------------------------------------------------------------
 
 
-     /**
-     * Determines if the requested number of dimensions is consistent.
+    /**
+     * Throws the exception of the requested number of dimensions not
+     * matching the expected one; kept out of line, such that the inline
+     * validations stay small.
      * 
      * @param expected The expected number of dimensions.
      * 
      * @param requested The requested number of dimensions.
      * 
-     * @param exception A boolean flag that indicates if an exception must be
-     * thrown if validation fails. True, if an exception must be thrown if 
-     * validation fails; False, otherwise.
-     * 
-     * @return True, if the requested number of dimensions matches the expected
-     * number of dimensions. False, otherwise.
-     * 
-     * @throw ExceptionsVector::Dimensional, if the requested number of
-     * dimensions doesn't match the expected number of dimensions.
+     * @throw ExceptionsGeneral::Dimensions, always.
     */ 
-    bool validateDimensions(size_t expected, size_t requested, bool exception)
-    {   
-        // Initialize the variable
-        bool valid = expected == requested;
-
-        // Throw an exception if needed.
-        if(!valid && exception)
-            throw ExceptionsGeneral::Dimensions(expected, requested);
-
-        return valid;
+    void throwDimensions(size_t expected, size_t requested)
+    {
+        throw ExceptionsGeneral::Dimensions(expected, requested);
     }
 
 
-     /**
-     * Determines if the requested number of dimensions is consistent.
+    /**
+     * Throws the exception of the requested number being out of the given
+     * range.
      * 
-     * @param expected The expected number of dimensions.
+     * @param requested The requested number.
      * 
-     * @param requested The requested number of dimensions.
-     * 
-     * @param exception A boolean flag that indicates if an exception must be
-     * thrown if validation fails. True, if an exception must be thrown if 
-     * validation fails; False, otherwise.
+     * @param expectedl The expected lower bound, inclusive.
      * 
-     * @return True, if the requested number of dimensions matches the expected
-     * number of dimensions. False, otherwise.
+     * @param expectedh The expected higher bound, inclusive.
      * 
-     * @throw ExceptionsVector::Dimensional, if the requested number of
-     * dimensions doesn't match the expected number of dimensions.
+     * @throw ExceptionsGeneral::IndexOutOfRange, always.
     */ 
-    bool validateInRange(
-        size_t requested, size_t expectedl, size_t expectedh,  bool exception
-    )
-    {   
-        // Initialize the variable.
-        bool valid = expectedl <= requested && requested <= expectedh;
-
-        // Throw an exception if needed.
-        if(!valid && exception)
-            throw ExceptionsGeneral::IndexOutOfRange(
-                expectedl, expectedh, requested
-            );
-
-        return valid;
+    void throwInRange(size_t requested, size_t expectedl, size_t expectedh)
+    {
+        throw ExceptionsGeneral::IndexOutOfRange(
+            expectedl, expectedh, requested
+        );
     }
 }
\ No newline at end of file
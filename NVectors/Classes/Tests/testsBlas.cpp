@@ -0,0 +1,151 @@
+/*
+    File that contains the tests of the level 1 functions of BLAS, for the
+    NVectors and, row by row, for the vectors of NVectors.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+
+// User defined.
+#include "../blas.hpp"
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks the functions over the NVectors, with the L2 norms of entries whose
+ * squares overflow and underflow.
+*/
+void testVector()
+{
+    // Auxiliary variables.
+    NVector::NVector<double> x(11, [](size_t i){ return (double) i - 5; });
+    NVector::NVector<double> y(11, [](size_t i){ return (double) i; });
+    const NVector::NVector<double>& constant = x;
+
+    // Updates.
+    Blas::axpy(2.0, x, y);
+    assert(y[0] == -10 && y[10] == 20);
+    Blas::axpby(1.0, x, 0.5, y);
+    assert(y[0] == -10 && y[10] == 15);
+    Blas::scal(2.0, y);
+    assert(y[0] == -20 && y[10] == 30);
+    Blas::swap(x, y);
+    assert(x[0] == -20 && y[0] == -5);
+    Blas::swap(x, y);
+
+    // Reductions, through the const accessors.
+    assert(Blas::asum(constant) == 30);
+    assert(Blas::iamax(constant) == 0);
+    assert(std::fabs(Blas::nrm2(constant) - std::sqrt(110.0)) < 1e-14);
+
+    // Scaled L2 norms.
+    NVector::NVector<double> big(4, 1e300);
+    NVector::NVector<double> tiny(4, 1e-300);
+    NVector::NVector<double> zeros(4, 0.0);
+    assert(std::fabs(Blas::nrm2(big) / 2e300 - 1) < 1e-15);
+    assert(std::fabs(Blas::nrm2(tiny) / 2e-300 - 1) < 1e-15);
+    assert(Blas::nrm2(zeros) == 0);
+    zeros[1] = std::numeric_limits<double>::infinity();
+    assert(std::isinf(Blas::nrm2(zeros)));
+
+    // Different dimensions.
+    bool thrown = false;
+    try { Blas::swap(x, big); } catch(...) { thrown = true; }
+    assert(thrown);
+}
+
+
+/**
+ * Checks the functions over the vectors of NVectors, that must agree with
+ * the ones over each of their NVectors, also in single precision.
+ *
+ * @param parallel If the functions must run in parallel.
+*/
+void testVectors(bool parallel)
+{
+    // Auxiliary variables.
+    size_t size = 3000, dimension = 40;
+    VNVectors::VNVectors<float> x(dimension, size, [](size_t i, size_t j){
+        return (float) ((i * 31 + j * 17) % 97) / 7.0f - 6.0f;
+    });
+    VNVectors::VNVectors<float> y(dimension, size, [](size_t i, size_t j){
+        return (float) ((i * 13 + j * 7) % 89) / 3.0f;
+    });
+    const VNVectors::VNVectors<float>& constant = x;
+
+    // Reductions, row by row, as NVector<float, double>.
+    NVector::NVector<float> sums = Blas::asum(constant, parallel);
+    NVector::NVector<float> norms = Blas::nrm2(constant, parallel);
+    std::vector<size_t> largest = Blas::iamax(constant, parallel);
+    for(size_t i = 0; i < size; ++i)
+    {
+        NVector::NVector<float, double> row(dimension, [&](size_t j){
+            return x[i][j];
+        });
+        assert(sums[i] == (float) Blas::asum(row));
+        assert(norms[i] == (float) Blas::nrm2(row));
+        assert(largest[i] == Blas::iamax(row));
+    }
+
+    // Updates, row by row, as NVector<float, double>.
+    VNVectors::VNVectors<float> z = y;
+    Blas::axpby(0.1f, x, 0.3f, z, parallel);
+    Blas::axpy(0.7f, x, z, parallel);
+    Blas::scal(1.1f, z, parallel);
+    for(size_t i = 0; i < size; i += 7)
+    {
+        NVector::NVector<float, double> a(dimension, [&](size_t j){
+            return x[i][j];
+        });
+        NVector::NVector<float, double> b(dimension, [&](size_t j){
+            return y[i][j];
+        });
+        Blas::axpby(0.1f, a, 0.3f, b);
+        Blas::axpy(0.7f, a, b);
+        Blas::scal(1.1f, b);
+        for(size_t j = 0; j < dimension; ++j) assert(z[i][j] == b[j]);
+    }
+
+    // Exchanges.
+    Blas::swap(y, z, parallel);
+    Blas::swap(y, z, parallel);
+    assert(z[5][3] != y[5][3]);
+
+    // Different shapes.
+    bool thrown = false;
+    VNVectors::VNVectors<float> other(dimension + 1, size);
+    try { Blas::axpy(1.0f, x, other, parallel); } catch(...) { thrown = true; }
+    assert(thrown);
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testVector();
+    testVectors(false);
+    testVectors(true);
+
+    std::cout << "Blas tests passed." << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,208 @@
+/*
+    File that contains the tests of the element-wise operations of the NVectors
+    and of the vectors of NVectors, with scalars, with NVectors broadcast over
+    the rows or the columns, and with other vectors of NVectors.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cassert>
+#include <iostream>
+#include <random>
+
+
+// User defined.
+#include "../vnvectors.hpp"
+
+
+//##############################################################################
+// Auxiliary Functions
+//##############################################################################
+
+
+/**
+ * Checks that the entries of the given vector of NVectors are the ones
+ * given by the function, for a sample of the NVectors.
+ *
+ * @param vectors The vector of NVectors to be checked.
+ *
+ * @param function The function that returns the expected entry, given the
+ * index of the NVector and the index of the entry.
+*/
+template <typename F>
+void check(const VNVectors::VNVectors<double>& vectors, F function)
+{
+    for(size_t i = 0; i < vectors.size(); i += 101)
+        for(size_t j = 0; j < vectors.dimensions(); ++j)
+            assert(vectors[i][j] == function(i, j));
+}
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks the broadcasts of the given functions over the rows, the columns
+ * and the entries of vectors of NVectors.
+ *
+ * @param parallel If the broadcasts must run in parallel.
+*/
+void testBroadcasts(bool parallel)
+{
+    // Auxiliary variables.
+    size_t dimensions = 5, size = 10000;
+    std::mt19937 generator(3);
+    std::uniform_real_distribution<double> uniform(0.5, 2);
+    VNVectors::VNVectors<double> a(dimensions, size, [&](size_t, size_t){
+        return uniform(generator);
+    });
+    NVector::NVector<double> columns(size, [&](size_t){
+        return uniform(generator);
+    });
+
+    // Columns.
+    VNVectors::VNVectors<double> x = a;
+    x.broadcastColumnsIP(columns, [](double p, double q){
+        return p * q;
+    }, parallel);
+    check(x, [&](size_t i, size_t j){ return a[i][j] * columns[i]; });
+
+    // Rows, with one of its own NVectors.
+    VNVectors::VNVectors<double> y = a;
+    y.broadcastRowsIP(y[3], [](double p, double q){
+        return p - q;
+    }, parallel);
+    check(y, [&](size_t i, size_t j){ return a[i][j] - a[3][j]; });
+
+    // Entries, with itself.
+    VNVectors::VNVectors<double> z = a;
+    z.broadcastIP(z, [](double p, double q){ return p + q; }, parallel);
+    check(z, [&](size_t i, size_t j){ return 2 * a[i][j]; });
+
+    // Columns of another size.
+    bool thrown = false;
+    NVector::NVector<double> small(size - 1, 1.0);
+    auto first = [](double p, double){ return p; };
+    try { x.broadcastColumnsIP(small, first, parallel); }
+    catch(ExceptionsGeneral::Dimensions&) { thrown = true; }
+    assert(thrown);
+}
+
+
+/**
+ * Checks the operators of the vectors of NVectors with scalars, with
+ * NVectors broadcast over the rows and with other vectors of NVectors, and
+ * that the failed ones leave the operand unchanged.
+*/
+void testOperators()
+{
+    // Auxiliary variables.
+    size_t dimensions = 5, size = 10000;
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> uniform(0.5, 2);
+    auto random = [&](size_t, size_t){ return uniform(generator); };
+    VNVectors::VNVectors<double> a(dimensions, size, random);
+    VNVectors::VNVectors<double> b(dimensions, size, random);
+    NVector::NVector<double> r(dimensions, [&](size_t){
+        return uniform(generator);
+    });
+
+    // Scalars.
+    check(a + 2.0, [&](size_t i, size_t j){ return a[i][j] + 2.0; });
+    check(2.0 - a, [&](size_t i, size_t j){ return 2.0 - a[i][j]; });
+    check(a * 3.0, [&](size_t i, size_t j){ return a[i][j] * 3.0; });
+    check(a / 3.0, [&](size_t i, size_t j){ return a[i][j] / 3.0; });
+
+    // NVectors, over the rows.
+    check(a + r, [&](size_t i, size_t j){ return a[i][j] + r[j]; });
+    check(r - a, [&](size_t i, size_t j){ return r[j] - a[i][j]; });
+    check(a * r, [&](size_t i, size_t j){ return a[i][j] * r[j]; });
+    check(a / r, [&](size_t i, size_t j){ return a[i][j] / r[j]; });
+
+    // Vectors of NVectors.
+    check(a - b, [&](size_t i, size_t j){ return a[i][j] - b[i][j]; });
+    check(a / b, [&](size_t i, size_t j){ return a[i][j] / b[i][j]; });
+
+    // In place.
+    VNVectors::VNVectors<double> w = a;
+    w /= b;
+    w *= b;
+    w += r;
+    w -= r;
+    assert(w.isClose(a, 1e-12, 1e-12));
+
+    // Divisions by zero, without writing any entry.
+    bool thrown = false;
+    VNVectors::VNVectors<double> zero = b;
+    zero[7][2] = 0;
+    try { w /= zero; }
+    catch(ExceptionsGeneral::DivisionByZero&) { thrown = true; }
+    assert(thrown && w.isClose(a, 1e-12, 1e-12));
+    thrown = false;
+    NVector::NVector<double> zeros(dimensions);
+    try { w /= zeros; }
+    catch(ExceptionsGeneral::DivisionByZero&) { thrown = true; }
+    assert(thrown && w.isClose(a, 1e-12, 1e-12));
+
+    // Vectors of NVectors of another size.
+    thrown = false;
+    VNVectors::VNVectors<double> small(dimensions, 3);
+    try { w += small; }
+    catch(ExceptionsGeneral::Dimensions&) { thrown = true; }
+    assert(thrown);
+}
+
+
+/**
+ * Checks the element-wise operators of the NVectors, and that they drop the
+ * cached norm.
+*/
+void testVector()
+{
+    // Auxiliary variables.
+    NVector::NVector<double> p(3, 2.0), q(3, 4.0);
+
+    // Operators.
+    assert((p * q)[1] == 8 && (q / p)[0] == 2);
+    assert((p + q)[2] == 6 && (q - p)[0] == 2);
+    assert((1.0 - p)[0] == -1 && (p / 2.0)[0] == 1);
+
+    // In place, with the cached norm.
+    p.cacheNorm(true);
+    assert(p.normSquared() == 12);
+    p += 1.0;
+    assert(p.normSquared() == 27);
+    p *= q;
+    assert(p.normSquared() == 432);
+
+    // Divisions by zero.
+    bool thrown = false;
+    try { p /= NVector::NVector<double>(3); }
+    catch(ExceptionsGeneral::DivisionByZero&) { thrown = true; }
+    assert(thrown && p.normSquared() == 432);
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testBroadcasts(false);
+    testBroadcasts(true);
+    testOperators();
+    testVector();
+
+    std::cout << "Broadcasting tests passed." << std::endl;
+
+    return 0;
+}
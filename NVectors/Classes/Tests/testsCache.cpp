@@ -0,0 +1,130 @@
+/*
+    File that contains the tests of the cached norm of the NVectors, that must
+    be dropped by every operation that can write the entries, and kept by the
+    ones that only read them.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+
+// User defined.
+#include "../nvectors.hpp"
+#include "../views.hpp"
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks that the cached norm follows the writes through the index operator,
+ * the pointers, the setters and the views.
+*/
+void testAccesses()
+{
+    // Auxiliary variables.
+    NVector::NVector<double> a(3, 1.0);
+    const NVector::NVector<double>& constant = a;
+    a.cacheNorm(true);
+    assert(a.isNormCached() && a.normSquared() == 3);
+
+    // The reads keep the norm.
+    assert(constant[0] == 1 && constant.data()[1] == 1);
+    assert(a.normSquared() == 3 && a.dotProduct(a) == a.normSquared());
+
+    // Index operator, pointers and setters.
+    a[0] = 2;
+    assert(a.normSquared() == 6);
+    a.data()[1] = 0;
+    assert(a.normSquared() == 5);
+    assert(a.trySet(2, 3.0) == ExceptionsResults::Error::None);
+    assert(a.normSquared() == 13);
+
+    // Retained pointers need the explicit invalidation.
+    double* entries = a.data();
+    a.normSquared();
+    entries[1] = 4;
+    a.invalidateNorm();
+    assert(a.normSquared() == 29);
+
+    // Views of the NVector.
+    Views::NVectorView<double> view(a, Views::Slice(0, 3, 2));
+    view *= 2.0;
+    assert(a.normSquared() == 16 + 16 + 36);
+
+    // Disabled.
+    a.cacheNorm(false);
+    assert(!a.isNormCached());
+    a[0] = 0;
+    assert(a.normSquared() == 16 + 36);
+}
+
+
+/**
+ * Checks that the cached norm follows the in place operations and the
+ * operations whose output is the NVector itself.
+*/
+void testOperations()
+{
+    // Auxiliary variables.
+    NVector::NVector<double> a(3, 2.0), b(3, 4.0);
+    const NVector::NVector<double>& constant = a;
+    a.cacheNorm(true);
+    assert(a.normSquared() == 12);
+
+    // Arithmetic.
+    a += 1.0;
+    assert(a.normSquared() == 27);
+    a *= b;
+    assert(a.normSquared() == 432);
+    a -= b;
+    assert(a.normSquared() == 192);
+
+    // Normalization.
+    a.normalizeIP();
+    assert(std::fabs(a.normSquared() - 1) < 1e-12);
+    a[0] = 0;
+    assert(a.tryNormalizeIP() == ExceptionsResults::Error::None);
+    assert(std::fabs(a.normSquared() - 1) < 1e-12 && a[0] == 0);
+
+    // Output to the NVector itself.
+    b[0] = 1;
+    a.normSquared();
+    a.crossProduct(b, a);
+    double expected = 0;
+    for(size_t i = 0; i < 3; ++i) expected += constant[i] * constant[i];
+    assert(std::fabs(a.normSquared() - expected) < 1e-12);
+
+    // The copies keep the cache, with the norm of their own entries.
+    NVector::NVector<double> c = a * 2.0;
+    NVector::NVector<double> d = a;
+    d[1] = 10;
+    assert(std::fabs(c.normSquared() - 4 * a.normSquared()) < 1e-12);
+    assert(d.isNormCached() && d.normSquared() > a.normSquared());
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testAccesses();
+    testOperations();
+
+    std::cout << "Cache tests passed." << std::endl;
+
+    return 0;
+}
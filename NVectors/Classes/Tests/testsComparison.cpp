@@ -0,0 +1,148 @@
+/*
+    File that contains the tests of the exact and tolerance comparisons, of the
+    hashes and of the deduplication of the NVectors and vectors of NVectors.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+
+// User defined.
+#include "../nvectors.hpp"
+#include "../vnvectors.hpp"
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks that the moved from NVectors and vectors of NVectors are left empty,
+ * and that the moved to ones keep the entries and the cached norm.
+*/
+void testMoves()
+{
+    // Auxiliary variables.
+    NVector::NVector<double> a(4, 1.0);
+    NVector::NVector<double> c(2, 3.0);
+    VNVectors::VNVectors<double> v(3, 5);
+    VNVectors::VNVectors<double> x(2, 2);
+
+    // Construction.
+    a.cacheNorm(true);
+    assert(a.norm() == 2);
+    NVector::NVector<double> b(std::move(a));
+    assert(a.size() == 0 && b.size() == 4 && b.norm() == 2);
+    VNVectors::VNVectors<double> w(std::move(v));
+    assert(v.size() == 0 && v.dimensions() == 0 && w.size() == 5);
+
+    // Assignment, also onto itself.
+    c = std::move(b);
+    assert(b.size() == 0 && c.size() == 4 && c[3] == 1);
+    NVector::NVector<double>& self = c;
+    c = std::move(self);
+    assert(c.size() == 4);
+    x = std::move(w);
+    assert(w.size() == 0 && x.size() == 5 && x.dimensions() == 3);
+
+    // The moved from vectors can be assigned again.
+    a = c;
+    assert(a.size() == 4 && a[0] == 1);
+}
+
+
+/**
+ * Checks the exact, tolerance and ULP comparisons of the NVectors, and that
+ * the equal NVectors have equal hashes.
+*/
+void testNVectors()
+{
+    // Auxiliary variables.
+    NVector::NVector<double> a(100, [](size_t i){ return i * 0.5; });
+    NVector::NVector<double> b = a;
+    NVector::NVector<float> f(3);
+    NVector::NVector<float> g(3);
+    std::unordered_map<NVector::NVector<double>, int> map;
+
+    // Both zeros are equal and hash equal.
+    a[3] = 0.0;
+    b[3] = -0.0;
+    assert(a == b && a.hash() == b.hash());
+
+    // Tolerances.
+    b[50] += 1e-12;
+    assert(!(a == b));
+    assert(a.isClose(b, 1e-9, 0) && !a.isClose(b, 0, 0));
+    assert(a.isClose(b, 0, 1e-12));
+    b[50] = std::nextafter(a[50], 1e9);
+    assert(a.isCloseULP(b, 1) && !a.isCloseULP(b, 0));
+    assert(!a.isClose(NVector::NVector<double>(99), 1, 1));
+
+    // Units in the last place across zero, and NaN is never close.
+    f[0] = -0.0f;
+    g[0] = 0.0f;
+    f[1] = -1e-45f;
+    g[1] = 1e-45f;
+    assert(f.isCloseULP(g, 2) && !f.isCloseULP(g, 1));
+    f[2] = NAN;
+    g[2] = NAN;
+    assert(!f.isCloseULP(g, 100) && !f.isClose(g, 1, 1));
+
+    // Hash maps.
+    map[a] = 1;
+    map[b] = 2;
+    assert(map.size() == 2);
+}
+
+
+/**
+ * Checks the comparisons, the hashes and the deduplication of the vectors of
+ * NVectors.
+*/
+void testVNVectors()
+{
+    // Auxiliary variables.
+    VNVectors::VNVectors<double> v(3, 6, [](size_t i, size_t j){
+        return (double) ((i % 3) * 10 + j);
+    });
+    VNVectors::VNVectors<double> w = v;
+
+    // Equal copies.
+    assert(w == v && w.hash() == v.hash());
+    assert(w.isClose(v, 0, 0) && w.isCloseULP(v, 0));
+
+    // Deduplication keeps the first of each NVector, in order.
+    assert((v.uniqueIndexes() == std::vector<size_t>{0, 1, 2}));
+    w.deduplicateIP();
+    assert(w.size() == 3 && w[2][0] == 20);
+    assert(!(w == v) && !w.isClose(v, 1, 1));
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testMoves();
+    testNVectors();
+    testVNVectors();
+
+    std::cout << "Comparison tests passed." << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,112 @@
+/*
+    File that contains the tests of the compensated reductions: the error free
+    transformations, the compensated sums and dot products, and the
+    compensated precision of the NVectors.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+
+// User defined.
+#include "../Headers/Math/mathCompensated.hpp"
+#include "../nvectors.hpp"
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks that the rounding errors of the sums and products are exact, also
+ * for the factors whose splitting would overflow.
+*/
+void testErrorFree()
+{
+    // Auxiliary variables.
+    double sum, product, error;
+    double big = std::numeric_limits<double>::max() / 3;
+    double third = 1.0 / 3;
+
+    // Sums.
+    MathCompensated::twoSum(1.0, 1e-20, sum, error);
+    assert(sum == 1 && error == 1e-20);
+
+    // Products, against the fused multiply-add.
+    MathCompensated::twoProduct(third, 3.0, product, error);
+    assert(product == 1 && error == std::fma(third, 3.0, -product));
+    MathCompensated::twoProduct(big, 1.5 + 1e-15, product, error);
+    assert(std::isfinite(error));
+    assert(error == std::fma(big, 1.5 + 1e-15, -product));
+    MathCompensated::twoProduct(1e-3, big, product, error);
+    assert(error == std::fma(1e-3, big, -product));
+
+    // Splittings.
+    double high, low;
+    MathCompensated::split(big, high, low);
+    assert(high + low == big && std::isfinite(high));
+}
+
+
+/**
+ * Checks that the compensated sums and dot products are exact for the ill
+ * conditioned data, where the standard ones lose all the digits.
+*/
+void testReductions()
+{
+    // Auxiliary variables.
+    std::vector<double> entries;
+    std::vector<double> ones;
+    for(size_t i = 0; i < 1000; ++i)
+    {
+        entries.push_back(1e16);
+        entries.push_back(1.0);
+        entries.push_back(-1e16);
+        ones.insert(ones.end(), {1.0, 1.0, 1.0});
+    }
+
+    // Sums and dot products.
+    double sum = MathCompensated::sum2<double, double>(
+        entries.data(), entries.size()
+    );
+    double dot = MathCompensated::dot2<double, double>(
+        entries.data(), ones.data(), entries.size()
+    );
+    assert(sum == 1000 && dot == 1000);
+
+    // The NVectors with the compensated precision.
+    NVector::NVector<double> a(entries.size(), [&](size_t i){
+        return entries[i];
+    });
+    NVector::NVector<double> b(ones.size(), 1.0);
+    assert(a.dotProduct(b, NVector::Precision::Compensated) == 1000);
+    a.setPrecision(NVector::Precision::Compensated);
+    assert(a.dotProduct(b) == 1000);
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testErrorFree();
+    testReductions();
+
+    std::cout << "Compensated tests passed." << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,217 @@
+/*
+    File that contains the tests of the streaming covariance, against a two
+    pass computation in extended precision, and of the principal components.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+
+// User defined.
+#include "../covariance.hpp"
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks the mean and the covariance of data with a large offset, added in
+ * blocks, one NVector at a time and merged from two halves.
+*/
+void testCovariance()
+{
+    // Auxiliary variables.
+    size_t size = 20000;
+    size_t dimensions = 6;
+    double mixing[6][6];
+    long double mean[6] = {0};
+    long double reference[6][6] = {{0}};
+    std::mt19937 generator(5);
+    std::normal_distribution<double> normal(0, 1);
+    VNVectors::VNVectors<float> x(dimensions, size);
+
+    // Correlated data, x = 1000 + A z, with z standard normal.
+    for(auto& row : mixing) for(double& entry : row) entry = normal(generator);
+    for(size_t i = 0; i < size; ++i)
+    {
+        double z[6];
+        for(double& entry : z) entry = normal(generator);
+        for(size_t j = 0; j < dimensions; ++j)
+        {
+            double sum = 1000;
+            for(size_t l = 0; l < dimensions; ++l) sum += mixing[j][l] * z[l];
+            x[i][j] = (float) sum;
+        }
+    }
+
+    // Two pass reference.
+    for(size_t i = 0; i < size; ++i)
+    {
+        for(size_t j = 0; j < dimensions; ++j) mean[j] += x[i][j];
+    }
+    for(long double& entry : mean) entry /= size;
+    for(size_t i = 0; i < size; ++i)
+    {
+        for(size_t a = 0; a < dimensions; ++a)
+        {
+            for(size_t b = 0; b < dimensions; ++b)
+            {
+                reference[a][b] += (x[i][a] - mean[a]) * (x[i][b] - mean[b]);
+            }
+        }
+    }
+
+    // Blocks, in parallel and serially.
+    for(bool parallel : {false, true})
+    {
+        Covariance::Covariance<float> blocks(dimensions);
+        blocks.add(x, parallel);
+        NVector::NVector<float> m = blocks.mean();
+        VNVectors::VNVectors<float> c = blocks.covariance(true);
+        for(size_t a = 0; a < dimensions; ++a)
+        {
+            double scale = (double) reference[a][a] / (size - 1);
+            assert(std::fabs(m[a] - (double) mean[a]) < 1e-3);
+            for(size_t b = 0; b < dimensions; ++b)
+            {
+                double expected = (double) reference[a][b] / (size - 1);
+                assert(std::fabs(c[a][b] - expected) < 1e-4 * scale);
+            }
+        }
+    }
+
+    // One by one, and merged halves.
+    Covariance::Covariance<float> single(dimensions);
+    Covariance::Covariance<float> first(dimensions);
+    Covariance::Covariance<float> second(dimensions);
+    VNVectors::VNVectors<float> firstHalf(
+        dimensions, size / 2, [&](size_t i, size_t j){ return x[i][j]; }
+    );
+    VNVectors::VNVectors<float> secondHalf(
+        dimensions, size / 2,
+        [&](size_t i, size_t j){ return x[size / 2 + i][j]; }
+    );
+    for(size_t i = 0; i < size; ++i) single.add(x[i]);
+    first.add(firstHalf, false);
+    second.add(secondHalf, true);
+    first.merge(second);
+    assert(single.count() == size && first.count() == size);
+    VNVectors::VNVectors<float> c1 = single.covariance(false);
+    VNVectors::VNVectors<float> c2 = first.covariance(false);
+    for(size_t a = 0; a < dimensions; ++a)
+    {
+        double scale = (double) reference[a][a] / size;
+        for(size_t b = 0; b < dimensions; ++b)
+        {
+            double expected = (double) reference[a][b] / size;
+            assert(std::fabs(c1[a][b] - expected) < 1e-4 * scale);
+            assert(std::fabs(c2[a][b] - expected) < 1e-4 * scale);
+        }
+    }
+
+    // Too few NVectors for the sample covariance.
+    bool thrown = false;
+    try { Covariance::Covariance<double>(3).covariance(true); }
+    catch(std::exception&) { thrown = true; }
+    assert(thrown);
+}
+
+
+/**
+ * Checks that the principal components solve the eigen-equation of the
+ * covariance, with the Jacobi and the subspace iteration paths, and the
+ * round trip of the transforms.
+ * 
+ * @param dimensions The number of dimensions of the NVectors.
+ * 
+ * @param size The number of NVectors.
+*/
+void testPCA(size_t dimensions, size_t size)
+{
+    // Auxiliary variables.
+    size_t components = 3;
+    bool thrown = false;
+    std::mt19937 generator(7);
+    std::normal_distribution<double> normal(0, 1);
+    VNVectors::VNVectors<double> x(dimensions, size, [&](size_t, size_t j){
+        return normal(generator) * (j < 5 ? 10.0 - j : 0.5) + 100;
+    });
+    Covariance::Covariance<double> accumulator(dimensions);
+    accumulator.add(x, true);
+    VNVectors::VNVectors<double> c = accumulator.covariance(true);
+    Covariance::PCA<double> pca(accumulator, components, true);
+    VNVectors::VNVectors<double> w = pca.components();
+    NVector::NVector<double> variances = pca.variances();
+
+    // Eigen-equation, with sorted eigenvalues.
+    for(size_t k = 0; k < components; ++k)
+    {
+        assert(std::fabs(w[k].norm() - 1) < 1e-12);
+        for(size_t a = 0; a < dimensions; ++a)
+        {
+            double sum = 0;
+            for(size_t b = 0; b < dimensions; ++b) sum += c[a][b] * w[k][b];
+            assert(
+                std::fabs(sum - variances[k] * w[k][a]) < 1e-8 * variances[0]
+            );
+        }
+    }
+    assert(variances[0] >= variances[1] && variances[1] >= variances[2]);
+
+    // The variance of the scores is the eigenvalue.
+    VNVectors::VNVectors<double> scores(components, size);
+    pca.transform(x, scores, true);
+    double variance = 0;
+    for(size_t i = 0; i < size; ++i) variance += scores[i][0] * scores[i][0];
+    assert(std::fabs(variance / (size - 1) / variances[0] - 1) < 1e-9);
+
+    // All the components reconstruct the NVectors.
+    if(dimensions <= 32)
+    {
+        Covariance::PCA<double> full(accumulator, dimensions, false);
+        VNVectors::VNVectors<double> all(dimensions, size);
+        VNVectors::VNVectors<double> back(dimensions, size);
+        full.transform(x, all, false);
+        full.inverseTransform(all, back, false);
+        for(size_t i = 0; i < size; ++i)
+        {
+            for(size_t j = 0; j < dimensions; ++j)
+            {
+                assert(std::fabs(back[i][j] - x[i][j]) < 1e-9);
+            }
+        }
+    }
+
+    // More components than dimensions.
+    try { Covariance::PCA<double>(accumulator, dimensions + 1, true); }
+    catch(std::exception&) { thrown = true; }
+    assert(thrown);
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testCovariance();
+    testPCA(6, 20000);
+    testPCA(200, 3000);
+
+    std::cout << "Covariance tests passed." << std::endl;
+
+    return 0;
+}
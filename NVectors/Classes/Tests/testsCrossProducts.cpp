@@ -0,0 +1,106 @@
+/*
+    File that contains the tests of the cross products of the NVectors and of
+    the batched cross products of the vectors of three dimensional NVectors.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+
+// User defined.
+#include "../vnvectors.hpp"
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks that the batched cross products agree with the ones of each of the
+ * NVectors, with pairs of NVectors, with a single NVector and in place.
+*/
+void testBatched()
+{
+    // Auxiliary variables.
+    size_t size = 200;
+    VNVectors::VNVectors<double> a(3, size, [](size_t i, size_t j){
+        return (double) i * 0.1 + (double) j;
+    });
+    VNVectors::VNVectors<double> b(3, size, [](size_t i, size_t j){
+        return std::sin((double) (i + j));
+    });
+    VNVectors::VNVectors<double> c(3, size);
+    NVector::NVector<double> v(3, 2.0);
+    v[1] = -1;
+
+    // Pairs of NVectors.
+    a.crossProduct(b, c);
+    for(size_t i = 0; i < size; ++i)
+    {
+        NVector::NVector<double> r = a[i].crossProduct(b[i]);
+        for(size_t k = 0; k < 3; ++k) assert(r[k] == c[i][k]);
+    }
+
+    // A single NVector.
+    VNVectors::VNVectors<double> d = a.crossProduct(v);
+    for(size_t i = 0; i < size; ++i)
+    {
+        NVector::NVector<double> r = a[i].crossProduct(v);
+        for(size_t k = 0; k < 3; ++k) assert(r[k] == d[i][k]);
+    }
+
+    // The output can be one of the operands.
+    a.crossProduct(b, a);
+    assert(a == c);
+}
+
+
+/**
+ * Checks the known cross products of the NVectors, and that the NVectors
+ * that are not three dimensional are rejected.
+*/
+void testVector()
+{
+    // Auxiliary variables.
+    NVector::NVector<double> x(3, 0.0), y(3, 0.0), z(3);
+    x[0] = 1;
+    y[1] = 1;
+
+    // Right handed basis, and parallel NVectors.
+    x.crossProduct(y, z);
+    assert(z[0] == 0 && z[1] == 0 && z[2] == 1);
+    x.crossProduct(x, z);
+    assert(z[0] == 0 && z[1] == 0 && z[2] == 0);
+
+    // Dimensions.
+    bool thrown = false;
+    VNVectors::VNVectors<double> four(4, 10);
+    VNVectors::VNVectors<double> three(3, 10);
+    try { four.crossProduct(three, three); } catch(...) { thrown = true; }
+    assert(thrown);
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testBatched();
+    testVector();
+
+    std::cout << "Cross products tests passed." << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,172 @@
+/*
+    File that contains the tests of the tiled distance matrices, against the
+    distances computed one pair at a time.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+
+// User defined.
+#include "../distances.hpp"
+
+
+//##############################################################################
+// Auxiliary Functions
+//##############################################################################
+
+
+/**
+ * Returns the euclidean distance between the given NVectors, one dimension
+ * at a time.
+ * 
+ * @param a The first NVector.
+ * 
+ * @param b The second NVector.
+ * 
+ * @return The euclidean distance between the NVectors.
+*/
+double distance(
+    const NVector::NVector<double>& a, const NVector::NVector<double>& b
+)
+{
+    // Auxiliary variables.
+    double sum = 0;
+
+    for(size_t k = 0; k < a.size(); ++k)
+    {
+        sum += (a[k] - b[k]) * (a[k] - b[k]);
+    }
+
+    return std::sqrt(sum);
+}
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks the square, condensed and rectangular distance matrices.
+ * 
+ * @param parallel If the matrices must be computed in parallel.
+*/
+void testMatrices(bool parallel)
+{
+    // Auxiliary variables.
+    size_t t = 0;
+    VNVectors::VNVectors<double> a(300, 150, [](size_t i, size_t j){
+        return std::sin(0.37 * i + 1.3 * j);
+    });
+    VNVectors::VNVectors<double> b(300, 70, [](size_t i, size_t j){
+        return std::cos(0.11 * i * j + j);
+    });
+
+    // Square.
+    VNVectors::VNVectors<double> square = Distances::distanceMatrix(
+        a, false, parallel
+    );
+    assert(square.size() == 150 && square.dimensions() == 150);
+    for(size_t i = 0; i < 150; ++i)
+    {
+        assert(square[i][i] == 0);
+        for(size_t j = 0; j < 150; ++j)
+        {
+            assert(std::fabs(square[i][j] - distance(a[i], a[j])) < 1e-9);
+            assert(square[i][j] == square[j][i]);
+        }
+    }
+
+    // Condensed, squared.
+    NVector::NVector<double> condensed = Distances::condensedDistanceMatrix(
+        a, true, parallel
+    );
+    assert(condensed.size() == 150 * 149 / 2);
+    for(size_t i = 0; i < 150; ++i)
+    {
+        for(size_t j = i + 1; j < 150; ++j, ++t)
+        {
+            double expected = square[i][j] * square[i][j];
+            assert(std::fabs(condensed[t] - expected) < 1e-9);
+        }
+    }
+
+    // Rectangular.
+    VNVectors::VNVectors<double> rectangular = Distances::distanceMatrix(
+        a, b, false, parallel
+    );
+    assert(rectangular.size() == 150 && rectangular.dimensions() == 70);
+    for(size_t i = 0; i < 150; ++i)
+    {
+        for(size_t j = 0; j < 70; ++j)
+        {
+            assert(std::fabs(rectangular[i][j] - distance(a[i], b[j])) < 1e-9);
+        }
+    }
+}
+
+
+/**
+ * Checks that the tiles cover the upper triangle once, that the equal
+ * NVectors are at distance zero and that mismatched dimensions throw.
+*/
+void testTiles()
+{
+    // Auxiliary variables.
+    bool thrown = false;
+    std::atomic<size_t> count{0};
+    VNVectors::VNVectors<float> f(3, 200, [](size_t i, size_t j){
+        return (float) ((i / 2) + j);
+    });
+    VNVectors::VNVectors<double> a(300, 2);
+    VNVectors::VNVectors<double> b(3, 2);
+
+    // Equal pairs.
+    VNVectors::VNVectors<float> square = Distances::distanceMatrix(
+        f, false, true
+    );
+    assert(square[0][1] == 0 && square[2][3] == 0);
+
+    // Tiles of the upper triangle, including the diagonal tiles whole.
+    Distances::forEachTile(
+        f, true, true,
+        [&](size_t i0, size_t j0, size_t rows, size_t columns, const float*)
+        {
+            assert(i0 <= j0);
+            count += rows * columns;
+        }
+    );
+    assert(count == 26176);
+
+    // Dimensions mismatch.
+    try { Distances::distanceMatrix(a, b, true, false); }
+    catch(std::exception&) { thrown = true; }
+    assert(thrown);
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testMatrices(false);
+    testMatrices(true);
+    testTiles();
+
+    std::cout << "Distances tests passed." << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,154 @@
+/*
+    File that contains the tests of the growth of the vectors of NVectors, and
+    of the constructors of the NVectors and of the vectors of NVectors from
+    ranges, generators and uninitialized entries.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+
+// User defined.
+#include "../vnvectors.hpp"
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks the appends of vectors of NVectors, also to themselves, and of
+ * ranges of values.
+*/
+void testAppend()
+{
+    // Auxiliary variables.
+    VNVectors::VNVectors<double> v(3, 100, [](size_t i, size_t){
+        return (double) i;
+    });
+    std::vector<double> flat{1, 2, 3, 4, 5, 6};
+
+    // Self appending.
+    v.append(v);
+    assert(v.size() == 200 && v[150][0] == 50 && v[50][0] == 50);
+
+    // Ranges of values.
+    v.append(flat.begin(), flat.end());
+    assert(v.size() == 202 && v[200][0] == 1 && v[201][0] == 4);
+
+    // The number of values must be a multiple of the dimension.
+    bool thrown = false;
+    try { v.append(flat.begin(), flat.begin() + 4); }
+    catch(ExceptionsGeneral::Dimensions&) { thrown = true; }
+    assert(thrown && v.size() == 202);
+
+    // Vectors of NVectors of another dimension.
+    thrown = false;
+    VNVectors::VNVectors<double> other(2, 5);
+    try { v.append(other); }
+    catch(ExceptionsGeneral::Dimensions&) { thrown = true; }
+    assert(thrown && v.size() == 202);
+}
+
+
+/**
+ * Checks the constructors of the NVectors and of the vectors of NVectors
+ * from the ranges, the generators and the uninitialized entries.
+*/
+void testConstructors()
+{
+    // Auxiliary variables.
+    std::vector<double> flat{1, 2, 3, 4, 5, 6};
+
+    // NVectors.
+    NVector::NVector<double> generated(5, [](size_t i){ return i * 2.0; });
+    NVector::NVector<double> ranged(flat.begin(), flat.end());
+    NVector::NVector<double> uninitialized(4, NVector::uninitialized);
+    assert(generated[4] == 8);
+    assert(ranged.size() == 6 && ranged[5] == 6);
+    assert(uninitialized.size() == 4);
+
+    // Vectors of NVectors.
+    VNVectors::VNVectors<double> rows(3, flat.begin(), flat.end());
+    VNVectors::VNVectors<double> grid(2, 4, [](size_t i, size_t j){
+        return (double) (10 * i + j);
+    });
+    VNVectors::VNVectors<double> empty(3, 10, NVector::uninitialized);
+    assert(rows.size() == 2 && rows[1][2] == 6);
+    assert(grid.size() == 4 && grid[3][1] == 31);
+    assert(empty.size() == 10 && empty.dimensions() == 3);
+
+    // The number of values must be a multiple of the dimension.
+    bool thrown = false;
+    try { VNVectors::VNVectors<double> bad(4, flat.begin(), flat.end()); }
+    catch(ExceptionsGeneral::Dimensions&) { thrown = true; }
+    assert(thrown);
+}
+
+
+/**
+ * Checks that appending one NVector at a time grows the capacity
+ * geometrically, and that the appended NVectors keep their entries.
+*/
+void testGrowth()
+{
+    // Auxiliary variables.
+    VNVectors::VNVectors<double> v(3);
+    size_t size = 100000;
+    size_t reallocations = 0;
+
+    // Empty.
+    assert(v.size() == 0);
+    bool thrown = false;
+    try { v[0]; } catch(ExceptionsGeneral::IndexOutOfRange&) { thrown = true; }
+    assert(thrown);
+
+    // Amortized constant time appends.
+    for(size_t i = 0; i < size; ++i)
+    {
+        size_t capacity = v.capacity();
+        v.emplace_back(3, (double) i);
+        if(v.capacity() != capacity) ++reallocations;
+    }
+    assert(v.size() == size && v[size - 1][2] == size - 1);
+    assert(reallocations < 40);
+
+    // Reservation.
+    VNVectors::VNVectors<double> w(3);
+    w.reserve(1000);
+    assert(w.capacity() >= 1000 && w.size() == 0 && w.dimensions() == 3);
+    w.push_back(NVector::NVector<double>(3, 1.0));
+    assert(w.size() == 1 && w.capacity() >= 1000);
+
+    // The NVectors of another dimension are rejected, without appending.
+    thrown = false;
+    try { v.emplace_back(4, 1.0); }
+    catch(ExceptionsGeneral::Dimensions&) { thrown = true; }
+    assert(thrown && v.size() == size);
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testAppend();
+    testConstructors();
+    testGrowth();
+
+    std::cout << "Growth tests passed." << std::endl;
+
+    return 0;
+}
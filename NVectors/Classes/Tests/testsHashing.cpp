@@ -0,0 +1,107 @@
+/*
+    File that contains the tests of the hashes of the raw storage of the
+    vectors and of the CRC-32 checksums, against the known answers of the IEEE
+    polynomial.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+
+
+// User defined.
+#include "../Headers/Hashing/hashingGeneral.hpp"
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks the CRC-32 checksums against the known answers, and that the
+ * checksum of a buffer can be continued from the checksum of its start.
+*/
+void testCRC32()
+{
+    // Auxiliary variables.
+    const uint8_t* digits = (const uint8_t*) "123456789";
+    const uint8_t* fox = (const uint8_t*)
+        "The quick brown fox jumps over the lazy dog";
+
+    // Known answers.
+    assert(HashingGeneral::crc32(digits, 0, 0) == 0u);
+    assert(HashingGeneral::crc32(digits, 9, 0) == 0xcbf43926u);
+    assert(HashingGeneral::crc32(fox, 43, 0) == 0x414fa339u);
+
+    // Chained checksums, split at every position.
+    for(size_t i = 0; i <= 43; ++i)
+    {
+        uint32_t start = HashingGeneral::crc32(fox, i, 0);
+        assert(HashingGeneral::crc32(fox + i, 43 - i, start) == 0x414fa339u);
+    }
+}
+
+
+/**
+ * Checks that the hashes depend on the seed, on the order and on the number
+ * of the words, and that both zeros hash equal.
+*/
+void testHasher()
+{
+    // Auxiliary variables.
+    HashingGeneral::Hasher first(0);
+    HashingGeneral::Hasher second(0);
+    HashingGeneral::Hasher seeded(1);
+    HashingGeneral::Hasher longer(0);
+
+    // Same words, in the same order, with the same seed.
+    for(uint64_t word = 0; word < 10; ++word)
+    {
+        first.add(word);
+        second.add(word);
+        seeded.add(word);
+        longer.add(word);
+    }
+    longer.add(0);
+    assert(first.digest() == second.digest());
+    assert(first.digest() != seeded.digest());
+    assert(first.digest() != longer.digest());
+
+    // Swapped words.
+    HashingGeneral::Hasher swapped(0);
+    swapped.add(1);
+    swapped.add(0);
+    for(uint64_t word = 2; word < 10; ++word) swapped.add(word);
+    assert(first.digest() != swapped.digest());
+
+    // Both zeros.
+    HashingGeneral::Hasher positive(0);
+    HashingGeneral::Hasher negative(0);
+    positive.addValue(0.0);
+    negative.addValue(-0.0);
+    assert(positive.digest() == negative.digest());
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testCRC32();
+    testHasher();
+
+    std::cout << "Hashing tests passed." << std::endl;
+
+    return 0;
+}
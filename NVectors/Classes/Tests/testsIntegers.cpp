@@ -0,0 +1,180 @@
+/*
+    File that contains the tests of the NVectors with integer and fixed point
+    entries: the exact accumulation, the overflow checks and the saturating
+    and checked element-wise operations.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+
+
+// User defined.
+#include "../nvectors.hpp"
+#include "../ufuncs.hpp"
+#include "../views.hpp"
+
+
+//##############################################################################
+// Auxiliary Functions
+//##############################################################################
+
+
+/**
+ * Returns true if the given function throws an overflow exception.
+ * 
+ * @param function The function to call.
+ * 
+ * @return True if the function throws an overflow exception.
+*/
+template <typename F>
+bool overflows(F function)
+{
+    try
+    {
+        function();
+    }
+    catch(ExceptionsNumerical::Overflow&)
+    {
+        return true;
+    }
+
+    return false;
+}
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks that the dot products are exact while they fit the accumulation
+ * type, and that they throw, or return the error, when they do not.
+*/
+void testAccumulation()
+{
+    // Auxiliary variables.
+    int64_t exact = 0;
+    NVector::NVector<int32_t> a(1000, [](size_t i){
+        return (int32_t) i * 1000;
+    });
+    NVector::NVector<int32_t> b(1000, (int32_t) 70000);
+    NVector::NVector<int32_t> largest(4, INT32_MAX);
+    NVector::NVector<int32_t> fits(2, INT32_MAX);
+    NVector::NVector<int64_t> wide(2, (int64_t) 1 << 40);
+    NVector::NVector<uint32_t> unsignedLargest(5, UINT32_MAX);
+
+    // Exact dot product in the wider accumulation type.
+    for(size_t i = 0; i < 1000; ++i)
+    {
+        exact += (int64_t) i * 1000 * 70000;
+    }
+    assert(a.dotProduct(b) == exact);
+    assert(fits.normSquared() == 2 * ((int64_t) INT32_MAX * INT32_MAX));
+
+    // Overflows of the accumulation type.
+    assert(overflows([&](){ largest.normSquared(); }));
+    assert(overflows([&](){ wide.dotProduct(wide); }));
+    assert(overflows([&](){ unsignedLargest.normSquared(); }));
+    assert(
+        largest.tryDotProduct(largest).code() ==
+        ExceptionsResults::Error::Overflow
+    );
+
+    // Fixed point products are rounded once, after the sum.
+    typedef TypesInteger::Fixed<int16_t, 15> Q15;
+    NVector::NVector<Q15> q(64, Q15(0.125));
+    assert((double) q.dotProduct(q) == 1.0);
+    NVector::NVector<Q15> r(3, [](size_t i){
+        return Q15::fromRaw((int16_t) (i + 1));
+    });
+    assert(r.dotProduct(NVector::NVector<Q15>(3, Q15(0.5))).raw() == 3);
+}
+
+
+/**
+ * Checks the saturating and checked element-wise operations, and the
+ * integer division by zero.
+*/
+void testOperations()
+{
+    // Auxiliary variables.
+    bool thrown = false;
+    NVector::NVector<int32_t> a(1000, [](size_t i){
+        return (int32_t) (i * 100000);
+    });
+    NVector::NVector<int32_t> b(1000, (int32_t) 70000);
+    NVector::NVector<int32_t> c = b;
+    NVector::NVector<int32_t> out(1000);
+    NVector::NVector<uint8_t> u(4, (uint8_t) 200);
+    NVector::NVector<uint8_t> v(4, (uint8_t) 100);
+
+    // Saturating.
+    UFuncs::multiplySaturate(a, b, out);
+    assert(out[0] == 0 && out[999] == INT32_MAX);
+    UFuncs::addSaturateIP(u, v);
+    assert(u[0] == 255);
+    UFuncs::subtractSaturateIP(v, u);
+    assert(v[0] == 0);
+
+    // Checked, the vector is unchanged when an entry overflows.
+    assert(overflows([&](){ UFuncs::multiplyCheckedIP(c, a); }));
+    assert(c[999] == 70000);
+    UFuncs::addCheckedIP(c, b);
+    assert(c[0] == 140000);
+
+    // Integer division by zero.
+    try { a / (int32_t) 0; }
+    catch(ExceptionsGeneral::DivisionByZero&) { thrown = true; }
+    assert(thrown);
+}
+
+
+/**
+ * Checks that the views of the integer NVectors accumulate like them: in the
+ * wider type by default, exactly, and throwing on overflow.
+*/
+void testViews()
+{
+    // Auxiliary variables.
+    NVector::NVector<int32_t> a(6, [](size_t i){
+        return (int32_t) (i % 2 == 0 ? 1 << 30 : 1);
+    });
+    NVector::NVector<int32_t> b(3, (int32_t) 1 << 30);
+    NVector::NVector<int64_t> wide(2, (int64_t) 1 << 40);
+    Views::NVectorView<int32_t> even(a, Views::Slice(0, 6, 2));
+    Views::NVectorView<int64_t> all(wide, Views::Slice(0, 2, 1));
+
+    // Exact in the wider type, with views and with NVectors.
+    int64_t expected = 3 * ((int64_t) 1 << 60);
+    assert(even.normSquared() == expected);
+    assert(even.dotProduct(b) == expected);
+
+    // Overflow of the widest accumulation.
+    assert(overflows([&](){ all.normSquared(); }));
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testAccumulation();
+    testOperations();
+    testViews();
+
+    std::cout << "Integers tests passed." << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,120 @@
+/*
+    File that contains the tests of the iterators of the NVectors and of the
+    vectors of NVectors, with the standard algorithms, and of the parallel
+    algorithms over the NVectors of the vectors of NVectors.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <iostream>
+#include <numeric>
+
+
+// User defined.
+#include "../vnvectors.hpp"
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks that the standard algorithms work with the iterators of the
+ * NVectors, that the writes through them drop the cached norm and that the
+ * reads keep it.
+*/
+void testIterators()
+{
+    // Auxiliary variables.
+    NVector::NVector<double> v(100, [](size_t i){ return (double) i; });
+    const NVector::NVector<double>& constant = v;
+
+    // Reads.
+    assert(std::accumulate(constant.begin(), constant.end(), 0.0) == 4950);
+    assert(std::reduce(constant.cbegin(), constant.cend()) == 4950);
+
+    // Writes, with the cached norm.
+    v.cacheNorm(true);
+    double squared = v.normSquared();
+    std::for_each(v.begin(), v.end(), [](double& x){ x *= 2; });
+    assert(v.normSquared() == 4 * squared);
+    std::sort(v.begin(), v.end(), std::greater<double>());
+    assert(v[0] == 198 && v[99] == 0);
+}
+
+
+/**
+ * Checks the row algorithms of the vectors of NVectors, that do not depend
+ * on the number of threads, and that the rows keep their dimension.
+ *
+ * @param parallel If the algorithms must run in parallel.
+*/
+void testRows(bool parallel)
+{
+    // Auxiliary variables.
+    VNVectors::VNVectors<double> v(3, 10000, [](size_t i, size_t j){
+        return (double) (i + j);
+    });
+    const VNVectors::VNVectors<double>& constant = v;
+    auto add = [](double a, double b){ return a + b; };
+    auto second = [](NVector::NVector<double>& r){ return r[1]; };
+
+    // The iterators only read the rows.
+    size_t count = (size_t) std::count_if(v.begin(), v.end(),
+        [](const NVector::NVector<double>& r){ return r[0] > 4999; }
+    );
+    assert(count == 5000 && constant.begin() + 10000 == constant.end());
+
+    // Each of the rows, and the reductions in the order of the rows.
+    v.forEach([](NVector::NVector<double>& r){ r[0] = -r[0]; }, parallel);
+    assert(v[7][0] == -7);
+    assert(
+        v.transformReduce(1.0, add, second, parallel) ==
+        1.0 + 10000.0 * 10001.0 / 2.0
+    );
+    assert(
+        v.transformReduce(0.5, add, second, parallel) ==
+        v.transformReduce(0.5, add, second, false)
+    );
+
+    // The rows can not change their dimension.
+    bool thrown = false;
+    try
+    {
+        v.forEach([](NVector::NVector<double>& r){
+            r = NVector::NVector<double>(4);
+        }, parallel);
+    }
+    catch(ExceptionsGeneral::Dimensions&) { thrown = true; }
+    assert(thrown);
+
+    // Empty.
+    VNVectors::VNVectors<double> empty(3);
+    assert(empty.transformReduce(2.5, add, second, parallel) == 2.5);
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testIterators();
+    testRows(false);
+    testRows(true);
+
+    std::cout << "Iterators tests passed." << std::endl;
+
+    return 0;
+}
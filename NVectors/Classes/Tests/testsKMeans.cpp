@@ -0,0 +1,137 @@
+/*
+    File that contains the tests of the k-means clustering, on separated and
+    overlapping clusters, with both algorithms and with mini-batches.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+
+// User defined.
+#include "../kmeans.hpp"
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks that both algorithms find separated clusters, in parallel and
+ * serially, with the inertia of the noise.
+*/
+void testSeparated()
+{
+    // Auxiliary variables.
+    size_t size = 20000;
+    size_t dimensions = 8;
+    size_t clusters = 5;
+    std::mt19937 generator(1);
+    std::normal_distribution<double> normal(0, 0.3);
+    VNVectors::VNVectors<double> x(dimensions, size, [&](size_t i, size_t j){
+        return (double) ((i % clusters) * 10 * ((j % 3) + 1)) +
+            normal(generator);
+    });
+
+    for(KMeans::Algorithm algorithm :
+        {KMeans::Algorithm::Lloyd, KMeans::Algorithm::Hamerly})
+    {
+        for(bool parallel : {false, true})
+        {
+            KMeans::KMeans<double> kmeans(clusters, 42);
+            kmeans.fit(x, algorithm, 100, 1e-9, parallel);
+
+            // Each cluster has a single label.
+            std::vector<size_t> labels = kmeans.labels();
+            for(size_t i = clusters; i < size; ++i)
+            {
+                assert(labels[i] == labels[i % clusters]);
+            }
+            assert(kmeans.predict(x, parallel) == labels);
+
+            // The inertia is the variance of the noise.
+            double expected = size * dimensions * 0.09;
+            assert(std::fabs(kmeans.inertia() / expected - 1) < 0.05);
+            assert(kmeans.centroids().size() == clusters);
+            assert(kmeans.centroids().dimensions() == dimensions);
+        }
+    }
+
+    // Mini-batches.
+    KMeans::KMeans<double> batches(clusters, 3);
+    for(size_t b = 0; b < 10; ++b)
+    {
+        VNVectors::VNVectors<double> batch(
+            dimensions, 1000,
+            [&](size_t i, size_t j){ return x[b * 1000 + i][j]; }
+        );
+        batches.partialFit(batch, false);
+    }
+    assert(batches.iterations() == 10);
+    std::vector<size_t> labels = batches.predict(x, true);
+    for(size_t i = clusters; i < size; ++i)
+    {
+        assert(labels[i] == labels[i % clusters]);
+    }
+}
+
+
+/**
+ * Checks that both algorithms converge to the same inertia on overlapping
+ * clusters, and the exceptions of the unfitted and of the too small inputs.
+*/
+void testOverlapping()
+{
+    // Auxiliary variables.
+    bool thrown = false;
+    std::mt19937 generator(2);
+    std::normal_distribution<float> normal(0, 3);
+    VNVectors::VNVectors<float> y(4, 20000, [&](size_t i, size_t j){
+        return normal(generator) + (float) ((i * 7 + j) % 5);
+    });
+    VNVectors::VNVectors<double> small(2, 5);
+    KMeans::KMeans<float> lloyd(20, 7);
+    KMeans::KMeans<float> hamerly(20, 7);
+    KMeans::KMeans<double> unfitted(3, 1);
+    KMeans::KMeans<double> many(30, 1);
+
+    // Hamerly's bounds only skip work, the result is the same.
+    lloyd.fit(y, KMeans::Algorithm::Lloyd, 300, 0.0f, true);
+    hamerly.fit(y, KMeans::Algorithm::Hamerly, 300, 0.0f, true);
+    assert(std::fabs(lloyd.inertia() / hamerly.inertia() - 1) < 1e-3);
+
+    // Predicting before fitting, and more clusters than NVectors.
+    try { unfitted.predict(small, false); }
+    catch(std::exception&) { thrown = true; }
+    assert(thrown);
+    thrown = false;
+    try { many.fit(small, KMeans::Algorithm::Lloyd, 5, 0, false); }
+    catch(std::exception&) { thrown = true; }
+    assert(thrown);
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testSeparated();
+    testOverlapping();
+
+    std::cout << "KMeans tests passed." << std::endl;
+
+    return 0;
+}
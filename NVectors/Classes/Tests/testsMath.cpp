@@ -0,0 +1,134 @@
+/*
+    File that contains the tests of the approximations of the exponential and
+    of the logarithm, against the correctly rounded results.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+
+
+// User defined.
+#include "../Headers/Math/mathApproximations.hpp"
+
+
+//##############################################################################
+// Variables
+//##############################################################################
+
+
+// Maximum error, in units in the last place, of the approximations.
+constexpr double maximumULP{2.0};
+
+
+// Number of random arguments of each function.
+constexpr size_t samples{1 << 20};
+
+
+//##############################################################################
+// Auxiliary Functions
+//##############################################################################
+
+
+/**
+ * Returns the error of the given value in units in the last place of the
+ * reference value, computed in long double.
+ * 
+ * @param value The value to check.
+ * 
+ * @param reference The exact value, to extended precision.
+ * 
+ * @return The error of the given value in units in the last place.
+*/
+template <typename T>
+double ulp(T value, long double reference)
+{
+    // Auxiliary variables.
+    T rounded = (T) reference;
+    T unit = std::nextafter(rounded, std::numeric_limits<T>::infinity()) -
+        rounded;
+
+    return (double) (std::fabs((long double) value - reference) / unit);
+}
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks the errors of the exponential and of the logarithm over their whole
+ * finite range, and their results for the special arguments.
+ * 
+ * @param lower The lowest argument of the exponential.
+ * 
+ * @param upper The highest argument of the exponential.
+*/
+template <typename T>
+void testApproximations(T lower, T upper)
+{
+    // Auxiliary variables.
+    std::mt19937_64 generator(1);
+    std::uniform_real_distribution<double> arguments(lower, upper);
+    std::uniform_real_distribution<double> exponents(
+        std::numeric_limits<T>::min_exponent,
+        std::numeric_limits<T>::max_exponent - 1
+    );
+
+    // Exponential.
+    for(size_t i = 0; i < samples; ++i)
+    {
+        T x = (T) arguments(generator);
+        long double reference = std::exp((long double) x);
+        assert(ulp(MathApproximations::exp(x), reference) <= maximumULP);
+    }
+
+    // Logarithm, of numbers across all the exponents and close to one.
+    for(size_t i = 0; i < samples; ++i)
+    {
+        T x = (i % 4 == 0) ? (T) (1 + arguments(generator) / upper / 1024) :
+            (T) std::exp2(exponents(generator));
+        long double reference = std::log((long double) x);
+        if(reference != 0)
+        {
+            assert(ulp(MathApproximations::log(x), reference) <= maximumULP);
+        }
+    }
+
+    // Special arguments.
+    assert(std::isinf(MathApproximations::exp((T) 1000)));
+    assert(MathApproximations::exp((T) -1000) == 0);
+    assert(MathApproximations::log((T) 1) == 0);
+    assert(std::isinf(MathApproximations::log((T) 0)));
+    assert(std::isnan(MathApproximations::log((T) -1)));
+    assert(
+        MathApproximations::log(std::numeric_limits<T>::denorm_min()) ==
+        std::log(std::numeric_limits<T>::denorm_min())
+    );
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testApproximations<double>(-708, 709);
+    testApproximations<float>(-87, 88);
+
+    std::cout << "Math tests passed." << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,100 @@
+/*
+    File that contains the tests of the blocked modified Gram-Schmidt, i.e.,
+    of the orthogonality of the result and of the reconstruction from the
+    factors.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+
+// User defined.
+#include "../vnvectors.hpp"
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks that the orthonormalized NVectors are orthonormal, that the factor
+ * is upper triangular and that their product gives the original NVectors.
+ * 
+ * @param dimensions The number of dimensions of the NVectors.
+ * 
+ * @param size The number of NVectors.
+ * 
+ * @param parallel If the orthonormalization must run in parallel.
+*/
+void testGramSchmidt(size_t dimensions, size_t size, bool parallel)
+{
+    // Auxiliary variables.
+    bool thrown = false;
+    std::mt19937 generator(3);
+    std::normal_distribution<double> normal;
+    VNVectors::VNVectors<double> original(dimensions, size, [&](size_t, size_t){
+        return normal(generator);
+    });
+    VNVectors::VNVectors<double> q = original;
+    VNVectors::VNVectors<double> r(size, size);
+
+    q.gramSchmidtIP(&r, parallel);
+
+    // Orthonormal, with an upper triangular factor.
+    for(size_t i = 0; i < size; ++i)
+    {
+        for(size_t j = 0; j < size; ++j)
+        {
+            assert(std::fabs(q[i].dotProduct(q[j]) - (i == j)) < 1e-10);
+            assert(j >= i || r[i][j] == 0);
+        }
+    }
+
+    // Reconstruction.
+    for(size_t j = 0; j < size; ++j)
+    {
+        for(size_t k = 0; k < dimensions; ++k)
+        {
+            double sum = 0;
+            for(size_t i = 0; i <= j; ++i)
+            {
+                sum += r[i][j] * q[i][k];
+            }
+            assert(std::fabs(sum - original[j][k]) < 1e-10);
+        }
+    }
+
+    // More NVectors than dimensions are linearly dependent.
+    VNVectors::VNVectors<double> dependent(3, 4, [&](size_t, size_t){
+        return normal(generator);
+    });
+    try { dependent.gramSchmidtIP(nullptr, parallel); }
+    catch(ExceptionsGeneral::DivisionByZero&) { thrown = true; }
+    assert(thrown);
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testGramSchmidt(300, 200, false);
+    testGramSchmidt(700, 600, true);
+
+    std::cout << "Orthogonalization tests passed." << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+/*
+    File that contains the tests of the mixed precision NVectors: the storage
+    types with a wider accumulation type, and the reduced precision storage
+    types, whose arithmetic is done in single precision.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+
+
+// User defined.
+#include "../nvectors.hpp"
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks the rounding of the brain floating point numbers to the nearest
+ * even value, and the special values.
+*/
+void testBFloat16()
+{
+    // Ties to even, and above the tie.
+    assert(sizeof(TypesFloating::BFloat16) == 2);
+    assert((float) TypesFloating::BFloat16(1.00390625f) == 1.0f);
+    assert((float) TypesFloating::BFloat16(1.01171875f) == 1.015625f);
+    assert((float) TypesFloating::BFloat16(3.0f) == 3.0f);
+
+    // Special values.
+    assert(std::isinf((float) TypesFloating::BFloat16(INFINITY)));
+    assert(std::isnan((float) TypesFloating::BFloat16(NAN)));
+
+    // Arithmetic in single precision, rounded when stored.
+    TypesFloating::BFloat16 x(1.0f);
+    x += 0.001f;
+    assert((float) x == 1.0f);
+    x *= 3.0f;
+    assert((float) x == 3.0f);
+}
+
+
+/**
+ * Checks that the wider accumulation type keeps the digits that the single
+ * precision accumulation loses.
+*/
+void testMixed()
+{
+    // Auxiliary variables.
+    size_t size = 1 << 20;
+    NVector::NVector<float> narrow(size, 0.1f);
+    NVector::NVector<float, double> wide(size, 0.1f);
+    double exact = (double) 0.1f * (double) 0.1f * (double) size;
+
+    // Dot products.
+    double error = std::fabs((double) narrow.dotProduct(narrow) - exact);
+    double errorWide = std::fabs(wide.dotProduct(wide) - exact);
+    assert(errorWide / exact < 1e-9 && errorWide < error);
+
+    // The results are stored in the storage type.
+    NVector::NVector<float, double> sum = wide + 1.0f;
+    assert(sum[0] == 1.1f);
+}
+
+
+/**
+ * Checks the NVectors with reduced precision storage and single precision
+ * accumulation, and that they need a wider accumulation type.
+*/
+void testReduced()
+{
+    // Auxiliary variables.
+    NVector::NVector<TypesFloating::BFloat16, float> b(4, 0.0f);
+    b[0] = 3.0f;
+    b[1] = 4.0f;
+
+    // Norms and normalization.
+    assert(b.norm() == 5.0f);
+    b.normalizeIP();
+    assert(std::fabs((float) b[0] - 0.6f) < 1e-2f);
+    assert(std::fabs((float) b[1] - 0.8f) < 1e-2f);
+
+    // Arithmetic.
+    NVector::NVector<TypesFloating::BFloat16, float> c =
+        (b * TypesFloating::BFloat16(2.0f) + TypesFloating::BFloat16(1.0f)) /
+        TypesFloating::BFloat16(2.0f);
+    assert(std::fabs((float) c[1] - 1.3f) < 1e-2f);
+    assert((float) c[2] == 0.5f);
+
+    #ifdef __FLT16_MAX__
+    NVector::NVector<TypesFloating::Float16, float> h(3, 1.0f);
+    h[2] = 2.0f;
+    assert(h.normSquared() == 6.0f);
+    #endif
+
+    // The reduced precision can not accumulate.
+    bool thrown = false;
+    try { NVector::NVector<TypesFloating::BFloat16> bad(3); }
+    catch(...) { thrown = true; }
+    assert(thrown);
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testBFloat16();
+    testMixed();
+    testReduced();
+
+    std::cout << "Precision tests passed." << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,169 @@
+/*
+    File that contains the tests of the projections of the vectors of NVectors
+    onto a single NVector and onto the subspaces spanned by several NVectors,
+    in parallel and serially.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+
+// User defined.
+#include "../vnvectors.hpp"
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks the projections onto the NVectors of the vector of NVectors itself,
+ * and onto the zero NVector.
+*/
+void testAliasing()
+{
+    // Auxiliary variables.
+    std::mt19937 generator(11);
+    std::normal_distribution<double> normal;
+    VNVectors::VNVectors<double> b(7, 3, [&](size_t, size_t){
+        return normal(generator);
+    });
+    VNVectors::VNVectors<double> expected = b;
+    NVector::NVector<double> first = b[0];
+
+    // Onto the first of its own NVectors, that changes while projecting.
+    for(size_t i = 0; i < 3; ++i)
+        expected[i] = expected[i].projection(first, true);
+    VNVectors::VNVectors<double> c = b;
+    c.projectionIP(c[0], true, false);
+    assert(c.isClose(expected, 1e-12, 1e-12));
+
+    // Onto the subspace it spans, that does not change it.
+    VNVectors::VNVectors<double> q = b;
+    q.gramSchmidtIP(nullptr, false);
+    VNVectors::VNVectors<double> d = q;
+    d.projectionIP(d, false, false);
+    assert(d.isClose(q, 1e-12, 1e-12));
+
+    // The zero NVector spans no direction.
+    bool thrown = false;
+    NVector::NVector<double> zero(7);
+    try { c.projectionIP(zero, true, false); }
+    catch(ExceptionsGeneral::DivisionByZero&) { thrown = true; }
+    assert(thrown);
+}
+
+
+/**
+ * Checks that the projections onto a single NVector agree with the ones of
+ * each of the NVectors, in place and out of place.
+ *
+ * @param parallel If the projections must run in parallel.
+*/
+void testSingle(bool parallel)
+{
+    // Auxiliary variables.
+    size_t dimensions = 7, size = 20000;
+    std::mt19937 generator(5);
+    std::normal_distribution<double> normal;
+    VNVectors::VNVectors<double> a(dimensions, size, [&](size_t, size_t){
+        return normal(generator);
+    });
+    NVector::NVector<double> u(dimensions, [&](size_t){
+        return normal(generator);
+    });
+    VNVectors::VNVectors<double> expected = a;
+    for(size_t i = 0; i < size; ++i)
+        expected[i] = expected[i].projection(u, true);
+
+    // Out of place.
+    VNVectors::VNVectors<double> out(dimensions, size);
+    a.projection(u, true, out, parallel);
+    assert(out.isClose(expected, 1e-12, 1e-12));
+    assert(a.projection(u, true).isClose(expected, 1e-12, 1e-12));
+
+    // In place.
+    VNVectors::VNVectors<double> b = a;
+    b.projectionIP(u, true, parallel);
+    assert(b.isClose(expected, 1e-12, 1e-12));
+
+    // NVectors of another dimension.
+    bool thrown = false;
+    NVector::NVector<double> other(dimensions + 1, 1.0);
+    try { b.projectionIP(other, true, parallel); }
+    catch(ExceptionsGeneral::Dimensions&) { thrown = true; }
+    assert(thrown);
+}
+
+
+/**
+ * Checks that the projections onto a subspace leave residuals orthogonal to
+ * it, that they are idempotent, and that they agree with the projections
+ * onto its orthonormal basis.
+ *
+ * @param parallel If the projections must run in parallel.
+*/
+void testSubspace(bool parallel)
+{
+    // Auxiliary variables.
+    size_t dimensions = 7, size = 20000;
+    std::mt19937 generator(7);
+    std::normal_distribution<double> normal;
+    VNVectors::VNVectors<double> a(dimensions, size, [&](size_t, size_t){
+        return normal(generator);
+    });
+    VNVectors::VNVectors<double> basis(dimensions, 3, [&](size_t, size_t){
+        return normal(generator);
+    });
+    VNVectors::VNVectors<double> out(dimensions, size);
+    a.projection(basis, true, out, parallel);
+
+    // Orthogonal residuals.
+    for(size_t i = 0; i < size; i += 997)
+    {
+        NVector::NVector<double> residual = a[i] - out[i];
+        for(size_t k = 0; k < 3; ++k)
+            assert(std::fabs(residual.dotProduct(basis[k])) < 1e-9);
+    }
+
+    // Idempotent.
+    VNVectors::VNVectors<double> again = out;
+    again.projectionIP(basis, true, parallel);
+    assert(again.isClose(out, 1e-12, 1e-12));
+
+    // The orthonormal basis of the same subspace.
+    VNVectors::VNVectors<double> q = basis;
+    q.gramSchmidtIP(nullptr, false);
+    VNVectors::VNVectors<double> b = a;
+    b.projectionIP(q, false, parallel);
+    assert(b.isClose(out, 1e-12, 1e-12));
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testAliasing();
+    testSingle(false);
+    testSingle(true);
+    testSubspace(false);
+    testSubspace(true);
+
+    std::cout << "Projections tests passed." << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,115 @@
+/*
+    File that contains the tests of the quantized vectors of NVectors, against
+    the exact dot products and nearest neighbours.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+
+// User defined.
+#include "../qvnvectors.hpp"
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks the quantized scores against the exact dot products, and that the
+ * reranked search finds the exact nearest neighbours.
+*/
+void testQuantized()
+{
+    // Auxiliary variables.
+    size_t size = 5000;
+    size_t dimensions = 64;
+    std::mt19937 generator(1);
+    std::normal_distribution<float> normal;
+    VNVectors::VNVectors<float> vectors(dimensions, size);
+    NVector::NVector<float> query(dimensions);
+
+    for(size_t i = 0; i < size; ++i)
+    {
+        for(size_t k = 0; k < dimensions; ++k)
+        {
+            vectors[i][k] = normal(generator) + 0.3f * (k % 5);
+        }
+    }
+    for(size_t k = 0; k < dimensions; ++k)
+    {
+        query[k] = normal(generator);
+    }
+
+    // Exact nearest neighbours.
+    std::vector<std::pair<float, size_t>> exact;
+    for(size_t i = 0; i < size; ++i)
+    {
+        exact.push_back({(vectors[i] - query).normSquared(), i});
+    }
+    std::sort(exact.begin(), exact.end());
+
+    for(QVNVectors::Mode mode :
+        {QVNVectors::Mode::PerVector, QVNVectors::Mode::PerDimension})
+    {
+        QVNVectors::QVNVectors<float> quantized(vectors, mode);
+        std::vector<float> scores = quantized.scores(
+            query, QVNVectors::Metric::DotProduct, true
+        );
+
+        // The same scores in parallel and serially, close to the exact ones.
+        assert(scores == quantized.scores(
+            query, QVNVectors::Metric::DotProduct, false
+        ));
+        for(size_t i = 0; i < size; ++i)
+        {
+            assert(std::fabs(scores[i] - vectors[i].dotProduct(query)) < 1);
+        }
+
+        // Reranking with the exact vectors.
+        std::vector<std::pair<size_t, float>> found = quantized.search(
+            query, 10, QVNVectors::Metric::L2, &vectors, 200, true
+        );
+        for(size_t i = 0; i < 10; ++i)
+        {
+            assert(found[i].first == exact[i].second);
+        }
+    }
+
+    // An empty vector of NVectors.
+    VNVectors::VNVectors<float> none(4);
+    for(QVNVectors::Mode mode :
+        {QVNVectors::Mode::PerVector, QVNVectors::Mode::PerDimension})
+    {
+        QVNVectors::QVNVectors<float> empty(none, mode);
+        assert(empty.size() == 0 && empty.dimensions() == 4);
+    }
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testQuantized();
+
+    std::cout << "Quantized tests passed." << std::endl;
+
+    return 0;
+}
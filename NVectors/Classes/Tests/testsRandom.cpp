@@ -0,0 +1,189 @@
+/*
+    File that contains the tests of the Philox generator, against the known
+    answers of Random123, and of the reproducible random fills.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+
+
+// User defined.
+#include "../sampling.hpp"
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks that the uniform fills of the integer entries are reproducible,
+ * stay in the range and are not biased, and that the empty ranges are
+ * rejected.
+*/
+void testIntegers()
+{
+    // Auxiliary variables.
+    size_t size = 300000;
+    size_t counts[3] = {0, 0, 0};
+    NVector::NVector<int> parallel(size);
+    NVector::NVector<int> flat(size);
+
+    // The fills do not depend on the threads.
+    Sampling::uniform(parallel, -1, 2, 5, true);
+    Sampling::uniform(flat, -1, 2, 5, false);
+    assert(parallel == flat);
+    for(size_t i = 0; i < size; ++i)
+    {
+        assert(flat[i] >= -1 && flat[i] < 2);
+        ++counts[flat[i] + 1];
+    }
+
+    // Each of the integers comes a third of the times.
+    for(size_t c = 0; c < 3; ++c)
+    {
+        assert(std::fabs((double) counts[c] / size - 1.0 / 3) < 0.005);
+    }
+
+    // Ranges wider than a word.
+    NVector::NVector<int64_t> wide(10000);
+    int64_t lower = -((int64_t) 1 << 40);
+    int64_t upper = (int64_t) 1 << 50;
+    bool negative = false;
+    Sampling::uniform(wide, lower, upper, 11, false);
+    for(size_t i = 0; i < wide.size(); ++i)
+    {
+        assert(wide[i] >= lower && wide[i] < upper);
+        negative = negative || wide[i] < 0;
+    }
+    assert(negative);
+
+    // Empty ranges.
+    bool thrown = false;
+    try { Sampling::uniform(flat, 3, 3, 1, false); }
+    catch(ExceptionsNumerical::GreaterThan<int>&) { thrown = true; }
+    assert(thrown);
+}
+
+
+/**
+ * Checks the blocks of the Philox4x32-10 generator against the known answers
+ * of Random123.
+*/
+void testPhilox()
+{
+    // Zero key and counter.
+    std::array<uint32_t, 4> block = RandomGeneral::Philox(0)({0, 0, 0, 0});
+    assert(block[0] == 0x6627e8d5u && block[1] == 0xe169c58du);
+    assert(block[2] == 0xbc57ac4cu && block[3] == 0x9b00dbd8u);
+
+    // All bits set.
+    block = RandomGeneral::Philox(~0ull)({~0u, ~0u, ~0u, ~0u});
+    assert(block[0] == 0x408f276du && block[1] == 0x41c83b0eu);
+    assert(block[2] == 0xa20bc7c6u && block[3] == 0x6d5451fdu);
+
+    // Digits of pi.
+    block = RandomGeneral::Philox(0x299f31d0a4093822ull)(
+        {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}
+    );
+    assert(block[0] == 0xd16cfe09u && block[1] == 0x94fdccebu);
+    assert(block[2] == 0x5001e420u && block[3] == 0x24126ea1u);
+}
+
+
+/**
+ * Checks that the fills are the same in parallel and serially, for the
+ * NVectors and the vectors of NVectors, and that their moments are right.
+*/
+void testSampling()
+{
+    // Auxiliary variables.
+    size_t dimensions = 37;
+    size_t size = 10000;
+    double mean = 0;
+    double variance = 0;
+    VNVectors::VNVectors<double> parallel(dimensions, size);
+    VNVectors::VNVectors<double> serial(dimensions, size);
+    NVector::NVector<double> flat(dimensions * size);
+
+    // The normal fills do not depend on the threads nor on the container.
+    Sampling::normal(parallel, 0.0, 1.0, 123, true);
+    Sampling::normal(serial, 0.0, 1.0, 123, false);
+    Sampling::normal(flat, 0.0, 1.0, 123, true);
+    assert(parallel == serial);
+    for(size_t i = 0; i < size; ++i)
+    {
+        for(size_t j = 0; j < dimensions; ++j)
+        {
+            assert(flat[i * dimensions + j] == parallel[i][j]);
+        }
+    }
+
+    // Moments of the normal distribution.
+    for(size_t i = 0; i < flat.size(); ++i)
+    {
+        mean += flat[i];
+        variance += flat[i] * flat[i];
+    }
+    mean /= flat.size();
+    variance = variance / flat.size() - mean * mean;
+    assert(std::fabs(mean) < 0.01 && std::fabs(variance - 1) < 0.01);
+
+    // Uniform fills stay in the half open interval.
+    VNVectors::VNVectors<float> uniform(5, 100000);
+    VNVectors::VNVectors<float> uniformSerial(5, 100000);
+    Sampling::uniform(uniform, -2.0f, 3.0f, 9, true);
+    Sampling::uniform(uniformSerial, -2.0f, 3.0f, 9, false);
+    assert(uniform == uniformSerial);
+    mean = 0;
+    for(size_t i = 0; i < uniform.size(); ++i)
+    {
+        for(size_t j = 0; j < uniform.dimensions(); ++j)
+        {
+            assert(uniform[i][j] >= -2.0f && uniform[i][j] < 3.0f);
+            mean += uniform[i][j];
+        }
+    }
+    assert(std::fabs(mean / 500000 - 0.5) < 0.01);
+
+    // Directions have unit norm.
+    VNVectors::VNVectors<float> directions(3, 50000);
+    Sampling::directions(directions, 4, true);
+    for(size_t i = 0; i < directions.size(); ++i)
+    {
+        assert(std::fabs(directions[i].norm() - 1) < 1e-6);
+    }
+
+    // Different seeds give different fills.
+    NVector::NVector<double> first(3);
+    NVector::NVector<double> second(3);
+    Sampling::uniform(first, 0.0, 1.0, 7, false);
+    Sampling::uniform(second, 0.0, 1.0, 8, false);
+    assert(!(first == second));
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testIntegers();
+    testPhilox();
+    testSampling();
+
+    std::cout << "Random tests passed." << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,146 @@
+/*
+    File that contains the tests of the functions that report their errors
+    without throwing, and of the messages of the exceptions, that are only
+    created when requested.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+
+// User defined.
+#include "../vnvectors.hpp"
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks that the messages of the exceptions hold the dimensions and indexes
+ * involved, and that they are created once.
+*/
+void testMessages()
+{
+    // Auxiliary variables.
+    NVector::NVector<double> a(3, 1.0), b(4, 1.0);
+    bool thrown = false;
+
+    // Dimensions.
+    try { a.dotProduct(b); }
+    catch(ExceptionsGeneral::Dimensions& e)
+    {
+        thrown = true;
+        const char* message = e.what();
+        assert(std::strstr(message, "Expected: 3") != nullptr);
+        assert(std::strstr(message, "Requested: 4") != nullptr);
+        assert(e.what() == message);
+    }
+    assert(thrown);
+
+    // Indexes.
+    thrown = false;
+    try { a[7]; }
+    catch(ExceptionsGeneral::IndexOutOfRange& e)
+    {
+        thrown = true;
+        assert(std::strstr(e.what(), "Requested: 7") != nullptr);
+    }
+    assert(thrown);
+
+    // Divisions by zero.
+    thrown = false;
+    NVector::NVector<double> zero(3);
+    try { zero.normalizeIP(); }
+    catch(ExceptionsGeneral::DivisionByZero& e)
+    {
+        thrown = true;
+        assert(std::strlen(e.what()) > 0);
+    }
+    assert(thrown);
+}
+
+
+/**
+ * Checks that the functions of the NVectors report the same errors that
+ * their throwing versions throw, and that they do not throw.
+*/
+void testVector()
+{
+    // Auxiliary variables.
+    using ExceptionsResults::Error;
+    NVector::NVector<double> a(3, 1.0), b(4, 1.0), zero(3), out(3);
+
+    // Dot products.
+    static_assert(noexcept(a.tryDotProduct(b)));
+    ExceptionsResults::Result<double> dot = a.tryDotProduct(b);
+    assert(!dot && dot.code() == Error::Dimensions);
+    dot = a.tryDotProduct(a);
+    assert(dot && dot.code() == Error::None && dot.value() == 3);
+
+    // Normalization, the failed one does not change the NVector.
+    assert(zero.tryNormalizeIP() == Error::DivisionByZero);
+    assert(zero[0] == 0 && zero[1] == 0 && zero[2] == 0);
+    assert(a.tryNormalizeIP() == Error::None);
+    assert(std::fabs(a.norm() - 1) < 1e-15);
+
+    // Accesses.
+    assert(!a.tryAt(3) && a.tryAt(3).code() == Error::IndexOutOfRange);
+    assert(a.tryAt(3).valueOr(-1) == -1 && a.tryAt(2).valueOr(-1) == a[2]);
+    assert(a.trySet(5, 1.0) == Error::IndexOutOfRange);
+    assert(a.trySet(0, 2.0) == Error::None && a[0] == 2);
+
+    // Cross products.
+    assert(a.tryCrossProduct(b, out) == Error::Dimensions);
+    assert(a.tryCrossProduct(a, out) == Error::None && out[0] == 0);
+}
+
+
+/**
+ * Checks the functions of the vectors of NVectors that report their errors.
+*/
+void testVectors()
+{
+    // Auxiliary variables.
+    using ExceptionsResults::Error;
+    VNVectors::VNVectors<double> v(3, 5), w(3, 5);
+    NVector::NVector<double> a(3, 1.0), b(4, 1.0);
+
+    // Accesses, to the NVectors themselves.
+    assert(!v.tryAt(5) && v.tryAt(5).code() == Error::IndexOutOfRange);
+    assert(v.tryAt(4).value() == &v[4]);
+
+    // Cross products, with vectors of NVectors and with single NVectors.
+    assert(v.tryCrossProduct(w, w) == Error::None);
+    assert(v.tryCrossProduct(a, w) == Error::None);
+    assert(v.tryCrossProduct(b, w) == Error::Dimensions);
+    VNVectors::VNVectors<double> four(4, 5);
+    assert(four.tryCrossProduct(four, four) == Error::Dimensions);
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testMessages();
+    testVector();
+    testVectors();
+
+    std::cout << "Results tests passed." << std::endl;
+
+    return 0;
+}
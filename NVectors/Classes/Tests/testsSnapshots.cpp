@@ -0,0 +1,226 @@
+/*
+    File that contains the round trip tests of the byte codings and of the
+    snapshots, and the checks that the corrupted snapshots are rejected.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <random>
+#include <vector>
+
+
+// User defined.
+#include "../sampling.hpp"
+#include "../snapshots.hpp"
+
+
+//##############################################################################
+// Auxiliary Functions
+//##############################################################################
+
+
+/**
+ * Returns a buffer of bytes with runs and a skewed distribution, such that
+ * every coding is exercised.
+ * 
+ * @param size The number of bytes.
+ * 
+ * @param seed The seed of the bytes.
+ * 
+ * @return The buffer of bytes.
+*/
+std::vector<uint8_t> bytes(size_t size, size_t seed)
+{
+    // Auxiliary variables.
+    std::mt19937 generator((uint32_t) seed);
+    std::geometric_distribution<int> skewed(0.3);
+    std::vector<uint8_t> result(size);
+
+    for(size_t i = 0; i < size; ++i)
+    {
+        // Alternate between runs, skewed bytes and uniform bytes.
+        switch((i / 97 + seed) % 3)
+        {
+            case 0: result[i] = (uint8_t) (i / 97); break;
+            case 1: result[i] = (uint8_t) skewed(generator); break;
+            default: result[i] = (uint8_t) generator(); break;
+        }
+    }
+
+    return result;
+}
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks the round trips of the run length, Huffman and byte plane codings,
+ * and that the decoders reject the wrong sizes.
+*/
+void testCodings()
+{
+    for(size_t t = 0; t < 200; ++t)
+    {
+        // Auxiliary variables.
+        std::vector<uint8_t> original = bytes(t * 37 % 1000, t);
+        std::vector<uint8_t> encoded;
+        std::vector<uint8_t> decoded(original.size());
+        size_t size = original.size();
+
+        // Run length.
+        CompressionGeneral::runLengthEncode(original.data(), size, encoded);
+        assert(CompressionGeneral::runLengthDecode(
+            encoded.data(), encoded.size(), decoded.data(), size
+        ));
+        assert(decoded == original);
+        assert(size == 0 || !CompressionGeneral::runLengthDecode(
+            encoded.data(), encoded.size(), decoded.data(), size - 1
+        ));
+
+        // Huffman.
+        encoded.clear();
+        CompressionGeneral::huffmanEncode(original.data(), size, encoded);
+        assert(CompressionGeneral::huffmanDecode(
+            encoded.data(), encoded.size(), decoded.data(), size
+        ));
+        assert(decoded == original);
+        assert(!CompressionGeneral::huffmanDecode(
+            encoded.data(), encoded.size() - 1, decoded.data(), size
+        ));
+
+        // Byte planes of eight byte elements.
+        size -= size % 8;
+        encoded.clear();
+        CompressionGeneral::planesEncode(original.data(), size / 8, 8, encoded);
+        assert(CompressionGeneral::planesDecode(
+            encoded.data(), encoded.size(), size / 8, 8, decoded.data()
+        ));
+        assert(std::equal(
+            original.begin(), original.begin() + size, decoded.begin()
+        ));
+    }
+}
+
+
+/**
+ * Checks the round trips of the full and delta snapshots, that they are the
+ * same in parallel and serially, and that the corrupted, truncated and
+ * mismatched snapshots are rejected.
+*/
+void testSnapshots()
+{
+    // Auxiliary variables.
+    size_t dimensions = 37;
+    size_t size = 5000;
+    bool thrown = false;
+    VNVectors::VNVectors<double> vectors(dimensions, size);
+
+    // Full snapshot of entries with few significant digits.
+    Sampling::normal(vectors, 1.0, 0.01, 42, true);
+    for(size_t i = 0; i < size; ++i)
+    {
+        for(size_t j = 0; j < dimensions; ++j)
+        {
+            vectors[i][j] = std::round(vectors[i][j] * 1000) / 1000;
+        }
+    }
+    std::vector<uint8_t> full = Snapshots::encode(vectors, true);
+    assert(full == Snapshots::encode(vectors, false));
+    assert(full.size() < dimensions * size * sizeof(double));
+    Snapshots::Header header = Snapshots::header(full);
+    assert(header.dimension == dimensions && header.count == size);
+    assert(Snapshots::decodeVNVectors<double>(full, true) == vectors);
+
+    // Delta snapshot against the previous state.
+    VNVectors::VNVectors<double> previous = vectors;
+    for(size_t i = 0; i < size; i += 100)
+    {
+        vectors[i][3] += 1.0;
+    }
+    std::vector<uint8_t> delta = Snapshots::encode(vectors, previous, true);
+    assert(delta == Snapshots::encode(vectors, previous, false));
+    assert(
+        Snapshots::decodeVNVectors<double>(delta, previous, true) == vectors
+    );
+
+    // A delta snapshot needs its base, and the right one.
+    try { Snapshots::decodeVNVectors<double>(delta, true); }
+    catch(ExceptionsNVector::Snapshot&) { thrown = true; }
+    assert(thrown);
+    thrown = false;
+    try { Snapshots::decodeVNVectors<double>(delta, vectors, true); }
+    catch(ExceptionsNVector::Checksum&) { thrown = true; }
+    assert(thrown);
+
+    // Corrupted payload and header.
+    for(size_t position : {full.size() - 100, (size_t) 10})
+    {
+        std::vector<uint8_t> corrupted = full;
+        corrupted[position] ^= 0x55;
+        thrown = false;
+        try { Snapshots::decodeVNVectors<double>(corrupted, true); }
+        catch(std::exception&) { thrown = true; }
+        assert(thrown);
+    }
+
+    // Every truncation of a snapshot of an NVector.
+    NVector::NVector<float> vector(1000);
+    Sampling::uniform(vector, 0.0f, 1.0f, 7, false);
+    std::vector<uint8_t> single = Snapshots::encode(vector, false);
+    for(size_t k = 0; k < single.size(); ++k)
+    {
+        std::vector<uint8_t> truncated(single.begin(), single.begin() + k);
+        thrown = false;
+        try { Snapshots::decodeNVector<float>(truncated, false); }
+        catch(std::exception&) { thrown = true; }
+        assert(thrown);
+    }
+    assert(Snapshots::decodeNVector<float>(single, false) == vector);
+
+    // Wrong type and wrong kind of container.
+    thrown = false;
+    try { Snapshots::decodeNVector<double>(single, false); }
+    catch(ExceptionsNVector::Snapshot&) { thrown = true; }
+    assert(thrown);
+    thrown = false;
+    try { Snapshots::decodeVNVectors<float>(single, false); }
+    catch(ExceptionsNVector::Snapshot&) { thrown = true; }
+    assert(thrown);
+
+    // Empty vectors of NVectors keep their dimensions.
+    VNVectors::VNVectors<double> empty(4);
+    VNVectors::VNVectors<double> decoded = Snapshots::decodeVNVectors<double>(
+        Snapshots::encode(empty, true), true
+    );
+    assert(decoded.size() == 0 && decoded.dimensions() == 4);
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testCodings();
+    testSnapshots();
+
+    std::cout << "Snapshots tests passed." << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,133 @@
+/*
+    File that contains the tests of the argsorts and of the permutations of the
+    vectors of NVectors, in parallel and serially.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+
+// User defined.
+#include "../vnvectors.hpp"
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks that the argsorts are ordered and stable, and that the permutations
+ * in place, out of place and aliased agree.
+ * 
+ * @param parallel If the functions must run in parallel.
+*/
+void testArgsort(bool parallel)
+{
+    // Auxiliary variables.
+    size_t size = 50000;
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<double> uniform(-1, 1);
+    VNVectors::VNVectors<double> v(3, size, [&](size_t, size_t){
+        return std::floor(uniform(generator) * 10);
+    });
+    NVector::NVector<double> ones(3, 1.0);
+
+    // By component, stable.
+    std::vector<size_t> order = v.argsortByComponent(1, parallel);
+    for(size_t i = 1; i < size; ++i)
+    {
+        assert(v[order[i - 1]][1] <= v[order[i]][1]);
+        assert(v[order[i - 1]][1] < v[order[i]][1] || order[i - 1] < order[i]);
+    }
+
+    // By norm and by dot product.
+    order = v.argsortByNorm(parallel);
+    for(size_t i = 1; i < size; ++i)
+    {
+        assert(v[order[i - 1]].norm() <= v[order[i]].norm());
+    }
+    order = v.argsortByDotProduct(ones, parallel);
+    for(size_t i = 1; i < size; ++i)
+    {
+        assert(
+            v[order[i - 1]].dotProduct(ones) <= v[order[i]].dotProduct(ones)
+        );
+    }
+
+    // Lexicographic, applied out of place, in place and onto itself.
+    order = v.argsortLexicographic(parallel);
+    VNVectors::VNVectors<double> sorted(3, size);
+    v.permute(order, sorted, parallel);
+    for(size_t i = 1; i < size; ++i)
+    {
+        assert(!std::lexicographical_compare(
+            sorted[i].data(), sorted[i].data() + 3,
+            sorted[i - 1].data(), sorted[i - 1].data() + 3
+        ));
+    }
+    VNVectors::VNVectors<double> inPlace = v;
+    inPlace.permuteIP(order);
+    assert(inPlace == sorted);
+    VNVectors::VNVectors<double> aliased = v;
+    aliased.permute(order, aliased, parallel);
+    assert(aliased == sorted);
+}
+
+
+/**
+ * Checks the exceptions of the argsorts and of the permutations, and the
+ * empty vectors of NVectors.
+*/
+void testErrors()
+{
+    // Auxiliary variables.
+    bool thrown = false;
+    VNVectors::VNVectors<double> v(3, 10);
+    VNVectors::VNVectors<double> empty(3);
+    std::vector<size_t> repeated(10, 0);
+    std::vector<size_t> none;
+
+    // Not a permutation.
+    try { v.permuteIP(repeated); }
+    catch(ExceptionsNVector::Permutation&) { thrown = true; }
+    assert(thrown);
+
+    // Component out of range.
+    thrown = false;
+    try { v.argsortByComponent(3, false); }
+    catch(ExceptionsGeneral::IndexOutOfRange&) { thrown = true; }
+    assert(thrown);
+
+    // Empty.
+    assert(empty.argsortByNorm(true).empty());
+    empty.permuteIP(none);
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testArgsort(false);
+    testArgsort(true);
+    testErrors();
+
+    std::cout << "Sorting tests passed." << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+/*
+    File that contains the tests of the sparse vectors, against the dense
+    vectors.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cassert>
+#include <cmath>
+#include <exception>
+#include <iostream>
+#include <random>
+
+
+// User defined.
+#include "../snvectors.hpp"
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks the sparse dot products, with the merge and the galloping paths,
+ * against the dense dot products.
+*/
+void testSparse()
+{
+    // Auxiliary variables.
+    size_t dimensions = 100000;
+    bool thrown = false;
+    std::mt19937 generator(3);
+    NVector::NVector<double> fewDense(dimensions);
+    NVector::NVector<double> manyDense(dimensions);
+    NVector::NVector<double> someDense(dimensions);
+
+    // Vectors with very different numbers of non zeros.
+    for(size_t i = 0; i < 30000; ++i)
+    {
+        double value = (generator() % 100) / 10.0 - 5;
+        manyDense[generator() % dimensions] = value;
+        if(i < 500) fewDense[generator() % dimensions] = value;
+        if(i < 700) someDense[generator() % dimensions] = value;
+    }
+    SNVector::SNVector<double> few(fewDense);
+    SNVector::SNVector<double> many(manyDense);
+    SNVector::SNVector<double> some(someDense);
+
+    // Sparse with dense, and sparse with sparse in both orders.
+    double expected = fewDense.dotProduct(manyDense);
+    assert(std::fabs(few.dotProduct(manyDense) - expected) < 1e-9);
+    assert(std::fabs(few.dotProduct(many) - expected) < 1e-9);
+    assert(std::fabs(many.dotProduct(few) - expected) < 1e-9);
+    expected = fewDense.dotProduct(someDense);
+    assert(std::fabs(few.dotProduct(some) - expected) < 1e-9);
+    assert(std::fabs(few.norm() - fewDense.norm()) < 1e-9);
+    assert(few.toNVector() == fewDense);
+
+    // Repeated indexes are summed and zeros are dropped.
+    SNVector::SNVector<double> repeated(
+        10, {5, 1, 5, 3}, {1.0, 2.0, -1.0, 4.0}
+    );
+    assert(repeated.nonZeros() == 2 && repeated[3] == 4 && repeated[5] == 0);
+
+    // Indexes out of range.
+    try { SNVector::SNVector<double> wrong(3, {3}, {1.0}); }
+    catch(std::exception&) { thrown = true; }
+    assert(thrown);
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testSparse();
+
+    std::cout << "Sparse tests passed." << std::endl;
+
+    return 0;
+}
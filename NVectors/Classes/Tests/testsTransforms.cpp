@@ -0,0 +1,136 @@
+/*
+    File that contains the tests of the matrix and homogeneous transforms of
+    the vectors of NVectors, in parallel and serially.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+
+// User defined.
+#include "../vnvectors.hpp"
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks that the linear and homogeneous transforms agree with each other,
+ * in place and out of place, and that the divisions by the homogeneous
+ * coordinate are applied.
+ *
+ * @param parallel If the transforms must run in parallel.
+*/
+void testTransforms(bool parallel)
+{
+    // Auxiliary variables.
+    size_t size = 20000;
+    VNVectors::VNVectors<double> a(3, size, [](size_t i, size_t j){
+        return std::sin((double) (i * 3 + j));
+    });
+    VNVectors::VNVectors<double> out(3, size);
+    std::array<std::array<double, 3>, 3> m{{{0, -1, 0}, {1, 0, 0}, {0, 0, 2}}};
+    std::array<double, 3> t{1, 2, 3};
+    std::array<std::array<double, 4>, 4> h{{
+        {0, -1, 0, 1}, {1, 0, 0, 2}, {0, 0, 2, 3}, {0, 0, 0, 1}
+    }};
+
+    // Linear transform with a translation.
+    a.transform<3>(m, t, out, parallel);
+    for(size_t i = 0; i < size; ++i)
+    {
+        assert(std::fabs(out[i][0] - (1 - a[i][1])) < 1e-12);
+        assert(std::fabs(out[i][1] - (2 + a[i][0])) < 1e-12);
+        assert(std::fabs(out[i][2] - (3 + 2 * a[i][2])) < 1e-12);
+    }
+
+    // The same transform, homogeneous and in place.
+    VNVectors::VNVectors<double> b = a;
+    b.transformHomogeneousIP<4>(h, parallel);
+    assert(b == out);
+
+    // Division by the homogeneous coordinate.
+    h[3] = {0, 0, 0, 2};
+    a.transformHomogeneous<4>(h, b, parallel);
+    for(size_t i = 0; i < size; ++i)
+    {
+        assert(std::fabs(b[i][0] - out[i][0] / 2) < 1e-12);
+    }
+
+    // Linear transform in place, without the translation.
+    a.transformIP<3>(m, parallel);
+    for(size_t i = 0; i < size; ++i)
+    {
+        assert(std::fabs(a[i][0] + 1 - out[i][0]) < 1e-12);
+    }
+
+    // Matrices of another dimension.
+    bool thrown = false;
+    std::array<std::array<double, 2>, 2> small{};
+    try { a.transformIP<2>(small, parallel); } catch(...) { thrown = true; }
+    assert(thrown);
+}
+
+
+/**
+ * Checks that the parallel loops cover each index once, also when they
+ * throw.
+*/
+void testParallelFor()
+{
+    // Auxiliary variables.
+    std::atomic<size_t> count{0};
+
+    // Every index once, with chunks that are never empty.
+    ParallelGeneral::parallelFor(0, 100000, 10, [&](size_t first, size_t last)
+    {
+        assert(first < last);
+        count += last - first;
+    });
+    assert(count == 100000);
+
+    // Inverted ranges do nothing.
+    ParallelGeneral::parallelFor(10, 5, 1, [&](size_t, size_t){ ++count; });
+    assert(count == 100000);
+
+    // The errors are propagated after every chunk finished.
+    bool thrown = false;
+    try
+    {
+        ParallelGeneral::parallelFor(0, 100000, 10, [](size_t first, size_t)
+        {
+            if(first == 0) throw ExceptionsGeneral::DivisionByZero();
+        });
+    }
+    catch(ExceptionsGeneral::DivisionByZero&) { thrown = true; }
+    assert(thrown);
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testParallelFor();
+    testTransforms(false);
+    testTransforms(true);
+
+    std::cout << "Transforms tests passed." << std::endl;
+
+    return 0;
+}
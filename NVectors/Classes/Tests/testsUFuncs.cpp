@@ -0,0 +1,188 @@
+/*
+    File that contains the tests of the element-wise functions of the NVectors
+    and of the vectors of NVectors: the unary and binary functions, the
+    comparisons and the fused multiply-adds, in parallel and serially.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+
+// User defined.
+#include "../ufuncs.hpp"
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks the binary functions, the comparisons and the fused multiply-adds of
+ * the NVectors, also when the output is one of the arguments.
+*/
+void testBinary()
+{
+    // Auxiliary variables.
+    NVector::NVector<double> a(7, [](size_t i){ return (double) i - 3.0; });
+    NVector::NVector<double> b(7, 1.0), c(7, 2.0), out(7);
+
+    // Extremes.
+    UFuncs::maximum(a, b, out);
+    assert(out[0] == 1 && out[6] == 3);
+    UFuncs::minimum(a, b, out);
+    assert(out[0] == -3 && out[6] == 1);
+
+    // Comparisons.
+    UFuncs::greater(a, b, out);
+    assert(out[4] == 0 && out[5] == 1);
+    UFuncs::less(a, b, out);
+    assert(out[3] == 1 && out[4] == 0);
+    UFuncs::equal(a, b, out);
+    assert(out[4] == 1 && out[5] == 0);
+
+    // Fused multiply-adds, against the standard one.
+    UFuncs::fma(a, c, b, out);
+    for(size_t i = 0; i < 7; ++i) assert(out[i] == std::fma(a[i], 2.0, 1.0));
+
+    // In place.
+    NVector::NVector<double> d = a;
+    UFuncs::maximumIP(d, b);
+    assert(d[0] == 1 && d[6] == 3);
+    UFuncs::fmaIP(d, c, b);
+    assert(d[0] == 3 && d[6] == 7);
+    UFuncs::minimum(d, d, d);
+    assert(d[0] == 3);
+
+    // Dimensions.
+    bool thrown = false;
+    NVector::NVector<double> small(3);
+    try { UFuncs::maximum(a, small, out); }
+    catch(ExceptionsGeneral::Dimensions&) { thrown = true; }
+    assert(thrown);
+}
+
+
+/**
+ * Checks that the functions of the vectors of NVectors agree with the
+ * functions of each of their NVectors, and do not depend on the number of
+ * threads.
+*/
+void testRows()
+{
+    // Auxiliary variables.
+    size_t dimensions = 64, size = 5000;
+    VNVectors::VNVectors<float> v(dimensions, size, [](size_t i, size_t j){
+        return (float) (i + j) * 0.001f - 1.0f;
+    });
+    VNVectors::VNVectors<float> w(dimensions, size, [](size_t i, size_t j){
+        return (float) (i * j % 17) * 0.1f - 0.8f;
+    });
+    VNVectors::VNVectors<float> serial(dimensions, size);
+    VNVectors::VNVectors<float> parallel(dimensions, size);
+    NVector::NVector<float> row(dimensions);
+
+    // Unary functions.
+    UFuncs::abs(v, serial, false);
+    UFuncs::abs(v, parallel, true);
+    assert(serial == parallel);
+    for(size_t i = 0; i < size; i += 97)
+    {
+        UFuncs::abs(v[i], row);
+        assert(row == serial[i]);
+    }
+
+    // Binary functions, with the output as one of the arguments.
+    parallel = v;
+    UFuncs::fma(v, w, v, serial, false);
+    UFuncs::fma(parallel, w, parallel, parallel, true);
+    assert(serial == parallel);
+    UFuncs::greater(v, w, serial, false);
+    for(size_t i = 0; i < size; i += 97)
+    {
+        UFuncs::greater(v[i], w[i], row);
+        assert(row == serial[i]);
+    }
+
+    // In place.
+    serial = v;
+    parallel = v;
+    UFuncs::clampIP(serial, -0.5f, 0.5f, false);
+    UFuncs::clampIP(parallel, -0.5f, 0.5f, true);
+    assert(serial == parallel && serial[0][0] == -0.5f);
+    assert(serial[size - 1][dimensions - 1] == 0.5f);
+    UFuncs::minimumIP(serial, w, false);
+    UFuncs::minimumIP(parallel, w, true);
+    assert(serial == parallel);
+
+    // Shapes.
+    bool thrown = false;
+    VNVectors::VNVectors<float> small(dimensions, size - 1);
+    try { UFuncs::abs(v, small, true); }
+    catch(ExceptionsGeneral::Dimensions&) { thrown = true; }
+    assert(thrown);
+}
+
+
+/**
+ * Checks the unary functions of the NVectors, with the special values of
+ * their domains, also when the output is the argument.
+*/
+void testUnary()
+{
+    // Auxiliary variables.
+    NVector::NVector<double> a(7, [](size_t i){ return (double) i - 3.0; });
+    NVector::NVector<double> out(7);
+
+    // Absolute values and clamps.
+    UFuncs::abs(a, out);
+    for(size_t i = 0; i < 7; ++i) assert(out[i] == std::fabs(a[i]));
+    UFuncs::clamp(a, -1.0, 2.0, out);
+    assert(out[0] == -1 && out[3] == 0 && out[6] == 2);
+
+    // Square roots, outside of their domain.
+    UFuncs::sqrt(a, out);
+    assert(std::isnan(out[0]) && out[3] == 0 && out[4] == 1);
+    assert(out[6] == std::sqrt(3.0));
+
+    // In place.
+    NVector::NVector<double> b = a;
+    UFuncs::absIP(b);
+    assert(b[0] == 3);
+    UFuncs::sqrtIP(b);
+    assert(b[4] == 1 && b[3] == 0);
+    UFuncs::clampIP(b, 0.5, 1.5);
+    assert(b[3] == 0.5 && b[0] == 1.5);
+
+    // Dimensions.
+    bool thrown = false;
+    NVector::NVector<double> small(3);
+    try { UFuncs::abs(a, small); }
+    catch(ExceptionsGeneral::Dimensions&) { thrown = true; }
+    assert(thrown);
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testBinary();
+    testRows();
+    testUnary();
+
+    std::cout << "UFuncs tests passed." << std::endl;
+
+    return 0;
+}
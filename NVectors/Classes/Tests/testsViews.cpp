@@ -0,0 +1,178 @@
+/*
+    File that contains the tests of the views of the NVectors and of the
+    vectors of NVectors, of their slices and of their compound assignments.
+*/
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cassert>
+#include <iostream>
+#include <sstream>
+
+
+// User defined.
+#include "../views.hpp"
+
+
+//##############################################################################
+// Test Functions
+//##############################################################################
+
+
+/**
+ * Checks the element-wise compound assignments of the views with views and
+ * with NVectors, and that the cached norms of the viewed NVectors are kept
+ * by the reads and invalidated by the writes.
+*/
+void testCompound()
+{
+    // Auxiliary variables.
+    NVector::NVector<double> a(6, [](size_t i){ return (double) i; });
+    NVector::NVector<double> b(3, 2.0);
+    Views::NVectorView<double> even(a, Views::Slice(0, 6, 2));
+    Views::NVectorView<double> odd(a, Views::Slice(1, 6, 2));
+
+    // With NVectors.
+    even += b;
+    assert(a[0] == 2 && a[2] == 4 && a[4] == 6 && a[1] == 1);
+    even *= b;
+    assert(a[0] == 4 && a[4] == 12);
+    even /= b;
+    assert(a[0] == 2 && a[4] == 6);
+    even -= b;
+    assert(a[0] == 0 && a[2] == 2 && a[4] == 4);
+
+    // With views.
+    odd /= odd;
+    assert(a[1] == 1 && a[3] == 1 && a[5] == 1);
+    even += odd;
+    assert(a[0] == 1 && a[2] == 3 && a[4] == 5);
+
+    // A zero divisor leaves the entries untouched.
+    bool thrown = false;
+    NVector::NVector<double> zeros(3, [](size_t i){ return (double) i; });
+    try { even /= zeros; } catch(...) { thrown = true; }
+    assert(thrown && a[0] == 1 && a[2] == 3 && a[4] == 5);
+
+    // The reads keep the cached norm, the writes invalidate it.
+    NVector::NVector<double> c(4, 3.0);
+    assert(c.norm() == 6);
+    Views::NVectorView<double> all(c, Views::Slice(0, 4, 1));
+    assert(all.dotProduct(c) == 36 && c.norm() == 6);
+    all *= c;
+    assert(c.norm() == 18);
+}
+
+
+/**
+ * Checks the views of the vectors of NVectors, their slices that are built
+ * without copies, and their compound assignments.
+*/
+void testMatrix()
+{
+    // Auxiliary variables.
+    VNVectors::VNVectors<double> v(4, 6, [](size_t i, size_t j){
+        return (double) (10 * i + j);
+    });
+    Views::VNVectorsView<double> rows(
+        v, Views::Slice(0, 6, 2), Views::Slice(1, 4, 2)
+    );
+
+    // Indexes, sizes and slices of slices.
+    assert(rows.size() == 3 && rows.dimensions() == 2);
+    assert(rows[1][0] == 21 && rows[2][1] == 43);
+    Views::VNVectorsView<double> inner =
+        rows.slice(Views::Slice(1, 3, 1), Views::Slice(1, 2, 1));
+    assert(inner.size() == 2 && inner.dimensions() == 1);
+    assert(inner[0][0] == 23 && inner[1][0] == 43);
+
+    // With NVectors and with views.
+    NVector::NVector<double> twos(2, 2.0);
+    rows *= twos;
+    assert(v[2][1] == 42 && v[2][3] == 46 && v[2][0] == 20 && v[1][1] == 11);
+    rows /= twos;
+    assert(v[2][1] == 21);
+    Views::VNVectorsView<double> others(
+        v, Views::Slice(1, 6, 2), Views::Slice(1, 4, 2)
+    );
+    rows -= others;
+    assert(v[0][1] == -10 && v[2][3] == -10 && v[4][1] == -10);
+    rows += others;
+    assert(v[4][1] == 41);
+
+    // The sizes must agree, and a zero divisor leaves the entries untouched.
+    bool thrown = false;
+    try { rows += inner; } catch(...) { thrown = true; }
+    assert(thrown);
+    thrown = false;
+    NVector::NVector<double> zeros(2, 0.0);
+    try { rows /= zeros; } catch(...) { thrown = true; }
+    assert(thrown && v[4][1] == 41);
+
+    // Copies and printing.
+    VNVectors::VNVectors<double> copy = inner.materialize();
+    assert(copy.size() == 2 && copy[1][0] == 43);
+    std::ostringstream out;
+    out << inner;
+    assert(out.str() == "(23)\n(43)\n");
+
+    // Empty.
+    Views::VNVectorsView<double> empty(
+        v, Views::Slice(9, 12, 1), Views::Slice(0, 4, 1)
+    );
+    assert(empty.size() == 0 && empty.materialize().size() == 0);
+}
+
+
+/**
+ * Checks the views of the NVectors, their slices, their copies and their
+ * results.
+*/
+void testVector()
+{
+    // Auxiliary variables.
+    NVector::NVector<double> a(10, [](size_t i){ return (double) i; });
+    Views::NVectorView<double> view(a, Views::Slice(1, 10, 3));
+
+    // Indexes, sizes and slices of slices.
+    assert(view.size() == 3 && view[0] == 1 && view[2] == 7);
+    assert(view.normSquared() == 66);
+    Views::NVectorView<double> inner = view.slice(Views::Slice(1, 5, 1));
+    assert(inner.size() == 2 && inner[0] == 4 && inner[1] == 7);
+
+    // Scalars, and results that do not change the viewed NVector.
+    view += 1.0;
+    assert(a[1] == 2 && a[4] == 5 && a[2] == 2);
+    view -= 1.0;
+    NVector::NVector<double> sum = view + 1.0;
+    assert(sum[2] == 8 && a[7] == 7);
+    assert(view.materialize()[1] == 4);
+
+    // Printing, and empty slices.
+    std::ostringstream out;
+    out << view;
+    assert(out.str() == "(1, 4, 7)");
+    assert(Views::NVectorView<double>(a, Views::Slice(20, 30, 1)).size() == 0);
+}
+
+
+//##############################################################################
+// Main Function
+//##############################################################################
+
+
+int main()
+{
+    testCompound();
+    testMatrix();
+    testVector();
+
+    std::cout << "Views tests passed." << std::endl;
+
+    return 0;
+}
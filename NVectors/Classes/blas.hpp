@@ -0,0 +1,603 @@
+/*
+    File that contains the level 1 functions of BLAS, i.e., the vector-vector
+    operations, for the NVectors and, row by row, for the vectors of NVectors.
+*/
+#pragma once
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+
+// User defined.
+#include "./Headers/Math/mathApproximations.hpp"
+#include "./Headers/Validation/validationGeneral.hpp"
+#include "./nvectors.hpp"
+#include "./ufuncs.hpp"
+#include "./vnvectors.hpp"
+
+
+//##############################################################################
+// Namespaces
+//##############################################################################
+
+
+namespace Blas
+{
+    //##########################################################################
+    // Variables
+    //##########################################################################
+
+
+    // Number of independent partial sums used by the reductions, such that
+    // the compiler can vectorize them without reordering the additions.
+    constexpr size_t lanes{8};
+
+
+    //##########################################################################
+    // Types
+    //##########################################################################
+
+
+    /**
+     * Type with which the reductions of the NVectors of the vectors of
+     * NVectors are accumulated: the accumulation type of the rows, widened to
+     * at least double precision, such that the single precision rows give
+     * the same results as NVector<float, double>.
+    */
+    template <typename T>
+    using RowAccumulator = std::common_type_t<
+        typename NVector::NVector<T>::accumulator_type, double
+    >;
+
+
+    //##########################################################################
+    // Functions
+    //##########################################################################
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Auxiliary Functions
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    /**
+     * Returns the sum of the partial sums of the reductions.
+     * 
+     * @param partial The partial sums.
+     * 
+     * @return The sum of the partial sums.
+    */
+    template <typename A>
+    A sumLanes(const A (&partial)[lanes]) noexcept
+    {
+        // Auxiliary variables.
+        A sum = (A) 0;
+
+        for(size_t l = 0; l < lanes; ++l) sum += partial[l];
+
+        return sum;
+    }
+
+
+    /**
+     * Returns the sum of the absolute values of the given entries.
+     * 
+     * @param entries The entries to be added.
+     * 
+     * @param size The number of entries.
+     * 
+     * @return The sum of the absolute values, accumulated with the
+     * accumulation type.
+    */
+    template <typename T, typename A>
+    A asumKernel(const T* entries, size_t size) noexcept
+    {
+        // Auxiliary variables.
+        A partial[lanes] = {};
+        size_t blocks = size - size % lanes;
+
+        for(size_t i = 0; i < blocks; i += lanes)
+            for(size_t l = 0; l < lanes; ++l)
+                partial[l] += std::abs((A) entries[i + l]);
+
+        for(size_t i = blocks; i < size; ++i)
+            partial[0] += std::abs((A) entries[i]);
+
+        return sumLanes(partial);
+    }
+
+
+    /**
+     * Returns the index of the first entry with the largest absolute value;
+     * zero, if there are no entries.
+     * 
+     * @param entries The entries to be searched.
+     * 
+     * @param size The number of entries.
+     * 
+     * @return The index of the first entry with the largest absolute value.
+    */
+    template <typename T, typename A>
+    size_t iamaxKernel(const T* entries, size_t size) noexcept
+    {
+        // Auxiliary variables.
+        size_t index = 0;
+        A largest = size > 0 ? std::abs((A) entries[0]) : (A) 0;
+
+        for(size_t i = 1; i < size; ++i)
+        {
+            A value = std::abs((A) entries[i]);
+            index = value > largest ? i : index;
+            largest = value > largest ? value : largest;
+        }
+
+        return index;
+    }
+
+
+    /**
+     * Returns the sum of the squares of the given entries, each one scaled by
+     * the given factor first.
+     * 
+     * @param entries The entries to be added.
+     * 
+     * @param size The number of entries.
+     * 
+     * @param scale The factor by which each entry is scaled.
+     * 
+     * @return The sum of the scaled squares, accumulated with the
+     * accumulation type.
+    */
+    template <typename T, typename A>
+    A sumSquaresKernel(const T* entries, size_t size, A scale) noexcept
+    {
+        // Auxiliary variables.
+        A partial[lanes] = {};
+        size_t blocks = size - size % lanes;
+
+        for(size_t i = 0; i < blocks; i += lanes)
+            for(size_t l = 0; l < lanes; ++l)
+            {
+                A value = (A) entries[i + l] * scale;
+                partial[l] = MathApproximations::multiplyAdd(
+                    value, value, partial[l]
+                );
+            }
+
+        for(size_t i = blocks; i < size; ++i)
+        {
+            A value = (A) entries[i] * scale;
+            partial[0] = MathApproximations::multiplyAdd(
+                value, value, partial[0]
+            );
+        }
+
+        return sumLanes(partial);
+    }
+
+
+    /**
+     * Returns the L2 norm of the given entries, without overflow nor
+     * underflow. The squares are added directly, which is exact enough when
+     * the sum is in the normal range; otherwise, the entries are scaled by a
+     * power of two, such that the scaling does not round, and added again.
+     * 
+     * @param entries The entries whose norm is to be determined.
+     * 
+     * @param size The number of entries.
+     * 
+     * @return The L2 norm, computed with the accumulation type.
+    */
+    template <typename T, typename A>
+    A nrm2Kernel(const T* entries, size_t size) noexcept
+    {
+        // Auxiliary variables.
+        A sum = sumSquaresKernel<T, A>(entries, size, (A) 1);
+
+        // The integer types can not be scaled.
+        if constexpr(!std::is_floating_point<A>::value)
+            return (A) std::sqrt(sum);
+        else
+        {
+            // Auxiliary variables.
+            constexpr A tiny = std::numeric_limits<A>::min() /
+                std::numeric_limits<A>::epsilon();
+            constexpr A infinity = std::numeric_limits<A>::infinity();
+
+            // The fast path, the not a number entries are propagated.
+            if((sum >= tiny && sum < infinity) || sum != sum || size == 0)
+                return std::sqrt(sum);
+
+            // Scale by the power of two of the largest entry.
+            A largest = std::abs(
+                (A) entries[iamaxKernel<T, A>(entries, size)]
+            );
+            if(largest == (A) 0 || largest == infinity) return largest;
+
+            int exponent = std::ilogb(largest);
+            sum = sumSquaresKernel<T, A>(
+                entries, size, std::ldexp((A) 1, -exponent)
+            );
+
+            return std::ldexp(std::sqrt(sum), exponent);
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // NVector Functions
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    /**
+     * Returns the sum of the absolute values of the entries of the NVector,
+     * i.e., its L1 norm.
+     * 
+     * @param vector The NVector whose entries are to be added.
+     * 
+     * @return The sum of the absolute values of the entries.
+    */
+    template <typename T, typename A>
+    A asum(const NVector::NVector<T, A>& vector)
+    {
+        return asumKernel<T, A>(vector.data(), vector.size());
+    }
+
+
+    /**
+     * Computes y = alpha * x + beta * y, in a single pass over the NVectors.
+     * 
+     * @param alpha The factor of the first NVector.
+     * 
+     * @param vector_x The first NVector.
+     * 
+     * @param beta The factor of the second NVector.
+     * 
+     * @param vector_y The second NVector, where the results will be stored.
+    */
+    template <typename T, typename A>
+    void axpby(
+        T alpha, NVector::NVector<T, A>& vector_x, T beta,
+        NVector::NVector<T, A>& vector_y
+    )
+    {
+        UFuncs::map(vector_x, vector_y, vector_y, [alpha, beta](T x, T y)
+        {
+            return (T) MathApproximations::multiplyAdd(
+                (A) alpha, (A) x, (A) beta * (A) y
+            );
+        });
+    }
+
+
+    /**
+     * Computes y = alpha * x + y, in a single pass over the NVectors.
+     * 
+     * @param alpha The factor of the first NVector.
+     * 
+     * @param vector_x The first NVector.
+     * 
+     * @param vector_y The second NVector, where the results will be stored.
+    */
+    template <typename T, typename A>
+    void axpy(
+        T alpha, NVector::NVector<T, A>& vector_x,
+        NVector::NVector<T, A>& vector_y
+    )
+    {
+        UFuncs::map(vector_x, vector_y, vector_y, [alpha](T x, T y)
+        {
+            return (T) MathApproximations::multiplyAdd(
+                (A) alpha, (A) x, (A) y
+            );
+        });
+    }
+
+
+    /**
+     * Returns the index of the first entry of the NVector with the largest
+     * absolute value.
+     * 
+     * @param vector The NVector to be searched.
+     * 
+     * @return The index of the first entry with the largest absolute value.
+    */
+    template <typename T, typename A>
+    size_t iamax(const NVector::NVector<T, A>& vector)
+    {
+        return iamaxKernel<T, A>(vector.data(), vector.size());
+    }
+
+
+    /**
+     * Returns the L2 norm of the NVector, without the overflow nor the
+     * underflow of the squares of its entries.
+     * 
+     * @param vector The NVector whose norm is to be determined.
+     * 
+     * @return The L2 norm of the NVector.
+    */
+    template <typename T, typename A>
+    A nrm2(const NVector::NVector<T, A>& vector)
+    {
+        return nrm2Kernel<T, A>(vector.data(), vector.size());
+    }
+
+
+    /**
+     * Computes x = alpha * x.
+     * 
+     * @param alpha The factor of the NVector.
+     * 
+     * @param vector_x The NVector to be scaled.
+    */
+    template <typename T, typename A>
+    void scal(T alpha, NVector::NVector<T, A>& vector_x)
+    {
+        UFuncs::map(vector_x, vector_x, [alpha](T x)
+        {
+            return (T) ((A) alpha * (A) x);
+        });
+    }
+
+
+    /**
+     * Exchanges the entries of the NVectors.
+     * 
+     * @param vector_x The first NVector.
+     * 
+     * @param vector_y The second NVector.
+    */
+    template <typename T, typename A>
+    void swap(
+        NVector::NVector<T, A>& vector_x, NVector::NVector<T, A>& vector_y
+    )
+    {
+        // Validate the dimensions.
+        ValidationGeneral::validateDimensions(
+            vector_x.size(), vector_y.size(), true
+        );
+
+        // Auxiliary variables.
+        T* x = vector_x.data();
+        T* y = vector_y.data();
+
+        for(size_t i = 0; i < vector_x.size(); ++i) std::swap(x[i], y[i]);
+    }
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Vector of NVectors Functions
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    /**
+     * Returns the sum of the absolute values of the entries of each of the
+     * NVectors of the vector of NVectors, accumulated with RowAccumulator.
+     * 
+     * @param vector The vector of NVectors whose rows are to be added.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+     * 
+     * @return The NVector with the sum of each of the NVectors.
+    */
+    template <typename T>
+    NVector::NVector<T> asum(
+        const VNVectors::VNVectors<T>& vector, bool parallel
+    )
+    {
+        // Auxiliary variables.
+        NVector::NVector<T> result(vector.size(), NVector::uninitialized);
+        std::vector<const T*> x = UFuncs::rows(vector);
+        size_t dimension = vector.dimensions();
+        T* r = result.data();
+
+        UFuncs::forRows(vector, parallel, [&](size_t first, size_t last)
+        {
+            for(size_t i = first; i < last; ++i)
+                r[i] = (T) asumKernel<T, RowAccumulator<T>>(x[i], dimension);
+        });
+
+        return result;
+    }
+
+
+    /**
+     * Computes y = alpha * x + beta * y, for each pair of NVectors of the
+     * vectors of NVectors, in a single pass over them; computed with
+     * RowAccumulator.
+     * 
+     * @param alpha The factor of the first vector of NVectors.
+     * 
+     * @param vector_x The first vector of NVectors.
+     * 
+     * @param beta The factor of the second vector of NVectors.
+     * 
+     * @param vector_y The second vector of NVectors, where the results will
+     * be stored.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void axpby(
+        T alpha, VNVectors::VNVectors<T>& vector_x, T beta,
+        VNVectors::VNVectors<T>& vector_y, bool parallel
+    )
+    {
+        // Auxiliary variables.
+        using A = RowAccumulator<T>;
+
+        UFuncs::map(vector_x, vector_y, vector_y, [alpha, beta](T x, T y)
+        {
+            return (T) MathApproximations::multiplyAdd(
+                (A) alpha, (A) x, (A) beta * (A) y
+            );
+        }, parallel);
+    }
+
+
+    /**
+     * Computes y = alpha * x + y, for each pair of NVectors of the vectors of
+     * NVectors, in a single pass over them; computed with RowAccumulator.
+     * 
+     * @param alpha The factor of the first vector of NVectors.
+     * 
+     * @param vector_x The first vector of NVectors.
+     * 
+     * @param vector_y The second vector of NVectors, where the results will
+     * be stored.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void axpy(
+        T alpha, VNVectors::VNVectors<T>& vector_x,
+        VNVectors::VNVectors<T>& vector_y, bool parallel
+    )
+    {
+        // Auxiliary variables.
+        using A = RowAccumulator<T>;
+
+        UFuncs::map(vector_x, vector_y, vector_y, [alpha](T x, T y)
+        {
+            return (T) MathApproximations::multiplyAdd(
+                (A) alpha, (A) x, (A) y
+            );
+        }, parallel);
+    }
+
+
+    /**
+     * Returns the index of the first entry with the largest absolute value
+     * of each of the NVectors of the vector of NVectors; compared with
+     * RowAccumulator.
+     * 
+     * @param vector The vector of NVectors whose rows are to be searched.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+     * 
+     * @return The index of the largest entry of each of the NVectors.
+    */
+    template <typename T>
+    std::vector<size_t> iamax(
+        const VNVectors::VNVectors<T>& vector, bool parallel
+    )
+    {
+        // Auxiliary variables.
+        std::vector<size_t> result(vector.size());
+        std::vector<const T*> x = UFuncs::rows(vector);
+        size_t dimension = vector.dimensions();
+
+        UFuncs::forRows(vector, parallel, [&](size_t first, size_t last)
+        {
+            for(size_t i = first; i < last; ++i)
+                result[i] = iamaxKernel<T, RowAccumulator<T>>(x[i], dimension);
+        });
+
+        return result;
+    }
+
+
+    /**
+     * Returns the L2 norm of each of the NVectors of the vector of NVectors,
+     * without the overflow nor the underflow of the squares of their entries;
+     * accumulated with RowAccumulator.
+     * 
+     * @param vector The vector of NVectors whose norms are to be determined.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+     * 
+     * @return The NVector with the norm of each of the NVectors.
+    */
+    template <typename T>
+    NVector::NVector<T> nrm2(
+        const VNVectors::VNVectors<T>& vector, bool parallel
+    )
+    {
+        // Auxiliary variables.
+        NVector::NVector<T> result(vector.size(), NVector::uninitialized);
+        std::vector<const T*> x = UFuncs::rows(vector);
+        size_t dimension = vector.dimensions();
+        T* r = result.data();
+
+        UFuncs::forRows(vector, parallel, [&](size_t first, size_t last)
+        {
+            for(size_t i = first; i < last; ++i)
+                r[i] = (T) nrm2Kernel<T, RowAccumulator<T>>(x[i], dimension);
+        });
+
+        return result;
+    }
+
+
+    /**
+     * Computes x = alpha * x, for each of the NVectors of the vector of
+     * NVectors; computed with RowAccumulator.
+     * 
+     * @param alpha The factor of the vector of NVectors.
+     * 
+     * @param vector_x The vector of NVectors to be scaled.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void scal(T alpha, VNVectors::VNVectors<T>& vector_x, bool parallel)
+    {
+        // Auxiliary variables.
+        using A = RowAccumulator<T>;
+
+        UFuncs::map(vector_x, vector_x, [alpha](T x)
+        {
+            return (T) ((A) alpha * (A) x);
+        }, parallel);
+    }
+
+
+    /**
+     * Exchanges the entries of each pair of NVectors of the vectors of
+     * NVectors.
+     * 
+     * @param vector_x The first vector of NVectors.
+     * 
+     * @param vector_y The second vector of NVectors.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void swap(
+        VNVectors::VNVectors<T>& vector_x, VNVectors::VNVectors<T>& vector_y,
+        bool parallel
+    )
+    {
+        // Validate the dimensions and the sizes.
+        UFuncs::validateShapes(vector_x, vector_y);
+
+        // Auxiliary variables.
+        std::vector<T*> x = UFuncs::rows(vector_x);
+        std::vector<T*> y = UFuncs::rows(vector_y);
+        size_t dimension = vector_x.dimensions();
+
+        UFuncs::forRows(vector_x, parallel, [&](size_t first, size_t last)
+        {
+            for(size_t i = first; i < last; ++i)
+                for(size_t j = 0; j < dimension; ++j)
+                    std::swap(x[i][j], y[i][j]);
+        });
+    }
+}
@@ -0,0 +1,37 @@
+
+# Compiler and archiver; the archiver must keep the link time optimization
+# information, i.e., gcc-ar for GCC and llvm-ar for Clang.
+$cxx = if ($env:CXX) { $env:CXX } else { "g++" }
+if ($env:AR) { $ar = $env:AR }
+elseif ((& $cxx --version | Out-String) -match "clang") { $ar = "llvm-ar" }
+else { $ar = "gcc-ar" }
+
+# Extra flags, opt-in, which the programs linked with the library must also
+# use, e.g., $env:CXXFLAGS = "-march=native" or "-mfma" enables the fused
+# multiply-add of the compensated products when the hardware has one.
+$flags = if ($env:CXXFLAGS) { $env:CXXFLAGS -split " " } else { @() }
+
+# Create the directory of the library.
+New-Item -ItemType Directory -Force -Path Build | Out-Null
+
+# Compile each implementation, optimized and with the intermediate code for
+# link time optimization. The headers declare non-template functions that are
+# only defined here, e.g., the thread counts, the hashes and the compression,
+# so every program must link this library, with or without
+# NVECTORS_USE_LIBRARY; or compile these files along with it.
+$files = @(
+    "./Implementations/Compression/compressionGeneral.cpp",
+    "./Implementations/Hashing/hashingGeneral.cpp",
+    "./Implementations/Instantiations/instantiationsVectors.cpp",
+    "./Implementations/Parallel/parallelGeneral.cpp",
+    "./Implementations/Validation/validationGeneral.cpp"
+)
+foreach ($file in $files) {
+    $name = [System.IO.Path]::GetFileNameWithoutExtension($file)
+    & $cxx -std=c++17 -O2 -flto -pthread @flags -c -o "./Build/$name.o" $file
+    if ($LASTEXITCODE -ne 0) { exit 1 }
+}
+
+# Archive the library.
+Remove-Item -ErrorAction Ignore ./Build/libnvectors.a
+& $ar rcs ./Build/libnvectors.a (Get-ChildItem ./Build/*.o)
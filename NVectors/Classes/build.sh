@@ -0,0 +1,38 @@
+#!/bin/bash
+
+# Compiler and archiver; the archiver must keep the link time optimization
+# information, i.e., gcc-ar for GCC and llvm-ar for Clang.
+CXX=${CXX:-c++}
+if "$CXX" --version 2>/dev/null | grep -qi clang; then
+    AR=${AR:-llvm-ar}
+else
+    AR=${AR:-gcc-ar}
+fi
+
+# Extra flags, opt-in, which the programs linked with the library must also
+# use, e.g., CXXFLAGS="-march=native" or "-mfma" enables the fused
+# multiply-add of the compensated products when the hardware has one.
+CXXFLAGS=${CXXFLAGS:-}
+
+# Create the directory of the library.
+mkdir -p Build
+
+# Compile each implementation, optimized and with the intermediate code for
+# link time optimization. The headers declare non-template functions that are
+# only defined here, e.g., the thread counts, the hashes and the compression,
+# so every program must link this library, with or without
+# NVECTORS_USE_LIBRARY; or compile these files along with it.
+for file in \
+    ./Implementations/Compression/compressionGeneral.cpp \
+    ./Implementations/Hashing/hashingGeneral.cpp \
+    ./Implementations/Instantiations/instantiationsVectors.cpp \
+    ./Implementations/Parallel/parallelGeneral.cpp \
+    ./Implementations/Validation/validationGeneral.cpp
+do
+    "$CXX" -std=c++17 -O2 -flto -pthread $CXXFLAGS -c -o \
+        "./Build/$(basename "$file" .cpp).o" "$file" || exit 1
+done
+
+# Archive the library.
+rm -f ./Build/libnvectors.a
+"$AR" rcs ./Build/libnvectors.a ./Build/*.o
@@ -0,0 +1,1013 @@
+/*
+    File that contains the streaming covariance of the vectors of NVectors and
+    the principal component analysis built on top of it.
+*/
+#pragma once
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+// User defined.
+#include "./Headers/Parallel/parallelGeneral.hpp"
+#include "./Headers/Validation/validationGeneral.hpp"
+#include "./Headers/Validation/validationNumerical.hpp"
+#include "./nvectors.hpp"
+#include "./ufuncs.hpp"
+#include "./vnvectors.hpp"
+
+
+//##############################################################################
+// Namespaces
+//##############################################################################
+
+
+namespace Covariance
+{
+    //##########################################################################
+    // Classes
+    //##########################################################################
+
+
+    /**
+     * Class that accumulates the mean and the covariance of a stream of
+     * NVectors in a single pass. The NVectors are added by blocks: the
+     * scatter of each block around its own mean is a rank-k update, and the
+     * block is merged with the formula of Chan et al., which is Welford's
+     * update for blocks of one NVector; two accumulators of the same
+     * dimension can be merged the same way, e.g., one per thread or per
+     * chunk of a file.
+    */
+    template <typename T>
+    class Covariance
+    {
+        public:
+        //######################################################################
+        // Types
+        //######################################################################
+
+
+        // Type with which the moments are accumulated; at least double
+        // precision, such that millions of NVectors can be added.
+        typedef std::conditional_t<(sizeof(T) < sizeof(double)), double, T> Sum;
+
+
+        //######################################################################
+        // Constructor(s) and Destructor(s)
+        //######################################################################
+
+
+        /**
+         * Constructs a new, empty, covariance accumulator.
+         * 
+         * @param dimensions The number of entries of the NVectors; must be
+         * greater than zero.
+        */
+        explicit Covariance(size_t dimensions) :
+        dimension{dimensions}
+        {
+            // Validate the quantities.
+            ValidationNumerical::rangeGreater<size_t>(0, dimension, true);
+            ValidationNumerical::isFloating<T>((T) 1, true);
+
+            // Create with the exact number of entries.
+            means.assign(dimension, (Sum) 0);
+            scatter.assign(dimension * dimension, (Sum) 0);
+        }
+
+
+        /**
+         * Destructs the given object pointer.
+        */
+        ~Covariance(){}
+
+
+        //######################################################################
+        // Functions
+        //######################################################################
+
+
+        ////////////////////////////////////////////////////////////////////////
+        // Non-Template Functions
+        ////////////////////////////////////////////////////////////////////////
+
+
+        /**
+         * Returns the number of NVectors added so far.
+         * 
+         * @return The number of NVectors added so far.
+        */
+        size_t count()
+        {
+            return vcount;
+        }
+
+
+        /**
+         * Returns the number of entries of the NVectors.
+         * 
+         * @return The number of entries of the NVectors.
+        */
+        size_t dimensions()
+        {
+            return dimension;
+        }
+
+
+        ////////////////////////////////////////////////////////////////////////
+        // Template Functions
+        ////////////////////////////////////////////////////////////////////////
+
+
+        /**
+         * Adds the given NVector, i.e., Welford's update.
+         * 
+         * @param vector The NVector to be added.
+        */
+        void add(NVector::NVector<T>& vector)
+        {
+            // Validate the dimensions.
+            ValidationGeneral::validateDimensions(
+                dimension, vector.size(), true
+            );
+
+            // Auxiliary variables.
+            const T* row = vector.data();
+            std::vector<Sum> buffer(dimension);
+
+            addBlock(&row, 1, buffer);
+        }
+
+
+        /**
+         * Adds the NVectors of the given vector of NVectors, by blocks; with
+         * several threads, each one accumulates its own part, and the parts
+         * are merged in order.
+         * 
+         * @param vectors The vector of NVectors to be added.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+        */
+        void add(VNVectors::VNVectors<T>& vectors, bool parallel)
+        {
+            // Validate the dimensions.
+            ValidationGeneral::validateDimensions(
+                dimension, vectors.dimensions(), true
+            );
+
+            // Auxiliary variables.
+            std::vector<T*> rows = UFuncs::rows(vectors);
+            std::vector<std::pair<size_t, Covariance<T>>> partials;
+            std::mutex lock;
+
+            auto function = [&](size_t first, size_t last)
+            {
+                Covariance<T> partial(dimension);
+                std::vector<Sum> buffer(blockRows * dimension);
+
+                for(size_t i = first; i < last; i += blockRows)
+                    partial.addBlock(
+                        rows.data() + i, std::min(blockRows, last - i), buffer
+                    );
+
+                std::lock_guard<std::mutex> guard(lock);
+                partials.emplace_back(first, std::move(partial));
+            };
+
+            if(parallel)
+                ParallelGeneral::parallelFor(
+                    0, rows.size(), parallelGrain, function
+                );
+            else
+                function(0, rows.size());
+
+            // Merge in a fixed order.
+            std::sort(
+                partials.begin(), partials.end(),
+                [](const auto& a, const auto& b){ return a.first < b.first; }
+            );
+
+            for(auto& partial : partials) merge(partial.second);
+        }
+
+
+        /**
+         * Returns the covariance matrix of the NVectors added so far.
+         * 
+         * @param sample True, if the sample covariance, divided by n - 1, is
+         * to be returned; False, if the population one, divided by n.
+         * 
+         * @return The vector of NVectors with the covariance matrix.
+        */
+        VNVectors::VNVectors<T> covariance(bool sample)
+        {
+            // Validate there are enough NVectors.
+            ValidationNumerical::rangeGreater<size_t>(
+                sample ? 1 : 0, vcount, true
+            );
+
+            // Auxiliary variables.
+            Sum divisor = (Sum) (sample ? vcount - 1 : vcount);
+
+            // Only the upper triangle is accumulated.
+            return VNVectors::VNVectors<T>(
+                dimension, dimension, [&](size_t i, size_t j)
+                {
+                    size_t index = i <= j ? i * dimension + j :
+                        j * dimension + i;
+                    return (T) (scatter[index] / divisor);
+                }
+            );
+        }
+
+
+        /**
+         * Returns the mean of the NVectors added so far.
+         * 
+         * @return The mean of the NVectors.
+        */
+        NVector::NVector<T> mean()
+        {
+            return NVector::NVector<T>(dimension, [this](size_t i)
+            {
+                return (T) means[i];
+            });
+        }
+
+
+        /**
+         * Merges the moments of the given accumulator into this one, as if
+         * its NVectors had been added here.
+         * 
+         * @param other The accumulator to be merged; it must have the same
+         * dimension.
+        */
+        void merge(Covariance<T>& other)
+        {
+            // Validate the dimensions.
+            ValidationGeneral::validateDimensions(
+                dimension, other.dimensions(), true
+            );
+
+            for(size_t i = 0; i < dimension * dimension; ++i)
+                scatter[i] += other.scatter[i];
+
+            mergeMoments(other.vcount, other.means.data());
+        }
+
+
+        private:
+        //######################################################################
+        // Functions
+        //######################################################################
+
+
+        /**
+         * Adds a block of NVectors: their scatter around the block mean is
+         * added to the upper triangle as a rank-k update, and the means are
+         * merged afterwards.
+         * 
+         * @param rows The pointers to the entries of the NVectors.
+         * 
+         * @param count The number of NVectors in the block.
+         * 
+         * @param buffer The buffer of, at least, count * dimension entries
+         * where the centered NVectors are stored.
+        */
+        void addBlock(
+            const T* const* rows, size_t count, std::vector<Sum>& buffer
+        ) noexcept
+        {
+            // Auxiliary variables.
+            std::vector<Sum> center(dimension, (Sum) 0);
+
+            // The mean of the block.
+            for(size_t r = 0; r < count; ++r)
+                for(size_t j = 0; j < dimension; ++j)
+                    center[j] += (Sum) rows[r][j];
+            for(size_t j = 0; j < dimension; ++j) center[j] /= (Sum) count;
+
+            // The block centered on its mean; a single NVector adds nothing.
+            if(count > 1)
+            {
+                for(size_t r = 0; r < count; ++r)
+                    for(size_t j = 0; j < dimension; ++j)
+                        buffer[r * dimension + j] =
+                            (Sum) rows[r][j] - center[j];
+
+                // The rank-k update, by rows of the scatter, such that each
+                // row is reused for the whole block.
+                for(size_t i = 0; i < dimension; ++i)
+                {
+                    Sum* output = scatter.data() + i * dimension;
+                    for(size_t r = 0; r < count; ++r)
+                    {
+                        const Sum* entries = buffer.data() + r * dimension;
+                        Sum value = entries[i];
+                        for(size_t j = i; j < dimension; ++j)
+                            output[j] += value * entries[j];
+                    }
+                }
+            }
+
+            mergeMoments(count, center.data());
+        }
+
+
+        /**
+         * Merges the count and the mean of another group of NVectors, and
+         * the scatter due to the difference between the means; the scatter
+         * of the other group around its own mean must be added apart.
+         * 
+         * @param count The number of NVectors of the other group.
+         * 
+         * @param center The mean of the other group.
+        */
+        void mergeMoments(size_t count, const Sum* center) noexcept
+        {
+            if(count == 0) return;
+
+            // Auxiliary variables.
+            Sum total = (Sum) (vcount + count);
+            Sum weight = (Sum) count / total;
+            Sum factor = (Sum) vcount * weight;
+            std::vector<Sum> delta(dimension);
+
+            for(size_t j = 0; j < dimension; ++j)
+                delta[j] = center[j] - means[j];
+
+            for(size_t i = 0; i < dimension; ++i)
+            {
+                Sum* output = scatter.data() + i * dimension;
+                Sum value = delta[i] * factor;
+                for(size_t j = i; j < dimension; ++j)
+                    output[j] += value * delta[j];
+            }
+
+            for(size_t j = 0; j < dimension; ++j)
+                means[j] += delta[j] * weight;
+
+            vcount += count;
+        }
+
+
+        //######################################################################
+        // Variables
+        //######################################################################
+
+
+        // Number of NVectors of each rank-k update.
+        static constexpr size_t blockRows{256};
+
+
+        // Minimum number of NVectors that each thread must process.
+        static constexpr size_t parallelGrain{4096};
+
+
+        // Mean of the NVectors added so far.
+        std::vector<Sum> means;
+
+
+        // Sum of the outer products of the NVectors around their mean; only
+        // the upper triangle is kept.
+        std::vector<Sum> scatter;
+
+
+        // Size of the NVectors.
+        size_t dimension{0};
+
+
+        // Number of NVectors added so far.
+        size_t vcount{0};
+    };
+
+
+    /**
+     * Class with the principal components of a covariance matrix, i.e., its
+     * eigenvectors with the largest eigenvalues. Up to jacobiLimit
+     * dimensions, all the eigenvectors are computed with the Jacobi method;
+     * above it, only the requested ones, and a few more, with the subspace
+     * iteration.
+    */
+    template <typename T>
+    class PCA
+    {
+        public:
+        //######################################################################
+        // Types
+        //######################################################################
+
+
+        // Type with which the eigenvectors are computed.
+        typedef typename Covariance<T>::Sum Sum;
+
+
+        //######################################################################
+        // Constructor(s) and Destructor(s)
+        //######################################################################
+
+
+        /**
+         * Constructs the principal components of the NVectors added to the
+         * given accumulator.
+         * 
+         * @param covariance The accumulator of the NVectors.
+         * 
+         * @param components The number of principal components; must be
+         * greater than zero and not greater than the dimension.
+         * 
+         * @param sample True, if the variances are those of the sample
+         * covariance; False, if those of the population one.
+        */
+        PCA(Covariance<T>& covariance, size_t components, bool sample) :
+        dimension{covariance.dimensions()},
+        k{components}
+        {
+            // Validate the quantities.
+            ValidationNumerical::rangeGreater<size_t>(0, k, true);
+            ValidationGeneral::validateInRange(k, 1, dimension, true);
+
+            // Auxiliary variables.
+            VNVectors::VNVectors<T> matrix = covariance.covariance(sample);
+            NVector::NVector<T> center = covariance.mean();
+            std::vector<Sum> a(dimension * dimension);
+            std::vector<Sum> values, vectors;
+
+            for(size_t i = 0; i < dimension; ++i)
+                for(size_t j = 0; j < dimension; ++j)
+                    a[i * dimension + j] = (Sum) matrix[i][j];
+
+            if(dimension <= jacobiLimit)
+                jacobi(a, dimension, values, vectors);
+            else
+                subspace(a, values, vectors);
+
+            // Keep the requested components, by rows.
+            size_t columns = values.size();
+            means = std::vector<T>(center.data(), center.data() + dimension);
+            variancesValues.resize(k);
+            axes.resize(k * dimension);
+            for(size_t c = 0; c < k; ++c)
+            {
+                // The largest entry of each component is positive.
+                Sum largest = (Sum) 0;
+                for(size_t j = 0; j < dimension; ++j)
+                {
+                    Sum value = vectors[j * columns + c];
+                    largest = std::abs(value) > std::abs(largest) ?
+                        value : largest;
+                }
+
+                Sum sign = largest < (Sum) 0 ? (Sum) -1 : (Sum) 1;
+                for(size_t j = 0; j < dimension; ++j)
+                    axes[c * dimension + j] =
+                        (T) (sign * vectors[j * columns + c]);
+
+                variancesValues[c] = (T) std::max(values[c], (Sum) 0);
+            }
+        }
+
+
+        /**
+         * Destructs the given object pointer.
+        */
+        ~PCA(){}
+
+
+        //######################################################################
+        // Functions
+        //######################################################################
+
+
+        ////////////////////////////////////////////////////////////////////////
+        // Non-Template Functions
+        ////////////////////////////////////////////////////////////////////////
+
+
+        /**
+         * Returns the number of entries of the original NVectors.
+         * 
+         * @return The number of entries of the original NVectors.
+        */
+        size_t dimensions()
+        {
+            return dimension;
+        }
+
+
+        /**
+         * Returns the number of principal components.
+         * 
+         * @return The number of principal components.
+        */
+        size_t size()
+        {
+            return k;
+        }
+
+
+        ////////////////////////////////////////////////////////////////////////
+        // Template Functions
+        ////////////////////////////////////////////////////////////////////////
+
+
+        /**
+         * Returns the principal components, from the largest variance to the
+         * smallest one.
+         * 
+         * @return The vector of NVectors with the unit principal components.
+        */
+        VNVectors::VNVectors<T> components()
+        {
+            return VNVectors::VNVectors<T>(
+                dimension, k, [this](size_t i, size_t j)
+                {
+                    return axes[i * dimension + j];
+                }
+            );
+        }
+
+
+        /**
+         * Maps the given coordinates along the principal components back to
+         * the original space, i.e., x = mean + sum_c scores[c] * component_c.
+         * 
+         * @param scores The vector of NVectors with the coordinates; their
+         * dimension must be the number of components.
+         * 
+         * @param output The vector of NVectors where the results will be
+         * stored; it must have the original dimension and as many NVectors
+         * as the given coordinates.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+        */
+        void inverseTransform(
+            VNVectors::VNVectors<T>& scores, VNVectors::VNVectors<T>& output,
+            bool parallel
+        )
+        {
+            // Validate the dimensions and the sizes.
+            ValidationGeneral::validateDimensions(
+                k, scores.dimensions(), true
+            );
+            validateOutput(scores.size(), dimension, output);
+
+            // Auxiliary variables.
+            std::vector<T*> in = UFuncs::rows(scores);
+            std::vector<T*> out = UFuncs::rows(output);
+
+            auto function = [&](size_t first, size_t last)
+            {
+                std::vector<Sum> buffer(dimension);
+
+                for(size_t i = first; i < last; ++i)
+                {
+                    for(size_t j = 0; j < dimension; ++j)
+                        buffer[j] = (Sum) means[j];
+
+                    for(size_t c = 0; c < k; ++c)
+                    {
+                        Sum value = (Sum) in[i][c];
+                        const T* axis = axes.data() + c * dimension;
+                        for(size_t j = 0; j < dimension; ++j)
+                            buffer[j] += value * (Sum) axis[j];
+                    }
+
+                    for(size_t j = 0; j < dimension; ++j)
+                        out[i][j] = (T) buffer[j];
+                }
+            };
+
+            run(scores.size(), parallel, function);
+        }
+
+
+        /**
+         * Returns the mean of the original NVectors.
+         * 
+         * @return The mean of the original NVectors.
+        */
+        NVector::NVector<T> mean()
+        {
+            return NVector::NVector<T>(means.begin(), means.end());
+        }
+
+
+        /**
+         * Projects the given NVectors onto the principal components, i.e.,
+         * output[i][c] = (vectors[i] - mean) . component_c.
+         * 
+         * @param vectors The vector of NVectors to be projected; it must have
+         * the original dimension.
+         * 
+         * @param output The vector of NVectors where the coordinates will be
+         * stored; its dimension must be the number of components, with as
+         * many NVectors as the given ones.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+        */
+        void transform(
+            VNVectors::VNVectors<T>& vectors, VNVectors::VNVectors<T>& output,
+            bool parallel
+        )
+        {
+            // Validate the dimensions and the sizes.
+            ValidationGeneral::validateDimensions(
+                dimension, vectors.dimensions(), true
+            );
+            validateOutput(vectors.size(), k, output);
+
+            // Auxiliary variables.
+            std::vector<T*> in = UFuncs::rows(vectors);
+            std::vector<T*> out = UFuncs::rows(output);
+
+            auto function = [&](size_t first, size_t last)
+            {
+                std::vector<Sum> buffer(dimension);
+
+                for(size_t i = first; i < last; ++i)
+                {
+                    // Center the NVector once for all the components.
+                    for(size_t j = 0; j < dimension; ++j)
+                        buffer[j] = (Sum) in[i][j] - (Sum) means[j];
+
+                    for(size_t c = 0; c < k; ++c)
+                    {
+                        Sum accum = (Sum) 0;
+                        const T* axis = axes.data() + c * dimension;
+                        for(size_t j = 0; j < dimension; ++j)
+                            accum += buffer[j] * (Sum) axis[j];
+                        out[i][c] = (T) accum;
+                    }
+                }
+            };
+
+            run(vectors.size(), parallel, function);
+        }
+
+
+        /**
+         * Returns the variance along each of the principal components, i.e.,
+         * the eigenvalues of the covariance matrix.
+         * 
+         * @return The NVector with the variance of each component.
+        */
+        NVector::NVector<T> variances()
+        {
+            return NVector::NVector<T>(
+                variancesValues.begin(), variancesValues.end()
+            );
+        }
+
+
+        private:
+        //######################################################################
+        // Functions
+        //######################################################################
+
+
+        /**
+         * Computes all the eigenvalues and eigenvectors of the given
+         * symmetric matrix with the cyclic Jacobi method, sorted from the
+         * largest eigenvalue to the smallest one.
+         * 
+         * @param a The symmetric matrix, by rows; it is overwritten.
+         * 
+         * @param n The number of rows of the matrix.
+         * 
+         * @param values Where the eigenvalues are stored.
+         * 
+         * @param vectors Where the eigenvectors are stored, as the columns of
+         * an n x n matrix by rows.
+        */
+        static void jacobi(
+            std::vector<Sum>& a, size_t n, std::vector<Sum>& values,
+            std::vector<Sum>& vectors
+        )
+        {
+            // Auxiliary variables.
+            constexpr Sum epsilon = std::numeric_limits<Sum>::epsilon();
+            std::vector<Sum> v(n * n, (Sum) 0);
+
+            for(size_t i = 0; i < n; ++i) v[i * n + i] = (Sum) 1;
+
+            for(size_t sweep = 0; sweep < jacobiSweeps; ++sweep)
+            {
+                // Stop when the off-diagonal entries are negligible.
+                Sum off = (Sum) 0, total = (Sum) 0;
+                for(size_t i = 0; i < n; ++i)
+                    for(size_t j = 0; j < n; ++j)
+                    {
+                        Sum square = a[i * n + j] * a[i * n + j];
+                        total += square;
+                        off += i != j ? square : (Sum) 0;
+                    }
+
+                if(off <= epsilon * epsilon * total) break;
+
+                for(size_t p = 0; p + 1 < n; ++p)
+                    for(size_t q = p + 1; q < n; ++q)
+                    {
+                        Sum apq = a[p * n + q];
+                        if(apq == (Sum) 0) continue;
+
+                        // The rotation that zeroes the entry.
+                        Sum theta = (a[q * n + q] - a[p * n + p]) /
+                            ((Sum) 2 * apq);
+                        Sum t = (theta >= (Sum) 0 ? (Sum) 1 : (Sum) -1) /
+                            (std::abs(theta) + std::sqrt(theta * theta + 1));
+                        Sum c = (Sum) 1 / std::sqrt(t * t + 1);
+                        Sum s = t * c;
+
+                        for(size_t r = 0; r < n; ++r)
+                        {
+                            Sum arp = a[r * n + p], arq = a[r * n + q];
+                            a[r * n + p] = c * arp - s * arq;
+                            a[r * n + q] = s * arp + c * arq;
+                        }
+
+                        for(size_t r = 0; r < n; ++r)
+                        {
+                            Sum apr = a[p * n + r], aqr = a[q * n + r];
+                            a[p * n + r] = c * apr - s * aqr;
+                            a[q * n + r] = s * apr + c * aqr;
+                        }
+
+                        for(size_t r = 0; r < n; ++r)
+                        {
+                            Sum vrp = v[r * n + p], vrq = v[r * n + q];
+                            v[r * n + p] = c * vrp - s * vrq;
+                            v[r * n + q] = s * vrp + c * vrq;
+                        }
+                    }
+            }
+
+            // Sort from the largest eigenvalue to the smallest one.
+            std::vector<size_t> order(n);
+            std::iota(order.begin(), order.end(), 0);
+            std::sort(order.begin(), order.end(), [&](size_t x, size_t y)
+            {
+                return a[x * n + x] > a[y * n + y];
+            });
+
+            values.resize(n);
+            vectors.resize(n * n);
+            for(size_t c = 0; c < n; ++c)
+            {
+                values[c] = a[order[c] * n + order[c]];
+                for(size_t r = 0; r < n; ++r)
+                    vectors[r * n + c] = v[r * n + order[c]];
+            }
+        }
+
+
+        /**
+         * Orthonormalizes the columns of the given matrix with the modified
+         * Gram-Schmidt process, done twice; the columns that vanish are
+         * replaced with random ones.
+         * 
+         * @param q The matrix, by rows, whose columns are orthonormalized.
+         * 
+         * @param columns The number of columns of the matrix.
+         * 
+         * @param generator The random number generator of the replacements.
+        */
+        void orthonormalize(
+            std::vector<Sum>& q, size_t columns, std::mt19937_64& generator
+        )
+        {
+            // Auxiliary variables.
+            std::normal_distribution<double> normal(0.0, 1.0);
+
+            for(size_t c = 0; c < columns; ++c)
+            {
+                for(size_t pass = 0; pass < 2; ++pass)
+                    for(size_t o = 0; o < c; ++o)
+                    {
+                        Sum dot = (Sum) 0;
+                        for(size_t r = 0; r < dimension; ++r)
+                            dot += q[r * columns + o] * q[r * columns + c];
+                        for(size_t r = 0; r < dimension; ++r)
+                            q[r * columns + c] -= dot * q[r * columns + o];
+                    }
+
+                Sum norm = (Sum) 0;
+                for(size_t r = 0; r < dimension; ++r)
+                    norm += q[r * columns + c] * q[r * columns + c];
+                norm = std::sqrt(norm);
+
+                // Replace the vanished columns and orthonormalize them again.
+                if(!(norm > std::numeric_limits<Sum>::min()))
+                {
+                    for(size_t r = 0; r < dimension; ++r)
+                        q[r * columns + c] = (Sum) normal(generator);
+                    --c;
+                    continue;
+                }
+
+                for(size_t r = 0; r < dimension; ++r)
+                    q[r * columns + c] /= norm;
+            }
+        }
+
+
+        /**
+         * Runs the given function over the NVectors, splitting them among
+         * several threads if requested.
+         * 
+         * @param size The number of NVectors.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+         * 
+         * @param function The function, with signature function(first,
+         * last), that processes the NVectors in [first, last).
+        */
+        template <typename F>
+        static void run(size_t size, bool parallel, F& function)
+        {
+            if(parallel)
+                ParallelGeneral::parallelFor(0, size, parallelGrain, function);
+            else
+                function(0, size);
+        }
+
+
+        /**
+         * Computes the eigenvectors with the largest eigenvalues of the given
+         * symmetric matrix with the subspace iteration: a block of a few more
+         * vectors than requested is multiplied by the matrix and the Ritz
+         * vectors of the block are taken, until the residuals of the
+         * requested ones are negligible.
+         * 
+         * @param a The symmetric matrix, by rows.
+         * 
+         * @param values Where the eigenvalues are stored.
+         * 
+         * @param vectors Where the eigenvectors are stored, as the columns of
+         * a matrix by rows.
+        */
+        void subspace(
+            std::vector<Sum>& a, std::vector<Sum>& values,
+            std::vector<Sum>& vectors
+        )
+        {
+            // Auxiliary variables.
+            size_t m = std::min(dimension, k + oversampling);
+            size_t maximum = subspaceIterations;
+            std::mt19937_64 generator(subspaceSeed);
+            std::normal_distribution<double> normal(0.0, 1.0);
+            std::vector<Sum> q(dimension * m), z(dimension * m);
+            std::vector<Sum> h(m * m), ritz, rotation;
+
+            for(Sum& entry : q) entry = (Sum) normal(generator);
+            orthonormalize(q, m, generator);
+
+            for(size_t iteration = 0; iteration < maximum; ++iteration)
+            {
+                // Z = A Q and H = Q^T A Q.
+                std::fill(z.begin(), z.end(), (Sum) 0);
+                for(size_t i = 0; i < dimension; ++i)
+                    for(size_t l = 0; l < dimension; ++l)
+                    {
+                        Sum value = a[i * dimension + l];
+                        for(size_t c = 0; c < m; ++c)
+                            z[i * m + c] += value * q[l * m + c];
+                    }
+
+                std::fill(h.begin(), h.end(), (Sum) 0);
+                for(size_t r = 0; r < dimension; ++r)
+                    for(size_t c = 0; c < m; ++c)
+                        for(size_t e = 0; e < m; ++e)
+                            h[c * m + e] += q[r * m + c] * z[r * m + e];
+
+                jacobi(h, m, ritz, rotation);
+
+                // The Ritz vectors, X = Q V, and A X = Z V.
+                std::vector<Sum> x(dimension * m, (Sum) 0);
+                std::vector<Sum> y(dimension * m, (Sum) 0);
+                for(size_t r = 0; r < dimension; ++r)
+                    for(size_t c = 0; c < m; ++c)
+                        for(size_t e = 0; e < m; ++e)
+                        {
+                            x[r * m + e] += q[r * m + c] * rotation[c * m + e];
+                            y[r * m + e] += z[r * m + c] * rotation[c * m + e];
+                        }
+
+                // Stop when the requested residuals are negligible.
+                Sum residual = (Sum) 0;
+                for(size_t c = 0; c < k; ++c)
+                {
+                    Sum norm = (Sum) 0;
+                    for(size_t r = 0; r < dimension; ++r)
+                    {
+                        Sum value = y[r * m + c] - ritz[c] * x[r * m + c];
+                        norm += value * value;
+                    }
+                    residual = std::max(residual, std::sqrt(norm));
+                }
+
+                values = ritz;
+                vectors = x;
+
+                if(residual <= subspaceTolerance * std::abs(ritz[0])) break;
+
+                q = std::move(y);
+                orthonormalize(q, m, generator);
+            }
+        }
+
+
+        /**
+         * Validates that the given output has the given size and dimension.
+         * 
+         * @param size The required number of NVectors.
+         * 
+         * @param dimensions The required dimension.
+         * 
+         * @param output The vector of NVectors to be validated.
+        */
+        static void validateOutput(
+            size_t size, size_t dimensions, VNVectors::VNVectors<T>& output
+        )
+        {
+            ValidationGeneral::validateDimensions(
+                dimensions, output.dimensions(), true
+            );
+            ValidationGeneral::validateDimensions(size, output.size(), true);
+        }
+
+
+        //######################################################################
+        // Variables
+        //######################################################################
+
+
+        // Maximum dimension whose eigenvectors are all computed with the
+        // Jacobi method.
+        static constexpr size_t jacobiLimit{128};
+
+
+        // Maximum number of sweeps of the Jacobi method.
+        static constexpr size_t jacobiSweeps{64};
+
+
+        // Number of vectors of the subspace iteration beyond the requested
+        // ones, such that the gap to the next eigenvalue is larger.
+        static constexpr size_t oversampling{8};
+
+
+        // Minimum number of NVectors that each thread must process.
+        static constexpr size_t parallelGrain{4096};
+
+
+        // Maximum number of iterations of the subspace iteration.
+        static constexpr size_t subspaceIterations{1000};
+
+
+        // Seed of the starting block of the subspace iteration.
+        static constexpr uint64_t subspaceSeed{0x9E3779B97F4A7C15};
+
+
+        // Relative residual at which the subspace iteration stops.
+        static constexpr Sum subspaceTolerance{(Sum) 1e-10};
+
+
+        // Principal components, one after the other.
+        std::vector<T> axes;
+
+
+        // Mean of the original NVectors.
+        std::vector<T> means;
+
+
+        // Variance along each of the principal components.
+        std::vector<T> variancesValues;
+
+
+        // Size of the original NVectors.
+        size_t dimension{0};
+
+
+        // Number of principal components.
+        size_t k{0};
+    };
+}
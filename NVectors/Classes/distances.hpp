@@ -0,0 +1,472 @@
+/*
+    File that contains the pairwise Euclidean distances between the NVectors
+    of the vectors of NVectors, computed by tiles.
+*/
+#pragma once
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+
+// User defined.
+#include "./Headers/Parallel/parallelGeneral.hpp"
+#include "./Headers/Validation/validationGeneral.hpp"
+#include "./Headers/Validation/validationNumerical.hpp"
+#include "./nvectors.hpp"
+#include "./ufuncs.hpp"
+#include "./vnvectors.hpp"
+
+
+//##############################################################################
+// Namespaces
+//##############################################################################
+
+
+namespace Distances
+{
+    //##########################################################################
+    // Variables
+    //##########################################################################
+
+
+    // Number of NVectors of each side of a tile.
+    constexpr size_t tileSize{64};
+
+
+    // Number of entries of the dot products computed between reloads of the
+    // packed tile; such that the packed tile fits in the cache.
+    constexpr size_t depthBlock{128};
+
+
+    //##########################################################################
+    // Functions
+    //##########################################################################
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Auxiliary Functions
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    /**
+     * Returns the squared L2 norm of each of the given NVectors.
+     * 
+     * @param rows The pointers to the entries of each of the NVectors.
+     * 
+     * @param dimension The number of entries of each of the NVectors.
+     * 
+     * @return The squared L2 norm of each of the NVectors.
+    */
+    template <typename T>
+    std::vector<T> squaredNorms(const std::vector<T*>& rows, size_t dimension)
+    {
+        // Auxiliary variables.
+        std::vector<T> norms(rows.size(), (T) 0);
+
+        for(size_t i = 0; i < rows.size(); ++i)
+            for(size_t k = 0; k < dimension; ++k)
+                norms[i] += rows[i][k] * rows[i][k];
+
+        return norms;
+    }
+
+
+    /**
+     * Computes the squared distances between the NVectors [rowFirst, rowLast)
+     * of the first group and [columnFirst, columnLast) of the second one, as
+     * |a|^2 + |b|^2 - 2 a.b; the dot products are accumulated along the
+     * columns of the tile, over a packed copy of the second group, such that
+     * the innermost loop is contiguous and can be vectorized.
+     * 
+     * @param a The pointers to the entries of the first group of NVectors.
+     * 
+     * @param b The pointers to the entries of the second group of NVectors.
+     * 
+     * @param normsA The squared norms of the first group of NVectors.
+     * 
+     * @param normsB The squared norms of the second group of NVectors.
+     * 
+     * @param dimension The number of entries of each of the NVectors.
+     * 
+     * @param rowFirst The first NVector of the first group in the tile.
+     * 
+     * @param rowLast The NVector of the first group after the tile.
+     * 
+     * @param columnFirst The first NVector of the second group in the tile.
+     * 
+     * @param columnLast The NVector of the second group after the tile.
+     * 
+     * @param packed The buffer of depthBlock * tileSize entries for the
+     * packed copy of the second group.
+     * 
+     * @param tile The buffer of tileSize * tileSize entries where the
+     * squared distances are stored, by rows with tileSize columns each.
+    */
+    template <typename T>
+    void tileKernel(
+        const std::vector<T*>& a, const std::vector<T*>& b,
+        const std::vector<T>& normsA, const std::vector<T>& normsB,
+        size_t dimension, size_t rowFirst, size_t rowLast,
+        size_t columnFirst, size_t columnLast, T* packed, T* tile
+    ) noexcept
+    {
+        // Auxiliary variables.
+        size_t rows = rowLast - rowFirst;
+        size_t columns = columnLast - columnFirst;
+
+        std::fill(tile, tile + rows * tileSize, (T) 0);
+
+        // Accumulate the dot products, one block of entries at a time.
+        for(size_t k0 = 0; k0 < dimension; k0 += depthBlock)
+        {
+            size_t depth = std::min(depthBlock, dimension - k0);
+
+            // Pack the block of the second group, entry by entry.
+            for(size_t j = 0; j < columns; ++j)
+            {
+                const T* column = b[columnFirst + j] + k0;
+                for(size_t k = 0; k < depth; ++k)
+                    packed[k * tileSize + j] = column[k];
+            }
+
+            for(size_t i = 0; i < rows; ++i)
+            {
+                const T* row = a[rowFirst + i] + k0;
+                T* accumulator = tile + i * tileSize;
+
+                for(size_t k = 0; k < depth; ++k)
+                {
+                    const T value = row[k];
+                    const T* entries = packed + k * tileSize;
+                    for(size_t j = 0; j < columns; ++j)
+                        accumulator[j] += value * entries[j];
+                }
+            }
+        }
+
+        // Turn the dot products into distances, clamping the round-off.
+        for(size_t i = 0; i < rows; ++i)
+        {
+            T* distances = tile + i * tileSize;
+            T normA = normsA[rowFirst + i];
+            for(size_t j = 0; j < columns; ++j)
+                distances[j] = std::max(
+                    normA + normsB[columnFirst + j] - (T) 2 * distances[j],
+                    (T) 0
+                );
+        }
+    }
+
+
+    /**
+     * Computes the distances tile by tile and gives each tile to the
+     * callback; when both groups are the same, only the tiles on and above
+     * the diagonal are computed and the diagonal distances are exactly zero.
+     * 
+     * @param a The pointers to the entries of the first group of NVectors.
+     * 
+     * @param b The pointers to the entries of the second group of NVectors.
+     * 
+     * @param dimension The number of entries of each of the NVectors.
+     * 
+     * @param same True, if both groups are the same; False, otherwise.
+     * 
+     * @param squared True, if the squared distances are to be given; False,
+     * otherwise.
+     * 
+     * @param parallel True, if the tiles must be split among several
+     * threads; False, otherwise.
+     * 
+     * @param callback The function, with signature callback(rowFirst,
+     * columnFirst, rows, columns, tile), see forEachTile.
+    */
+    template <typename T, typename F>
+    void tiles(
+        const std::vector<T*>& a, const std::vector<T*>& b, size_t dimension,
+        bool same, bool squared, bool parallel, F& callback
+    )
+    {
+        // Auxiliary variables.
+        std::vector<T> normsA = squaredNorms(a, dimension);
+        std::vector<T> normsB = same ? normsA : squaredNorms(b, dimension);
+        std::vector<std::pair<size_t, size_t>> corners;
+
+        for(size_t i = 0; i < a.size(); i += tileSize)
+            for(size_t j = same ? i : 0; j < b.size(); j += tileSize)
+                corners.emplace_back(i, j);
+
+        auto kernel = [&](size_t first, size_t last)
+        {
+            // Each thread has its own buffers.
+            std::vector<T> packed(depthBlock * tileSize);
+            std::vector<T> tile(tileSize * tileSize);
+
+            for(size_t t = first; t < last; ++t)
+            {
+                size_t i0 = corners[t].first;
+                size_t j0 = corners[t].second;
+                size_t rows = std::min(tileSize, a.size() - i0);
+                size_t columns = std::min(tileSize, b.size() - j0);
+
+                tileKernel(
+                    a, b, normsA, normsB, dimension, i0, i0 + rows, j0,
+                    j0 + columns, packed.data(), tile.data()
+                );
+
+                if(same && i0 == j0)
+                    for(size_t i = 0; i < rows; ++i)
+                        tile[i * tileSize + i] = (T) 0;
+
+                if(!squared)
+                    for(size_t i = 0; i < rows; ++i)
+                        for(size_t j = 0; j < columns; ++j)
+                            tile[i * tileSize + j] =
+                                std::sqrt(tile[i * tileSize + j]);
+
+                callback(i0, j0, rows, columns, (const T*) tile.data());
+            }
+        };
+
+        if(parallel)
+            ParallelGeneral::parallelFor(0, corners.size(), 1, kernel);
+        else
+            kernel(0, corners.size());
+    }
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Tile Functions
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    /**
+     * Computes the distances between the NVectors of the vector of NVectors
+     * tile by tile, giving each tile to the callback instead of storing the
+     * matrix. Only the tiles on and above the diagonal are computed, i.e.,
+     * rowFirst <= columnFirst; the tiles on the diagonal are complete.
+     * 
+     * @param vector The vector of NVectors.
+     * 
+     * @param squared True, if the squared distances are to be given; False,
+     * otherwise.
+     * 
+     * @param parallel True, if the tiles must be split among several
+     * threads; False, otherwise.
+     * 
+     * @param callback The function, with signature callback(size_t rowFirst,
+     * size_t columnFirst, size_t rows, size_t columns, const T* tile), where
+     * tile[i * tileSize + j] is the distance between the NVectors rowFirst + i
+     * and columnFirst + j; the tile is only valid during the call. If
+     * parallel, it is called from several threads at the same time.
+    */
+    template <typename T, typename F>
+    void forEachTile(
+        VNVectors::VNVectors<T>& vector, bool squared, bool parallel,
+        F callback
+    )
+    {
+        // Auxiliary variables.
+        std::vector<T*> a = UFuncs::rows(vector);
+
+        tiles(a, a, vector.dimensions(), true, squared, parallel, callback);
+    }
+
+
+    /**
+     * Computes the distances between the NVectors of the first vector of
+     * NVectors and the NVectors of the second one tile by tile, giving each
+     * tile to the callback instead of storing the matrix.
+     * 
+     * @param vector_1 The first vector of NVectors.
+     * 
+     * @param vector_2 The second vector of NVectors; it must have the same
+     * dimension as the first one.
+     * 
+     * @param squared True, if the squared distances are to be given; False,
+     * otherwise.
+     * 
+     * @param parallel True, if the tiles must be split among several
+     * threads; False, otherwise.
+     * 
+     * @param callback The function, with signature callback(size_t rowFirst,
+     * size_t columnFirst, size_t rows, size_t columns, const T* tile), where
+     * tile[i * tileSize + j] is the distance between the NVector rowFirst + i
+     * of the first vector of NVectors and the NVector columnFirst + j of the
+     * second one; the tile is only valid during the call. If parallel, it is
+     * called from several threads at the same time.
+    */
+    template <typename T, typename F>
+    void forEachTile(
+        VNVectors::VNVectors<T>& vector_1, VNVectors::VNVectors<T>& vector_2,
+        bool squared, bool parallel, F callback
+    )
+    {
+        // Validate the dimensions.
+        ValidationGeneral::validateDimensions(
+            vector_1.dimensions(), vector_2.dimensions(), true
+        );
+
+        // Auxiliary variables.
+        std::vector<T*> a = UFuncs::rows(vector_1);
+        std::vector<T*> b = UFuncs::rows(vector_2);
+
+        tiles(a, b, vector_1.dimensions(), false, squared, parallel, callback);
+    }
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Distance Functions
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    /**
+     * Returns the condensed distance matrix of the NVectors of the vector of
+     * NVectors, i.e., the distances above the diagonal, by rows; the
+     * distance between the NVectors i < j is at the index
+     * n * i - i * (i + 1) / 2 + j - i - 1, as in scipy.
+     * 
+     * @param vector The vector of NVectors; it must have at least two
+     * NVectors.
+     * 
+     * @param squared True, if the squared distances are to be returned;
+     * False, otherwise.
+     * 
+     * @param parallel True, if the tiles must be split among several
+     * threads; False, otherwise.
+     * 
+     * @return The NVector with the n * (n - 1) / 2 distances.
+    */
+    template <typename T>
+    NVector::NVector<T> condensedDistanceMatrix(
+        VNVectors::VNVectors<T>& vector, bool squared, bool parallel
+    )
+    {
+        // Auxiliary variables.
+        size_t n = vector.size();
+
+        // Validate there are pairs.
+        ValidationNumerical::rangeGreater<size_t>(1, n, true);
+
+        // Auxiliary variables.
+        NVector::NVector<T> result(n * (n - 1) / 2, NVector::uninitialized);
+        T* r = result.data();
+
+        auto store = [r, n](
+            size_t i0, size_t j0, size_t rows, size_t columns, const T* tile
+        )
+        {
+            for(size_t i = 0; i < rows; ++i)
+            {
+                size_t row = i0 + i;
+                size_t offset = n * row - row * (row + 1) / 2;
+                for(size_t j = j0 > row ? 0 : row + 1 - j0; j < columns; ++j)
+                    r[offset + j0 + j - row - 1] = tile[i * tileSize + j];
+            }
+        };
+
+        forEachTile(vector, squared, parallel, store);
+
+        return result;
+    }
+
+
+    /**
+     * Returns the matrix with the distances between each of the NVectors of
+     * the vector of NVectors, as a vector of NVectors; the entry [i][j] is
+     * the distance between the NVectors i and j.
+     * 
+     * @param vector The vector of NVectors.
+     * 
+     * @param squared True, if the squared distances are to be returned;
+     * False, otherwise.
+     * 
+     * @param parallel True, if the tiles must be split among several
+     * threads; False, otherwise.
+     * 
+     * @return The vector of NVectors with the distances.
+    */
+    template <typename T>
+    VNVectors::VNVectors<T> distanceMatrix(
+        VNVectors::VNVectors<T>& vector, bool squared, bool parallel
+    )
+    {
+        // Auxiliary variables.
+        VNVectors::VNVectors<T> result(
+            vector.size(), vector.size(), NVector::uninitialized
+        );
+        std::vector<T*> r = UFuncs::rows(result);
+
+        auto store = [&r](
+            size_t i0, size_t j0, size_t rows, size_t columns, const T* tile
+        )
+        {
+            for(size_t i = 0; i < rows; ++i)
+                for(size_t j = 0; j < columns; ++j)
+                {
+                    r[i0 + i][j0 + j] = tile[i * tileSize + j];
+                    r[j0 + j][i0 + i] = tile[i * tileSize + j];
+                }
+        };
+
+        forEachTile(vector, squared, parallel, store);
+
+        return result;
+    }
+
+
+    /**
+     * Returns the matrix with the distances between each of the NVectors of
+     * the first vector of NVectors and each of the NVectors of the second
+     * one; the entry [i][j] is the distance between the NVector i of the
+     * first vector of NVectors and the NVector j of the second one.
+     * 
+     * @param vector_1 The first vector of NVectors.
+     * 
+     * @param vector_2 The second vector of NVectors; it must have the same
+     * dimension as the first one.
+     * 
+     * @param squared True, if the squared distances are to be returned;
+     * False, otherwise.
+     * 
+     * @param parallel True, if the tiles must be split among several
+     * threads; False, otherwise.
+     * 
+     * @return The vector of NVectors with the distances.
+    */
+    template <typename T>
+    VNVectors::VNVectors<T> distanceMatrix(
+        VNVectors::VNVectors<T>& vector_1, VNVectors::VNVectors<T>& vector_2,
+        bool squared, bool parallel
+    )
+    {
+        // Auxiliary variables.
+        VNVectors::VNVectors<T> result(
+            vector_2.size(), vector_1.size(), NVector::uninitialized
+        );
+        std::vector<T*> r = UFuncs::rows(result);
+
+        auto store = [&r](
+            size_t i0, size_t j0, size_t rows, size_t columns, const T* tile
+        )
+        {
+            for(size_t i = 0; i < rows; ++i)
+                std::copy(
+                    tile + i * tileSize, tile + i * tileSize + columns,
+                    r[i0 + i] + j0
+                );
+        };
+
+        forEachTile(vector_1, vector_2, squared, parallel, store);
+
+        return result;
+    }
+}
@@ -0,0 +1,921 @@
+/*
+    File that contains the k-means clustering of the vectors of NVectors and
+    its functions.
+*/
+#pragma once
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+
+// User defined.
+#include "./Headers/Parallel/parallelGeneral.hpp"
+#include "./Headers/Validation/validationGeneral.hpp"
+#include "./Headers/Validation/validationNumerical.hpp"
+#include "./distances.hpp"
+#include "./nvectors.hpp"
+#include "./ufuncs.hpp"
+#include "./vnvectors.hpp"
+
+
+//##############################################################################
+// Namespaces
+//##############################################################################
+
+
+namespace KMeans
+{
+    //##########################################################################
+    // Enumerations
+    //##########################################################################
+
+
+    /**
+     * The algorithm with which the iterations are done.
+    */
+    enum class Algorithm
+    {
+        // The bounds of Hamerly skip most of the distances once the centroids
+        // barely move; better for low to medium dimensions.
+        Hamerly,
+
+        // All the distances are computed, by tiles, in every iteration.
+        Lloyd
+    };
+
+
+    //##########################################################################
+    // Classes
+    //##########################################################################
+
+
+    /**
+     * Class that clusters the NVectors of a vector of NVectors around k
+     * centroids, minimizing the sum of the squared distances to them. The
+     * centroids are seeded with k-means++ and refined with the Lloyd or the
+     * Hamerly iterations, or with mini-batches for streaming data. Each
+     * thread accumulates its own centroid sums, which are merged in a fixed
+     * order, such that the results do not depend on the scheduling.
+    */
+    template <typename T>
+    class KMeans
+    {
+        public:
+        //######################################################################
+        // Constructor(s) and Destructor(s)
+        //######################################################################
+
+
+        /**
+         * Constructs a new, not fitted, k-means clustering.
+         * 
+         * @param clusters The number of centroids; must be greater than zero.
+         * 
+         * @param seed The seed of the random number generator of the
+         * seeding, such that the results can be reproduced.
+        */
+        KMeans(size_t clusters, uint64_t seed) :
+        generator{seed},
+        k{clusters}
+        {
+            // Validate the quantities.
+            ValidationNumerical::rangeGreater<size_t>(0, k, true);
+            ValidationNumerical::isFloating<T>((T) 1, true);
+        }
+
+
+        /**
+         * Destructs the given object pointer.
+        */
+        ~KMeans(){}
+
+
+        //######################################################################
+        // Functions
+        //######################################################################
+
+
+        ////////////////////////////////////////////////////////////////////////
+        // Non-Template Functions
+        ////////////////////////////////////////////////////////////////////////
+
+
+        /**
+         * Returns the number of entries of the centroids; zero, if it has not
+         * been fitted.
+         * 
+         * @return The number of entries of the centroids.
+        */
+        size_t dimensions()
+        {
+            return dimension;
+        }
+
+
+        /**
+         * Returns the number of iterations done by the last fit, or the
+         * number of mini-batches given so far.
+         * 
+         * @return The number of iterations.
+        */
+        size_t iterations()
+        {
+            return iteration;
+        }
+
+
+        /**
+         * Returns the index of the centroid assigned to each of the NVectors
+         * of the last fit, or of the last mini-batch.
+         * 
+         * @return The index of the centroid of each of the NVectors.
+        */
+        std::vector<size_t> labels()
+        {
+            return assignments;
+        }
+
+
+        /**
+         * Returns the number of centroids.
+         * 
+         * @return The number of centroids.
+        */
+        size_t size()
+        {
+            return k;
+        }
+
+
+        ////////////////////////////////////////////////////////////////////////
+        // Template Functions
+        ////////////////////////////////////////////////////////////////////////
+
+
+        /**
+         * Returns the centroids.
+         * 
+         * @return The vector of NVectors with the centroids.
+        */
+        VNVectors::VNVectors<T> centroids()
+        {
+            // Validate it has been fitted.
+            ValidationNumerical::rangeGreater<size_t>(0, dimension, true);
+
+            return VNVectors::VNVectors<T>(
+                dimension, k, [this](size_t i, size_t j)
+                {
+                    return centers[i * dimension + j];
+                }
+            );
+        }
+
+
+        /**
+         * Clusters the NVectors of the vector of NVectors, seeding the
+         * centroids again with k-means++.
+         * 
+         * @param vectors The vector of NVectors to be clustered; it must have
+         * at least as many NVectors as centroids.
+         * 
+         * @param algorithm The algorithm with which the iterations are done.
+         * 
+         * @param maximum The maximum number of iterations.
+         * 
+         * @param tolerance The iterations stop when no centroid moves more
+         * than this distance.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+        */
+        void fit(
+            VNVectors::VNVectors<T>& vectors, Algorithm algorithm,
+            size_t maximum, T tolerance, bool parallel
+        )
+        {
+            // Validate there are enough NVectors.
+            ValidationNumerical::rangeGreater<size_t>(
+                k - 1, vectors.size(), true
+            );
+
+            // Auxiliary variables.
+            std::vector<T*> rows = UFuncs::rows(vectors);
+
+            dimension = vectors.dimensions();
+            counts.assign(k, 0);
+            iteration = 0;
+
+            seed(rows, parallel);
+
+            if(algorithm == Algorithm::Lloyd)
+                lloyd(rows, maximum, tolerance, parallel);
+            else
+                hamerly(rows, maximum, tolerance, parallel);
+
+            // Assign the NVectors to the final centroids.
+            inertiaValue = assign(
+                rows, assignments, nullptr, nullptr, parallel
+            );
+        }
+
+
+        /**
+         * Returns the sum of the squared distances between the NVectors and
+         * their centroids, for the last fit or the last mini-batch.
+         * 
+         * @return The sum of the squared distances to the centroids.
+        */
+        T inertia()
+        {
+            return inertiaValue;
+        }
+
+
+        /**
+         * Updates the centroids with a mini-batch of NVectors; each centroid
+         * moves towards the mean of its NVectors in the batch with a rate of
+         * the fraction of all its NVectors, seen so far, that are in the
+         * batch. The first mini-batch seeds the centroids with k-means++.
+         * 
+         * @param batch The vector of NVectors of the mini-batch; the first one
+         * must have at least as many NVectors as centroids.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+        */
+        void partialFit(VNVectors::VNVectors<T>& batch, bool parallel)
+        {
+            // Auxiliary variables.
+            std::vector<T*> rows = UFuncs::rows(batch);
+
+            // The first mini-batch seeds the centroids.
+            if(dimension == 0)
+            {
+                ValidationNumerical::rangeGreater<size_t>(
+                    k - 1, batch.size(), true
+                );
+
+                dimension = batch.dimensions();
+                counts.assign(k, 0);
+                iteration = 0;
+
+                seed(rows, parallel);
+            }
+
+            // Validate the dimensions.
+            ValidationGeneral::validateDimensions(
+                dimension, batch.dimensions(), true
+            );
+
+            // Auxiliary variables.
+            std::vector<Sum> sums;
+            std::vector<size_t> members;
+
+            inertiaValue = assign(
+                rows, assignments, &sums, &members, parallel
+            );
+
+            // Move each centroid towards the mean of its batch NVectors.
+            for(size_t c = 0; c < k; ++c)
+            {
+                if(members[c] == 0) continue;
+
+                counts[c] += members[c];
+                Sum rate = (Sum) members[c] / (Sum) counts[c];
+                T* center = centers.data() + c * dimension;
+                for(size_t j = 0; j < dimension; ++j)
+                {
+                    Sum mean = sums[c * dimension + j] / (Sum) members[c];
+                    center[j] = (T) ((Sum) center[j] + rate *
+                        (mean - (Sum) center[j]));
+                }
+            }
+
+            ++iteration;
+        }
+
+
+        /**
+         * Returns the index of the closest centroid to each of the NVectors
+         * of the vector of NVectors.
+         * 
+         * @param vectors The vector of NVectors to be assigned.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+         * 
+         * @return The index of the closest centroid of each of the NVectors.
+        */
+        std::vector<size_t> predict(
+            VNVectors::VNVectors<T>& vectors, bool parallel
+        )
+        {
+            // Validate the dimensions.
+            ValidationGeneral::validateDimensions(
+                dimension, vectors.dimensions(), true
+            );
+
+            // Auxiliary variables.
+            std::vector<T*> rows = UFuncs::rows(vectors);
+            std::vector<size_t> result;
+
+            assign(rows, result, nullptr, nullptr, parallel);
+
+            return result;
+        }
+
+
+        private:
+        //######################################################################
+        // Types
+        //######################################################################
+
+
+        // Type with which the centroid sums are accumulated; at least double
+        // precision, such that millions of NVectors can be added.
+        typedef std::conditional_t<(sizeof(T) < sizeof(double)), double, T> Sum;
+
+
+        /**
+         * Structure with the centroid sums of the NVectors processed by a
+         * thread.
+        */
+        struct Accumulator
+        {
+            // The first NVector processed by the thread.
+            size_t first{0};
+
+            // The sum of the NVectors of each centroid, one after the other.
+            std::vector<Sum> sums;
+
+            // The number of NVectors of each centroid.
+            std::vector<size_t> members;
+
+            // The sum of the squared distances to the centroids.
+            Sum inertia{0};
+        };
+
+
+        //######################################################################
+        // Functions
+        //######################################################################
+
+
+        /**
+         * Runs the given kernel over the NVectors, each thread with its own
+         * accumulator, and merges the accumulators in the order of the
+         * NVectors.
+         * 
+         * @param size The number of NVectors.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+         * 
+         * @param kernel The function, with signature kernel(first, last,
+         * accumulator), that processes the NVectors in [first, last).
+         * 
+         * @return The merged accumulator.
+        */
+        template <typename K>
+        Accumulator accumulate(size_t size, bool parallel, K kernel)
+        {
+            // Auxiliary variables.
+            std::vector<Accumulator> partials;
+            std::mutex lock;
+            Accumulator total;
+
+            auto function = [&](size_t first, size_t last)
+            {
+                Accumulator partial;
+                partial.first = first;
+                partial.sums.assign(k * dimension, (Sum) 0);
+                partial.members.assign(k, 0);
+
+                kernel(first, last, partial);
+
+                std::lock_guard<std::mutex> guard(lock);
+                partials.push_back(std::move(partial));
+            };
+
+            if(parallel)
+                ParallelGeneral::parallelFor(0, size, parallelGrain, function);
+            else
+                function(0, size);
+
+            // Merge in a fixed order.
+            std::sort(
+                partials.begin(), partials.end(),
+                [](const Accumulator& a, const Accumulator& b)
+                {
+                    return a.first < b.first;
+                }
+            );
+
+            total.sums.assign(k * dimension, (Sum) 0);
+            total.members.assign(k, 0);
+            for(Accumulator& partial : partials)
+            {
+                for(size_t j = 0; j < k * dimension; ++j)
+                    total.sums[j] += partial.sums[j];
+                for(size_t c = 0; c < k; ++c)
+                    total.members[c] += partial.members[c];
+                total.inertia += partial.inertia;
+            }
+
+            return total;
+        }
+
+
+        /**
+         * Assigns each NVector to its closest centroid, computing the squared
+         * distances by tiles of NVectors and centroids, and accumulates the
+         * centroid sums in the same pass.
+         * 
+         * @param rows The pointers to the entries of the NVectors.
+         * 
+         * @param labels Where the index of the closest centroid of each
+         * NVector is stored.
+         * 
+         * @param sums Where the sum of the NVectors of each centroid is
+         * stored; nullptr, if it is not required.
+         * 
+         * @param members Where the number of NVectors of each centroid is
+         * stored; nullptr, if it is not required.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+         * 
+         * @return The sum of the squared distances to the closest centroids.
+        */
+        T assign(
+            const std::vector<T*>& rows, std::vector<size_t>& labels,
+            std::vector<Sum>* sums, std::vector<size_t>* members,
+            bool parallel
+        )
+        {
+            // Auxiliary variables.
+            constexpr size_t tile = Distances::tileSize;
+            std::vector<T*> centerRows = centerPointers();
+            std::vector<T> norms = Distances::squaredNorms(rows, dimension);
+            std::vector<T> centerNorms = Distances::squaredNorms(
+                centerRows, dimension
+            );
+
+            labels.resize(rows.size());
+
+            auto kernel = [&](size_t first, size_t last, Accumulator& partial)
+            {
+                // Each thread has its own buffers.
+                std::vector<T> packed(Distances::depthBlock * tile);
+                std::vector<T> distances(tile * tile);
+                std::vector<T> best(tile);
+                std::vector<size_t> label(tile);
+
+                for(size_t i0 = first; i0 < last; i0 += tile)
+                {
+                    size_t count = std::min(tile, last - i0);
+
+                    std::fill(
+                        best.begin(), best.end(),
+                        std::numeric_limits<T>::infinity()
+                    );
+
+                    // Find the closest centroids, tile by tile.
+                    for(size_t c0 = 0; c0 < k; c0 += tile)
+                    {
+                        size_t columns = std::min(tile, k - c0);
+
+                        Distances::tileKernel(
+                            rows, centerRows, norms, centerNorms, dimension,
+                            i0, i0 + count, c0, c0 + columns, packed.data(),
+                            distances.data()
+                        );
+
+                        for(size_t i = 0; i < count; ++i)
+                            for(size_t c = 0; c < columns; ++c)
+                            {
+                                T value = distances[i * tile + c];
+                                if(value < best[i])
+                                {
+                                    best[i] = value;
+                                    label[i] = c0 + c;
+                                }
+                            }
+                    }
+
+                    // Store and accumulate the assignments.
+                    for(size_t i = 0; i < count; ++i)
+                    {
+                        labels[i0 + i] = label[i];
+                        partial.inertia += (Sum) best[i];
+
+                        if(sums == nullptr) continue;
+
+                        Sum* sum = partial.sums.data() + label[i] * dimension;
+                        const T* row = rows[i0 + i];
+                        for(size_t j = 0; j < dimension; ++j)
+                            sum[j] += (Sum) row[j];
+                        ++partial.members[label[i]];
+                    }
+                }
+            };
+
+            Accumulator total = accumulate(rows.size(), parallel, kernel);
+
+            if(sums != nullptr) *sums = std::move(total.sums);
+            if(members != nullptr) *members = std::move(total.members);
+
+            return (T) total.inertia;
+        }
+
+
+        /**
+         * Returns the pointers to the entries of each of the centroids.
+         * 
+         * @return The pointers to the entries of each of the centroids.
+        */
+        std::vector<T*> centerPointers()
+        {
+            // Auxiliary variables.
+            std::vector<T*> pointers(k);
+
+            for(size_t c = 0; c < k; ++c)
+                pointers[c] = centers.data() + c * dimension;
+
+            return pointers;
+        }
+
+
+        /**
+         * Refines the centroids with the iterations of Hamerly, which keep an
+         * upper bound of the distance to the assigned centroid and a lower
+         * bound of the distance to the rest of them; the distances of an
+         * NVector are only computed when the bounds can not prove that its
+         * centroid is still the closest one.
+         * 
+         * @param rows The pointers to the entries of the NVectors.
+         * 
+         * @param maximum The maximum number of iterations.
+         * 
+         * @param tolerance The iterations stop when no centroid moves more
+         * than this distance.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+        */
+        void hamerly(
+            const std::vector<T*>& rows, size_t maximum, T tolerance,
+            bool parallel
+        )
+        {
+            // Auxiliary variables.
+            std::vector<Sum> sums;
+            std::vector<size_t> members;
+            std::vector<T> lower(rows.size());
+            std::vector<T> upper(rows.size());
+            std::vector<T> separation(k);
+
+            // The first assignment computes all the distances directly, since
+            // the expanded form of the tiles can cancel and overestimate the
+            // lower bounds, which must never exceed the true distances.
+            assignments.resize(rows.size());
+            Accumulator initial = accumulate(rows.size(), parallel,
+                [&](size_t first, size_t last, Accumulator& partial)
+                {
+                    for(size_t i = first; i < last; ++i)
+                    {
+                        closestTwo(rows[i], assignments[i], upper[i], lower[i]);
+
+                        Sum* sum =
+                            partial.sums.data() + assignments[i] * dimension;
+                        for(size_t j = 0; j < dimension; ++j)
+                            sum[j] += (Sum) rows[i][j];
+                        ++partial.members[assignments[i]];
+                    }
+                }
+            );
+            sums = std::move(initial.sums);
+            members = std::move(initial.members);
+
+            while(iteration < maximum)
+            {
+                // Move the centroids.
+                std::vector<T> shifts = update(sums, members);
+                ++iteration;
+
+                // Auxiliary variables.
+                size_t farthest = (size_t) (
+                    std::max_element(shifts.begin(), shifts.end()) -
+                    shifts.begin()
+                );
+                T largest = shifts[farthest];
+                T runner = (T) 0;
+                for(size_t c = 0; c < k; ++c)
+                    if(c != farthest) runner = std::max(runner, shifts[c]);
+
+                if(largest <= tolerance) break;
+
+                // Half the distance of each centroid to the closest other one.
+                for(size_t c = 0; c < k; ++c)
+                {
+                    T closest = std::numeric_limits<T>::infinity();
+                    for(size_t o = 0; o < k; ++o)
+                        if(o != c)
+                            closest = std::min(closest, squaredDistance(
+                                centers.data() + c * dimension,
+                                centers.data() + o * dimension
+                            ));
+                    separation[c] = std::sqrt(closest) / (T) 2;
+                }
+
+                auto kernel = [&](
+                    size_t first, size_t last, Accumulator& partial
+                )
+                {
+                    for(size_t i = first; i < last; ++i)
+                    {
+                        // Move the bounds with the centroids.
+                        size_t label = assignments[i];
+                        upper[i] += shifts[label];
+                        lower[i] -= label == farthest ? runner : largest;
+
+                        T bound = std::max(separation[label], lower[i]);
+
+                        // Tighten the upper bound, and search if required.
+                        if(upper[i] > bound)
+                        {
+                            upper[i] = std::sqrt(squaredDistance(
+                                rows[i], centers.data() + label * dimension
+                            ));
+
+                            if(upper[i] > bound)
+                                closestTwo(rows[i], label, upper[i], lower[i]);
+                        }
+
+                        assignments[i] = label;
+
+                        Sum* sum = partial.sums.data() + label * dimension;
+                        for(size_t j = 0; j < dimension; ++j)
+                            sum[j] += (Sum) rows[i][j];
+                        ++partial.members[label];
+                    }
+                };
+
+                Accumulator total = accumulate(rows.size(), parallel, kernel);
+                sums = std::move(total.sums);
+                members = std::move(total.members);
+            }
+        }
+
+
+        /**
+         * Finds the closest and the second closest centroids of the given
+         * NVector, computing all the distances.
+         * 
+         * @param row The entries of the NVector.
+         * 
+         * @param label Where the index of the closest centroid is stored.
+         * 
+         * @param closest Where the distance to the closest centroid is
+         * stored.
+         * 
+         * @param second Where the distance to the second closest centroid is
+         * stored.
+        */
+        void closestTwo(
+            const T* row, size_t& label, T& closest, T& second
+        ) noexcept
+        {
+            // Auxiliary variables.
+            T best = std::numeric_limits<T>::infinity();
+            T next = std::numeric_limits<T>::infinity();
+
+            for(size_t c = 0; c < k; ++c)
+            {
+                T value = squaredDistance(row, centers.data() + c * dimension);
+                if(value < best)
+                {
+                    next = best;
+                    best = value;
+                    label = c;
+                }
+                else if(value < next) next = value;
+            }
+
+            closest = std::sqrt(best);
+            second = std::sqrt(next);
+        }
+
+
+            /**
+         * Refines the centroids with the iterations of Lloyd, which assign
+         * every NVector to its closest centroid and move each centroid to the
+         * mean of its NVectors.
+         * 
+         * @param rows The pointers to the entries of the NVectors.
+         * 
+         * @param maximum The maximum number of iterations.
+         * 
+         * @param tolerance The iterations stop when no centroid moves more
+         * than this distance.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+        */
+        void lloyd(
+            const std::vector<T*>& rows, size_t maximum, T tolerance,
+            bool parallel
+        )
+        {
+            // Auxiliary variables.
+            std::vector<Sum> sums;
+            std::vector<size_t> members;
+
+            while(iteration < maximum)
+            {
+                assign(rows, assignments, &sums, &members, parallel);
+
+                std::vector<T> shifts = update(sums, members);
+                ++iteration;
+
+                if(*std::max_element(shifts.begin(), shifts.end()) <= tolerance)
+                    break;
+            }
+        }
+
+
+        /**
+         * Seeds the centroids with k-means++, i.e., each centroid is one of
+         * the NVectors, chosen with a probability proportional to its squared
+         * distance to the closest centroid chosen before.
+         * 
+         * @param rows The pointers to the entries of the NVectors.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+        */
+        void seed(const std::vector<T*>& rows, bool parallel)
+        {
+            // Auxiliary variables.
+            size_t n = rows.size();
+            std::vector<T> closest(n, std::numeric_limits<T>::infinity());
+            std::uniform_real_distribution<double> uniform(0.0, 1.0);
+            size_t chosen = std::uniform_int_distribution<size_t>(0, n - 1)(
+                generator
+            );
+
+            centers.assign(k * dimension, (T) 0);
+
+            for(size_t c = 0; c < k; ++c)
+            {
+                // Copy the chosen NVector.
+                T* center = centers.data() + c * dimension;
+                std::copy(rows[chosen], rows[chosen] + dimension, center);
+
+                if(c + 1 == k) break;
+
+                // Update the distances to the closest centroid.
+                auto function = [&](size_t first, size_t last)
+                {
+                    for(size_t i = first; i < last; ++i)
+                        closest[i] = std::min(
+                            closest[i], squaredDistance(rows[i], center)
+                        );
+                };
+
+                if(parallel)
+                    ParallelGeneral::parallelFor(0, n, parallelGrain, function);
+                else
+                    function(0, n);
+
+                // Choose the next one, proportionally to the distances.
+                double total = 0.0;
+                for(size_t i = 0; i < n; ++i) total += (double) closest[i];
+
+                double target = uniform(generator) * total;
+                chosen = n - 1;
+                for(size_t i = 0; i < n; ++i)
+                {
+                    target -= (double) closest[i];
+                    if(target < 0.0 && closest[i] > (T) 0)
+                    {
+                        chosen = i;
+                        break;
+                    }
+                }
+            }
+        }
+
+
+        /**
+         * Returns the squared Euclidean distance between the given entries.
+         * 
+         * @param a The entries of the first NVector.
+         * 
+         * @param b The entries of the second NVector.
+         * 
+         * @return The squared distance.
+        */
+        T squaredDistance(const T* a, const T* b) noexcept
+        {
+            // Auxiliary variables.
+            T accum = (T) 0;
+
+            for(size_t j = 0; j < dimension; ++j)
+                accum += (a[j] - b[j]) * (a[j] - b[j]);
+
+            return accum;
+        }
+
+
+        /**
+         * Moves each centroid to the mean of its NVectors; the centroids
+         * without NVectors are kept.
+         * 
+         * @param sums The sum of the NVectors of each centroid.
+         * 
+         * @param members The number of NVectors of each centroid.
+         * 
+         * @return The distance moved by each centroid.
+        */
+        std::vector<T> update(
+            const std::vector<Sum>& sums, const std::vector<size_t>& members
+        )
+        {
+            // Auxiliary variables.
+            std::vector<T> shifts(k, (T) 0);
+
+            for(size_t c = 0; c < k; ++c)
+            {
+                if(members[c] == 0) continue;
+
+                T* center = centers.data() + c * dimension;
+                T shift = (T) 0;
+                for(size_t j = 0; j < dimension; ++j)
+                {
+                    T mean = (T) (sums[c * dimension + j] / (Sum) members[c]);
+                    shift += (mean - center[j]) * (mean - center[j]);
+                    center[j] = mean;
+                }
+
+                shifts[c] = std::sqrt(shift);
+            }
+
+            return shifts;
+        }
+
+
+        //######################################################################
+        // Variables
+        //######################################################################
+
+
+        // Minimum number of NVectors that each thread must process.
+        static constexpr size_t parallelGrain{4096};
+
+
+        // Random number generator of the seeding.
+        std::mt19937_64 generator;
+
+
+        // Index of the centroid of each of the NVectors.
+        std::vector<size_t> assignments;
+
+
+        // Entries of the centroids, one after the other.
+        std::vector<T> centers;
+
+
+        // Number of NVectors of each centroid seen by the mini-batches.
+        std::vector<size_t> counts;
+
+
+        // Size of the centroids; zero, if it has not been fitted.
+        size_t dimension{0};
+
+
+        // Number of iterations, or of mini-batches.
+        size_t iteration{0};
+
+
+        // Number of centroids.
+        size_t k{0};
+
+
+        // Sum of the squared distances to the centroids.
+        T inertiaValue{0};
+    };
+}
@@ -10,13 +10,28 @@
 
 
 // General.
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <limits>
 #include <ostream>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 
 // User defined.
+#include "./Headers/Exceptions/exceptionsNumerical.hpp"
+#include "./Headers/Exceptions/exceptionsResults.hpp"
+#include "./Headers/Hashing/hashingGeneral.hpp"
+#include "./Headers/Math/mathCompensated.hpp"
+#include "./Headers/Memory/memoryAllocators.hpp"
+#include "./Headers/Types/typesInteger.hpp"
 #include "./Headers/Validation/validationGeneral.hpp"
 #include "./Headers/Validation/validationNumerical.hpp"
 
@@ -28,15 +43,81 @@
 
 namespace NVector
 {
+    //##########################################################################
+    // Types
+    //##########################################################################
+
+
+    /**
+     * Tag type to construct the vectors without initializing their entries.
+    */
+    struct Uninitialized {};
+
+
+    // Tag to construct the vectors without initializing their entries.
+    constexpr Uninitialized uninitialized{};
+
+
+    //##########################################################################
+    // Enumerations
+    //##########################################################################
+
+
+    /**
+     * Precision with which the dot products and norms are accumulated:
+     * Standard, with plain sums in the accumulation type; or Compensated,
+     * with the Dot2 algorithm, see MathCompensated::dot2, i.e., as accurate
+     * as if computed with twice the precision of the accumulation type, at
+     * about the cost of the standard sums when there is a fast fused
+     * multiply-add. The integer and fixed point types are exact either way.
+    */
+    enum class Precision {Standard, Compensated};
+
+
     //##########################################################################
     // Classes
     //##########################################################################
 
 
-    template <typename T>
+    /**
+     * Class of vectors whose entries are stored with type T and whose
+     * reductions, i.e., dot products and norms, are accumulated with type A.
+     * By default both types are the same; a wider accumulation type gives
+     * more accurate reductions, e.g., NVector<float, double>, and a reduced
+     * precision storage type, e.g., NVector<TypesFloating::BFloat16, float>,
+     * halves the memory while the arithmetic is done in the wider type.
+     * The integer and fixed point types, e.g., NVector<int32_t> and
+     * NVector<TypesInteger::Fixed<int16_t, 15>>, accumulate in 64 bits by
+     * default, see TypesInteger::Accumulator, and their reductions either
+     * are exact or throw ExceptionsNumerical::Overflow.
+    */
+    template <
+        typename T, typename A = typename TypesInteger::Accumulator<T>::type
+    >
     class NVector
     {
         public:
+        //######################################################################
+        // Types
+        //######################################################################
+
+
+        // Types of the entries, as the standard containers name them.
+        typedef T value_type;
+        typedef size_t size_type;
+        typedef T& reference;
+        typedef const T& const_reference;
+
+
+        // Type with which the reductions are accumulated.
+        typedef A accumulator_type;
+
+
+        // Contiguous iterators over the entries.
+        typedef T* iterator;
+        typedef const T* const_iterator;
+
+
         //######################################################################
         // Operator Overloads
         //######################################################################
@@ -58,10 +139,10 @@ namespace NVector
          * @return A copy of the vector with the value added to each of its 
          * entries.
         */
-        friend NVector<T> operator + (NVector<T> vector, T value)
+        friend NVector<T, A> operator + (NVector<T, A> vector, T value)
         {
             // Add the value to the vector.
-            for(size_t i = 0; i < vector.size(); ++i) vector[i] += value;
+            vector += value;
 
             return vector;
         }
@@ -78,10 +159,10 @@ namespace NVector
          * @return A copy of the vector with the value added to each of its 
          * entries.
         */
-        friend NVector<T> operator + (T value, NVector<T> vector)
+        friend NVector<T, A> operator + (T value, NVector<T, A> vector)
         {
             // Add the value to the vector.
-            for(size_t i = 0; i < vector.size(); ++i) vector[i] += value;
+            vector += value;
 
             return vector;
         }
@@ -96,15 +177,10 @@ namespace NVector
          * @return A copy of the vector with the value added to each of its
          * entries.
         */
-        NVector<T> operator + (NVector<T> vector)
+        NVector<T, A> operator + (NVector<T, A> vector)
         {
-            // Validate the dimensionality of the vector to be added.
-            ValidationGeneral::validateDimensions(
-                dimension, vector.size(), true
-            );
-            
             // Add the values.
-            for(size_t i = 0; i < vector.size(); ++i) vector[i] += container[i];
+            vector += *this;
 
             return vector;
         }
@@ -121,13 +197,10 @@ namespace NVector
          * @return A copy of the vector with each of its entries divided by the
          * given value.
         */
-        friend NVector<T> operator / (NVector<T> vector, T value)
+        friend NVector<T, A> operator / (NVector<T, A> vector, T value)
         {   
-            // Validate finite division.
-            ValidationGeneral::isNotDivingByZero(value, true);
-
             // Divide each entry.
-            for(size_t i = 0; i < vector.size(); ++i) vector[i] /= value;
+            vector /= value;
 
             return vector;
         }
@@ -144,10 +217,10 @@ namespace NVector
          * @return A copy of the vector with each of its entries multiplied by
          * the given value.
         */
-        friend NVector<T> operator * (NVector<T> vector, T value)
+        friend NVector<T, A> operator * (NVector<T, A> vector, T value)
         {
             // Multiply each entry.
-            for(size_t i = 0; i < vector.size(); ++i) vector[i] *= value;
+            vector *= value;
 
             return vector;
         }
@@ -164,10 +237,10 @@ namespace NVector
          * @return A copy of the vector with each of its entries multiplied by
          * the given value.
         */
-        friend NVector<T> operator * (T value, NVector<T> vector)
+        friend NVector<T, A> operator * (T value, NVector<T, A> vector)
         {
             // Multiply each entry.
-            for(size_t i = 0; i < vector.size(); ++i) vector[i] *= value;
+            vector *= value;
 
             return vector;
         }
@@ -181,10 +254,10 @@ namespace NVector
          * 
          * @param value The value to be subtracted.
         */
-        friend NVector<T> operator - (NVector<T> vector, const T value)
+        friend NVector<T, A> operator - (NVector<T, A> vector, const T value)
         {           
             // Subtract from each vector component.
-            for(size_t i = 0; i < vector.size(); ++i) vector[i] -= value;
+            vector -= value;
 
             return vector;
         }
@@ -198,11 +271,12 @@ namespace NVector
          * 
          * @param vector The vector to be subtracted.
         */
-        friend NVector<T> operator - (const T value, NVector<T> vector)
+        friend NVector<T, A> operator - (const T value, NVector<T, A> vector)
         {            
             // Subtract from each vector entry.
-            for(size_t i = 0; i < vector.size(); ++i)
-                vector[i] = value - vector[i];
+            T* entries = vector.data();
+            for(size_t i = 0; i < vector.dimension; ++i)
+                entries[i] = value - entries[i];
 
             return vector;
         }
@@ -217,7 +291,7 @@ namespace NVector
          * @return A copy of the vector with the value added to each of its
          * entries.
         */
-        NVector<T> operator - (NVector<T> vector)
+        NVector<T, A> operator - (NVector<T, A> vector)
         {
             // Validate the dimensionality of the vector to be added.
             ValidationGeneral::validateDimensions(
@@ -225,38 +299,262 @@ namespace NVector
             );
             
             // Subtract each value.
-            for(size_t i = 0; i < container.size(); ++i)
-                vector[i] = container[i] - vector[i];
+            T* entries = vector.data();
+            for(size_t i = 0; i < dimension; ++i)
+                entries[i] = container[i] - entries[i];
+
+            return vector;
+        }
+
+
+        /**
+         * Multiplication operator overload. To multiply another NVector with
+         * the current NVector, entry by entry.
+         * 
+         * @param vector The vector to be multiplied with the current vector.
+         * 
+         * @return A copy of the vector with each of its entries multiplied by
+         * the entry of the current vector.
+        */
+        NVector<T, A> operator * (NVector<T, A> vector)
+        {
+            // Multiply the values.
+            vector *= *this;
+
+            return vector;
+        }
+
+
+        /**
+         * Division operator overload. To divide the current NVector by another
+         * NVector, entry by entry.
+         * 
+         * @param vector The vector by which the current vector is divided.
+         * 
+         * @return A copy of the current vector with each of its entries
+         * divided by the entry of the given vector.
+        */
+        NVector<T, A> operator / (NVector<T, A> vector)
+        {
+            // Validate the dimensionality of the vector.
+            ValidationGeneral::validateDimensions(
+                dimension, vector.size(), true
+            );
+
+            // Validate finite division, before any entry is modified.
+            T* entries = vector.data();
+            for(size_t i = 0; i < dimension; ++i)
+                ValidationGeneral::isNotDivingByZero((A) entries[i], true);
+
+            // Divide each value.
+            for(size_t i = 0; i < dimension; ++i)
+                entries[i] = (T) ((A) container[i] / (A) entries[i]);
 
             return vector;
         }
 
 
+        ////////////////////////////////////////////////////////////////////////
+        // Compound Assignment
+        ////////////////////////////////////////////////////////////////////////
+
+
+        /**
+         * Addition assignment operator. To add a scalar quantity to each of the
+         * entries of the current NVector.
+         * 
+         * @param value The value to be added.
+         * 
+         * @return A reference to the vector itself.
+        */
+        NVector<T, A>& operator += (T value)
+        {
+            for(size_t i = 0; i < dimension; ++i) container[i] += value;
+            normValid = false;
+
+            return *this;
+        }
+
+
+        /**
+         * Addition assignment operator. To add another NVector to the current
+         * NVector, entry by entry.
+         * 
+         * @param vector The vector to be added.
+         * 
+         * @return A reference to the vector itself.
+        */
+        NVector<T, A>& operator += (const NVector<T, A>& vector)
+        {
+            // Validate the dimensionality of the vector to be added.
+            ValidationGeneral::validateDimensions(
+                dimension, vector.dimension, true
+            );
+
+            combineKernel(
+                vector.container.data(), [](T a, T b) { return a + b; }
+            );
+
+            return *this;
+        }
+
+
+        /**
+         * Division assignment operator. To divide each of the entries of the
+         * current NVector by a scalar quantity.
+         * 
+         * @param value The value by which each entry will be divided.
+         * 
+         * @return A reference to the vector itself.
+        */
+        NVector<T, A>& operator /= (T value)
+        {
+            // Validate finite division.
+            ValidationGeneral::isNotDivingByZero((A) value, true);
+
+            divideKernel((A) value);
+
+            return *this;
+        }
+
+
+        /**
+         * Division assignment operator. To divide the current NVector by
+         * another NVector, entry by entry.
+         * 
+         * @param vector The vector by which the current vector is divided.
+         * 
+         * @return A reference to the vector itself.
+        */
+        NVector<T, A>& operator /= (const NVector<T, A>& vector)
+        {
+            // Validate the dimensionality of the vector.
+            ValidationGeneral::validateDimensions(
+                dimension, vector.dimension, true
+            );
+
+            // Auxiliary variables.
+            const T* entries = vector.container.data();
+
+            // Validate finite division, before any entry is modified.
+            for(size_t i = 0; i < dimension; ++i)
+                ValidationGeneral::isNotDivingByZero((A) entries[i], true);
+
+            combineKernel(
+                entries, [](T a, T b) { return (T) ((A) a / (A) b); }
+            );
+
+            return *this;
+        }
+
+
+        /**
+         * Multiplication assignment operator. To multiply each of the entries
+         * of the current NVector by a scalar quantity.
+         * 
+         * @param value The value by which each entry will be multiplied.
+         * 
+         * @return A reference to the vector itself.
+        */
+        NVector<T, A>& operator *= (T value)
+        {
+            for(size_t i = 0; i < dimension; ++i) container[i] *= value;
+            normValid = false;
+
+            return *this;
+        }
+
+
+        /**
+         * Multiplication assignment operator. To multiply the current NVector
+         * by another NVector, entry by entry.
+         * 
+         * @param vector The vector by which the current vector is multiplied.
+         * 
+         * @return A reference to the vector itself.
+        */
+        NVector<T, A>& operator *= (const NVector<T, A>& vector)
+        {
+            // Validate the dimensionality of the vector.
+            ValidationGeneral::validateDimensions(
+                dimension, vector.dimension, true
+            );
+
+            combineKernel(
+                vector.container.data(), [](T a, T b) { return a * b; }
+            );
+
+            return *this;
+        }
+
+
+        /**
+         * Subtraction assignment operator. To subtract a scalar quantity from
+         * each of the entries of the current NVector.
+         * 
+         * @param value The value to be subtracted.
+         * 
+         * @return A reference to the vector itself.
+        */
+        NVector<T, A>& operator -= (T value)
+        {
+            for(size_t i = 0; i < dimension; ++i) container[i] -= value;
+            normValid = false;
+
+            return *this;
+        }
+
+
+        /**
+         * Subtraction assignment operator. To subtract another NVector from
+         * the current NVector, entry by entry.
+         * 
+         * @param vector The vector to be subtracted.
+         * 
+         * @return A reference to the vector itself.
+        */
+        NVector<T, A>& operator -= (const NVector<T, A>& vector)
+        {
+            // Validate the dimensionality of the vector to be subtracted.
+            ValidationGeneral::validateDimensions(
+                dimension, vector.dimension, true
+            );
+
+            combineKernel(
+                vector.container.data(), [](T a, T b) { return a - b; }
+            );
+
+            return *this;
+        }
+
+
         ////////////////////////////////////////////////////////////////////////
         // Other Functionality
         ////////////////////////////////////////////////////////////////////////
 
 
         /**
-         * Comparison operator. To be able to access the indexes of the
-         * vector for comparison.
+         * Comparison operator. To compare the vectors, entry by entry, for
+         * exact equality.
          * 
          * @param vector_1 A reference to the first NVector being compared.
          * 
          * @param vector_2 A reference to the second NVector being compared.
         */
-        friend bool operator == (NVector<T>& vector_1, NVector<T>& vector_2)
+        friend bool operator == (
+            const NVector<T, A>& vector_1, const NVector<T, A>& vector_2
+        )
         {   
             // Auxiliary variables.
             bool valid = ValidationGeneral::validateDimensions(
-                vector_1.size(), vector_2.size(), false
+                vector_1.dimension, vector_2.dimension, false
             );
 
-            // Check item by item.
-            for(size_t i = 0; valid && i < vector_1.size(); ++i)
-                valid = valid && vector_1[i] == vector_2[i];
-                
-            return valid;
+            // Check the raw storage.
+            return valid && std::equal(
+                vector_1.container.begin(), vector_1.container.end(),
+                vector_2.container.begin()
+            );
         }
 
 
@@ -268,7 +566,9 @@ namespace NVector
          * 
          * @param vector A copy of the vector to be printed.
         */
-        friend std::ostream& operator << (std::ostream& out, NVector<T> vector)
+        friend std::ostream& operator << (
+            std::ostream& out, NVector<T, A> vector
+        )
         {   
             // Auxiliary variables.
             size_t length{vector.size() - 1};
@@ -292,7 +592,8 @@ namespace NVector
 
         /**
          * Index operator overload. To be able to access the indexes of the
-         * vector.
+         * vector. The cached norm, if any, is invalidated, since the entry
+         * can be written through the returned reference.
          * 
          * @param index The requested index to be accessed.
         */
@@ -304,6 +605,26 @@ namespace NVector
             // Validate the index is in range.
             ValidationGeneral::validateInRange(index, lower, upper, true);
 
+            normValid = false;
+
+            return container[index];
+        }
+
+
+        /**
+         * Index operator overload, for constant vectors; the entries can not
+         * be written, so the cached norm is kept.
+         * 
+         * @param index The requested index to be accessed.
+        */
+        const T& operator [] (size_t index) const
+        {   
+            // Auxiliary variables.
+            size_t lower{0}, upper{dimension - 1};
+
+            // Validate the index is in range.
+            ValidationGeneral::validateInRange(index, lower, upper, true);
+
             return container[index];
         }
 
@@ -325,17 +646,18 @@ namespace NVector
         {
             // Validate the quantities.
             ValidationNumerical::rangeGreater<size_t>(0, dimension, true);
-            ValidationNumerical::isFloating<T>((T) 1, true);
+            ValidationNumerical::isStorage<T>((T) 1, true);
+            ValidationNumerical::isAccumulator<A>((A) 1, true);
 
             // Create with the exact number of entries.
-            container = std::vector<T>(dimension, (T) 0);
+            container.assign(dimension, (T) 0);
             container.shrink_to_fit();
         }
 
 
         /**
-         * Constructs a new vector type; the only allowed types are floating
-         * type vectors.
+         * Constructs a new vector type; the only allowed types are the
+         * storage types, see ValidationNumerical::isStorage.
          * 
          * @param dimensions The number of entries the vector has; must be 
          * greater than zero.
@@ -347,189 +669,1326 @@ namespace NVector
         {   
             // Validate the quantities.
             ValidationNumerical::rangeGreater<size_t>(0, dimension, true);
-            ValidationNumerical::isFloating<T>(value, true);
+            ValidationNumerical::isStorage<T>(value, true);
+            ValidationNumerical::isAccumulator<A>((A) 1, true);
 
             // Create with the exact number of entries.
-            container = std::vector<T>(dimension, value);
+            container.assign(dimension, value);
             container.shrink_to_fit();
         }
 
 
         /**
-         * Destructs the given object pointer.
+         * Constructs a new vector type whose entries are not initialized; to
+         * be used when all the entries are going to be overwritten.
+         * 
+         * @param dimensions The number of entries the vector has; must be 
+         * greater than zero.
         */
-        ~NVector(){}
-
+        NVector(size_t dimensions, Uninitialized) :
+        dimension{dimensions}
+        {   
+            // Validate the quantities.
+            ValidationNumerical::rangeGreater<size_t>(0, dimension, true);
+            ValidationNumerical::isStorage<T>((T) 1, true);
+            ValidationNumerical::isAccumulator<A>((A) 1, true);
 
-        //######################################################################
-        // Functions
-        //######################################################################
+            // Create with the exact number of entries, without setting them.
+            container.resize(dimension);
+            container.shrink_to_fit();
+        }
 
 
-        ////////////////////////////////////////////////////////////////////////
-        // Non-Template Functions
-        ////////////////////////////////////////////////////////////////////////
+        /**
+         * Constructs a new vector type whose entries are given by the
+         * generator, without initializing them first.
+         * 
+         * @param dimensions The number of entries the vector has; must be 
+         * greater than zero.
+         * 
+         * @param generator The function, with signature T generator(size_t
+         * index), that returns the value of the entry with the given index.
+        */
+        template <
+            typename G,
+            std::enable_if_t<std::is_invocable_r_v<T, G&, size_t>, int> = 0
+        >
+        NVector(size_t dimensions, G generator) :
+        NVector(dimensions, uninitialized)
+        {   
+            // Set the entries.
+            for(size_t i = 0; i < dimension; ++i) container[i] = generator(i);
+        }
 
 
         /**
-         * Returns the current size of the container.
+         * Constructs a new vector type with the values of the given range,
+         * without initializing the entries first.
          * 
-         * @return The current size of the container.
+         * @param first The iterator to the first value.
+         * 
+         * @param last The iterator after the last value; the range must not
+         * be empty.
         */
-        size_t size()
-        {
-            return dimension;
+        template <
+            typename I,
+            std::enable_if_t<
+                std::is_base_of_v<
+                    std::forward_iterator_tag,
+                    typename std::iterator_traits<I>::iterator_category
+                >, int
+            > = 0
+        >
+        NVector(I first, I last) :
+        NVector((size_t) std::distance(first, last), uninitialized)
+        {   
+            // Set the entries.
+            std::copy(first, last, container.begin());
         }
 
 
-        ////////////////////////////////////////////////////////////////////////
-        // Template Functions
-        ////////////////////////////////////////////////////////////////////////
+        /**
+         * Constructs a copy of the given vector.
+         * 
+         * @param vector The vector to be copied.
+        */
+        NVector(const NVector<T, A>& vector) = default;
 
 
         /**
-         * Returns the cross product between two vectors.
+         * Constructs a vector by taking the storage of the given vector. The
+         * given vector is left empty, i.e., with zero entries.
          * 
-         * @return The cross product between the two given vectors, where the
-         * cross product will be calculated using the passed vector as the
-         * second argument.
-        */ 
-        NVector<T> crossProduct(NVector<T> vector)
+         * @param vector The vector whose storage will be taken.
+        */
+        NVector(NVector<T, A>&& vector) noexcept :
+        container{std::move(vector.container)},
+        dimension{vector.dimension},
+        normCached{vector.normCached},
+        normValid{vector.normValid},
+        normValue{vector.normValue},
+        precision{vector.precision}
         {
-            // Validate the sizes are the same and of size 3.
-            ValidationGeneral::validateDimensions(3, size(), true);
-            ValidationGeneral::validateDimensions(size(), vector.size(), true);
-
-            // Auxiliary variables.
-            NVector<T> vector0 = NVector<T>(dimension);
-            
-            // Set the components to the appropriate values.
-            vector0[0] = container[1] * vector[2] - container[2] * vector[1];
-            vector0[1] = container[2] * vector[0] - container[0] * vector[2];
-            vector0[2] = container[0] * vector[1] - container[1] * vector[0];
-            
-            return vector0;
+            // The storage is gone, its size and norm too.
+            vector.container.clear();
+            vector.dimension = 0;
+            vector.normValid = false;
         }
 
 
         /**
-         * Returns the normalized version of the vector itself.
-         * 
-         * @return The normalized vector, if its norm is not zero.
-        */ 
-        NVector<T> normalize()
-        {
-            // Validate the sizes are the same.
-            T vnorm = norm();
-            ValidationGeneral::isNotDivingByZero(vnorm, true);
-
-            // Auxiliary variables.
-            NVector<T> vector = NVector<T>(dimension);
+         * Destructs the given object pointer.
+        */
+        ~NVector(){}
+
+
+        //######################################################################
+        // Assignment
+        //######################################################################
+
+
+        /**
+         * Copy assignment operator.
+         * 
+         * @param vector The vector to be copied.
+         * 
+         * @return A reference to the vector itself.
+        */
+        NVector<T, A>& operator = (const NVector<T, A>& vector) = default;
+
+
+        /**
+         * Move assignment operator. The storage of the given vector is taken
+         * and the given vector is left empty, i.e., with zero entries.
+         * 
+         * @param vector The vector whose storage will be taken.
+         * 
+         * @return A reference to the vector itself.
+        */
+        NVector<T, A>& operator = (NVector<T, A>&& vector) noexcept
+        {
+            // Moving a vector onto itself keeps it.
+            if(this == &vector) return *this;
+
+            container = std::move(vector.container);
+            dimension = vector.dimension;
+            normCached = vector.normCached;
+            normValid = vector.normValid;
+            normValue = vector.normValue;
+            precision = vector.precision;
+
+            // The storage is gone, its size and norm too.
+            vector.container.clear();
+            vector.dimension = 0;
+            vector.normValid = false;
+
+            return *this;
+        }
+
+
+        //######################################################################
+        // Functions
+        //######################################################################
+
+
+        ////////////////////////////////////////////////////////////////////////
+        // Non-Template Functions
+        ////////////////////////////////////////////////////////////////////////
+
+
+        /**
+         * Returns an iterator to the first entry, for the standard algorithms
+         * and execution policies. The cached norm, if any, is invalidated, as
+         * with data().
+         * 
+         * @return A contiguous iterator to the first entry.
+        */
+        iterator begin()
+        {
+            normValid = false;
+
+            return container.data();
+        }
+
+
+        /**
+         * Returns an iterator to the first entry of a constant vector.
+         * 
+         * @return A contiguous iterator to the first entry.
+        */
+        const_iterator begin() const
+        {
+            return container.data();
+        }
+
+
+        /**
+         * Enables or disables the caching of the norm. When enabled, the
+         * squared norm is computed once and reused until the vector may be
+         * modified, i.e., until the non-constant index operator, data(),
+         * begin(), end(), an in-place operation or a mutating operation of a
+         * view of the vector is used; read through a constant reference to
+         * keep the cache. The entries written later through a retained
+         * reference, pointer or iterator are not tracked, call
+         * invalidateNorm() after writing through them.
+         * 
+         * @param cache True, if the norm must be cached; False, otherwise.
+        */
+        void cacheNorm(bool cache)
+        {
+            normCached = cache;
+            normValid = false;
+        }
+
+
+        /**
+         * Returns an iterator to the first entry, that can not write the
+         * entries; the cached norm is kept.
+         * 
+         * @return A contiguous iterator to the first entry.
+        */
+        const_iterator cbegin() const
+        {
+            return container.data();
+        }
+
+
+        /**
+         * Returns an iterator after the last entry, that can not write the
+         * entries; the cached norm is kept.
+         * 
+         * @return A contiguous iterator after the last entry.
+        */
+        const_iterator cend() const
+        {
+            return container.data() + dimension;
+        }
+
+
+        /**
+         * Returns a pointer to the contiguous storage of the vector. To be
+         * used by the bulk kernels, which must skip the checked index
+         * operator. The cached norm, if any, is invalidated, since the entries
+         * can be written through the returned pointer.
+         * 
+         * @return A pointer to the first entry of the vector.
+        */
+        T* data()
+        {
+            normValid = false;
+
+            return container.data();
+        }
+
+
+        /**
+         * Returns a pointer to the contiguous storage of a constant vector.
+         * 
+         * @return A pointer to the first entry of the vector.
+        */
+        const T* data() const
+        {
+            return container.data();
+        }
+
+
+        /**
+         * Returns an iterator after the last entry. The cached norm, if any,
+         * is invalidated, as with data().
+         * 
+         * @return A contiguous iterator after the last entry.
+        */
+        iterator end()
+        {
+            normValid = false;
+
+            return container.data() + dimension;
+        }
+
+
+        /**
+         * Returns an iterator after the last entry of a constant vector.
+         * 
+         * @return A contiguous iterator after the last entry.
+        */
+        const_iterator end() const
+        {
+            return container.data() + dimension;
+        }
+
+
+        /**
+         * Returns the precision with which the dot products and norms are
+         * accumulated when none is requested.
+         * 
+         * @return The default precision of the reductions.
+        */
+        Precision getPrecision() const
+        {
+            return precision;
+        }
+
+
+        /**
+         * Marks the cached norm, if any, as stale, such that it is computed
+         * again when requested. To be called after writing the entries
+         * through a retained reference, pointer or iterator.
+        */
+        void invalidateNorm() const
+        {
+            normValid = false;
+        }
+
+
+        /**
+         * Determines if the norm of the vector is being cached.
+         * 
+         * @return True, if the norm is being cached; False, otherwise.
+        */
+        bool isNormCached() const
+        {
+            return normCached;
+        }
+
+
+        /**
+         * Sets the precision with which the dot products and norms are
+         * accumulated when none is requested; the cached norm, if any, is
+         * invalidated, since it was accumulated with the previous one.
+         * 
+         * @param value The default precision of the reductions.
+        */
+        void setPrecision(Precision value)
+        {
+            precision = value;
+            normValid = false;
+        }
+
+
+        /**
+         * Returns the current size of the container.
+         * 
+         * @return The current size of the container.
+        */
+        size_t size() const
+        {
+            return dimension;
+        }
+
+
+        ////////////////////////////////////////////////////////////////////////
+        // Template Functions
+        ////////////////////////////////////////////////////////////////////////
+
+
+        /**
+         * Returns the cross product between two vectors.
+         * 
+         * @return The cross product between the two given vectors, where the
+         * cross product will be calculated using the passed vector as the
+         * second argument.
+        */ 
+        NVector<T, A> crossProduct(NVector<T, A> vector)
+        {
+            // Validate the sizes are the same and of size 3.
+            ValidationGeneral::validateDimensions(3, size(), true);
+            ValidationGeneral::validateDimensions(size(), vector.size(), true);
+
+            // Auxiliary variables.
+            NVector<T, A> vector0 = NVector<T, A>(dimension);
+            
+            // Set the components to the appropriate values.
+            vector0[0] = container[1] * vector[2] - container[2] * vector[1];
+            vector0[1] = container[2] * vector[0] - container[0] * vector[2];
+            vector0[2] = container[0] * vector[1] - container[1] * vector[0];
+
+            return vector0;
+        }
+
+
+        /**
+         * Calculates the cross product between two vectors and stores it in
+         * the given, preallocated, output vector.
+         * 
+         * @param vector The vector that will be used as the second argument of
+         * the cross product.
+         * 
+         * @param output The vector where the result will be stored; it can be
+         * the vector itself or the given vector.
+        */
+        void crossProduct(const NVector<T, A>& vector, NVector<T, A>& output)
+        {
+            // Validate the sizes are the same and of size 3.
+            ValidationGeneral::validateDimensions(3, size(), true);
+            ValidationGeneral::validateDimensions(size(), vector.size(), true);
+            ValidationGeneral::validateDimensions(size(), output.size(), true);
+
+            crossProductKernel(vector.container.data(), output.data());
+        }
+
+
+        /**
+         * Returns the hash of the entries of the vector; vectors that are
+         * equal have the same hash.
+         * 
+         * @return The hash of the entries of the vector.
+        */
+        size_t hash() const
+        {
+            // Auxiliary variables.
+            HashingGeneral::Hasher hasher = HashingGeneral::Hasher(dimension);
+
+            for(const T& entry : container) hasher.addValue(entry);
+
+            return (size_t) hasher.digest();
+        }
+
+
+        /**
+         * Determines if the vector is close to the given vector, entry by
+         * entry, i.e., |a - b| <= max(absolute, relative * max(|a|, |b|)).
+         * The entries are compared in blocks without branches, and the
+         * comparison stops at the first block that is not close.
+         * 
+         * @param vector The vector to be compared.
+         * 
+         * @param absolute The absolute tolerance.
+         * 
+         * @param relative The tolerance relative to the magnitude of the
+         * entries.
+         * 
+         * @return True, if the vectors have the same dimension and all the
+         * entries are close; False, otherwise.
+        */
+        bool isClose(
+            const NVector<T, A>& vector, A absolute, A relative
+        ) const
+        {
+            // Vectors with different dimensions are never close.
+            if(dimension != vector.dimension) return false;
+
+            // Auxiliary variables.
+            const T* a = container.data();
+            const T* b = vector.container.data();
+
+            for(size_t i = 0; i < dimension; i += compareBlock)
+            {
+                // Number of entries in the current block.
+                size_t last = std::min(dimension, i + compareBlock);
+                bool close{true};
+
+                for(size_t j = i; j < last; ++j)
+                {
+                    A x = (A) a[j], y = (A) b[j];
+                    A scale = std::max(std::fabs(x), std::fabs(y));
+                    A tolerance = std::max(absolute, relative * scale);
+
+                    close &= x == y || std::fabs(x - y) <= tolerance;
+                }
+
+                if(!close) return false;
+            }
+
+            return true;
+        }
+
+
+        /**
+         * Determines if the vector is close to the given vector, entry by
+         * entry, where the entries can differ in up to the given number of
+         * units in the last place; only for single and double precision.
+         * 
+         * @param vector The vector to be compared.
+         * 
+         * @param ulps The maximum number of representable numbers between
+         * the entries.
+         * 
+         * @return True, if the vectors have the same dimension and all the
+         * entries are close; False, otherwise. Not a number is never close.
+        */
+        template <typename F = T>
+        bool isCloseULP(const NVector<T, A>& vector, uint64_t ulps) const
+        {
+            // Checked on use, such that the class can be instantiated with
+            // any type.
+            static_assert(
+                std::is_same<F, float>::value || std::is_same<F, double>::value,
+                "Only single and double precision entries can be compared in "
+                "units in the last place."
+            );
+
+            // Vectors with different dimensions are never close.
+            if(dimension != vector.dimension) return false;
+
+            // Auxiliary variables.
+            typedef std::conditional_t<sizeof(T) == 4, int32_t, int64_t> I;
+            typedef std::make_unsigned_t<I> U;
+            const T* a = container.data();
+            const T* b = vector.container.data();
+
+            for(size_t i = 0; i < dimension; i += compareBlock)
+            {
+                // Number of entries in the current block.
+                size_t last = std::min(dimension, i + compareBlock);
+                bool close{true};
+
+                for(size_t j = i; j < last; ++j)
+                {
+                    // Map the bits to integers with the order of the numbers.
+                    I x, y;
+                    std::memcpy(&x, a + j, sizeof(I));
+                    std::memcpy(&y, b + j, sizeof(I));
+                    x = x < 0 ? std::numeric_limits<I>::min() - x : x;
+                    y = y < 0 ? std::numeric_limits<I>::min() - y : y;
+
+                    U distance = x > y ? (U) x - (U) y : (U) y - (U) x;
+                    close &= !std::isnan(a[j]) && !std::isnan(b[j]);
+                    close &= distance <= ulps;
+                }
+
+                if(!close) return false;
+            }
+
+            return true;
+        }
+
+
+        /**
+         * Returns the normalized version of the vector itself.
+         * 
+         * @return The normalized vector, if its norm is not zero.
+        */ 
+        template <typename F = A>
+        NVector<T, A> normalize()
+        {
+            // Checked on use, such that the class can be instantiated with
+            // any type.
+            static_assert(
+                !std::is_integral<F>::value && !TypesInteger::IsFixed<F>::value,
+                "The norm needs a floating point accumulation type, use "
+                "normSquared for the integer and fixed point vectors."
+            );
+
+            // Validate the norm is not zero.
+            A vnorm = norm();
+            ValidationGeneral::isNotDivingByZero(vnorm, true);
+
+            // Auxiliary variables.
+            NVector<T, A> vector = NVector<T, A>(dimension);
             
             // Divide each entry by its norm.
             for(size_t i = 0; i < dimension; ++i)
-                vector[i] = container[i] / vnorm;
+                vector[i] = (T) ((A) container[i] / vnorm);
             
             return vector;
         }
 
 
         /**
-         * Normalizes the vector itself, in place, if its norm is not zero.
+         * Normalizes the vector itself, in place, if its norm is not zero.
+         * 
+         * @return A copy of the normalized vector.
+        */ 
+        template <typename F = A>
+        NVector<T, A> normalizeIP()
+        {
+            // Checked on use, such that the class can be instantiated with
+            // any type.
+            static_assert(
+                !std::is_integral<F>::value && !TypesInteger::IsFixed<F>::value,
+                "The norm needs a floating point accumulation type, use "
+                "normSquared for the integer and fixed point vectors."
+            );
+
+            // Validate the norm is not zero.
+            A vnorm = norm();
+            ValidationGeneral::isNotDivingByZero(vnorm, true);
+            
+            // Divide each entry by its norm.
+            divideKernel(vnorm);
+            
+            return *this;
+        }
+
+
+        /**
+         * Projects the vector along the normalized given vector.
+         * 
+         * @param vector The vector along which the projection will happen.
+         * 
+         * @return The projetion of the vector along the normalized given 
+         * vector.
+        */ 
+        template <typename F = A>
+        NVector<T, A> projection(NVector<T, A> vector, bool normalize)
+        {
+            // Checked on use, such that the class can be instantiated with
+            // any type.
+            static_assert(
+                !std::is_integral<F>::value && !TypesInteger::IsFixed<F>::value,
+                "The norm needs a floating point accumulation type, use "
+                "normSquared for the integer and fixed point vectors."
+            );
+
+            // Normalize the vector, if required.
+            if(normalize) vector.normalizeIP();
+            
+            // Auxiliary variables.
+            A scale = dotProduct(vector);
+
+            // Set the components to the appropriate values.
+            for(size_t i = 0; i < dimension; ++i)
+                vector[i] = (T) (scale * (A) vector[i]);
+            
+            return vector;
+        }
+
+
+        /**
+         * Returns the dot product of an NVector with another NVector; the
+         * products are accumulated with the accumulation type and the
+         * default precision, see setPrecision.
+         * 
+         * @param vector The vector with which the dot product will be taken.
+         * 
+         * @return The dot product of the vector itself with the given vector.
+        */ 
+        A dotProduct(const NVector<T, A>& vector) const
+        {
+            return dotProduct(vector, precision);
+        }
+
+
+        /**
+         * Returns the dot product of an NVector with another NVector; the
+         * products are accumulated with the accumulation type and the given
+         * precision.
+         * 
+         * @param vector The vector with which the dot product will be taken.
+         * 
+         * @param requested The precision of the accumulation.
+         * 
+         * @return The dot product of the vector itself with the given vector.
+        */ 
+        A dotProduct(const NVector<T, A>& vector, Precision requested) const
+        {
+            // Validate the sizes are the same.
+            ValidationGeneral::validateDimensions(
+                dimension, vector.size(), true
+            );
+
+            // The dot product of the vector with itself can be cached.
+            if(&vector == this) return normSquared(requested);
+
+            return dotProductChecked(vector.container.data(), requested);
+        }
+
+
+        /**
+         * Returns the L2 norm of the vector, accumulated with the default
+         * precision, see setPrecision. Only available for the floating point
+         * accumulation types, the integer and fixed point vectors provide
+         * normSquared instead.
+         * 
+         * @return The L2 norm of the vector.
+        */ 
+        template <typename F = A>
+        A norm() const
+        {
+            // Checked on use, such that the class can be instantiated with
+            // any type.
+            static_assert(
+                !std::is_integral<F>::value && !TypesInteger::IsFixed<F>::value,
+                "The norm needs a floating point accumulation type, use "
+                "normSquared for the integer and fixed point vectors."
+            );
+
+            return std::sqrt(normSquared());
+        }
+
+
+        /**
+         * Returns the L2 norm of the vector, accumulated with the given
+         * precision.
+         * 
+         * @param requested The precision of the accumulation.
+         * 
+         * @return The L2 norm of the vector.
+        */ 
+        template <typename F = A>
+        A norm(Precision requested) const
+        {
+            // Checked on use, such that the class can be instantiated with
+            // any type.
+            static_assert(
+                !std::is_integral<F>::value && !TypesInteger::IsFixed<F>::value,
+                "The norm needs a floating point accumulation type, use "
+                "normSquared for the integer and fixed point vectors."
+            );
+
+            return std::sqrt(normSquared(requested));
+        }
+
+
+        /**
+         * Returns the L2 norm, squared, of the vector; if the norm is being
+         * cached, it is only computed when the vector has been modified.
          * 
-         * @return A copy of the normalized vector.
+         * @return The L2 norm, squared, of the vector.
         */ 
-        NVector<T> normalizeIP()
+        A normSquared() const
         {
-            // Validate the sizes are the same.
-            T vnorm = norm();
-            ValidationGeneral::isNotDivingByZero(vnorm, true);
-            
-            // Divide each entry by its norm.
-            for(size_t i = 0; i < dimension; ++i) container[i] /= vnorm;
-            
-            return *this;
+            // Reuse the cached value, if it is still valid.
+            if(normValid) return normValue;
+
+            // Auxiliary variables.
+            A value = dotProductChecked(container.data(), precision);
+
+            normValue = value;
+            normValid = normCached;
+
+            return value;
         }
 
 
         /**
-         * Projects the vector along the normalized given vector.
+         * Returns the L2 norm, squared, of the vector, accumulated with the
+         * given precision; the cached norm is only used, and updated, for
+         * the default precision.
          * 
-         * @param vector The vector along which the projection will happen.
+         * @param requested The precision of the accumulation.
          * 
-         * @return The projetion of the vector along the normalized given 
-         * vector.
+         * @return The L2 norm, squared, of the vector.
         */ 
-        NVector<T> projection(NVector<T> vector, bool normalize)
+        A normSquared(Precision requested) const
         {
-            // Normalize the vector, if required.
-            if(normalize) vector.normalizeIP();
-            
-            // Set the components to the appropriate values.
-            vector = dotProduct(vector) * vector;
-            
-            return vector;
+            if(requested == precision) return normSquared();
+
+            return dotProductChecked(container.data(), requested);
         }
 
 
+        ////////////////////////////////////////////////////////////////////////
+        // Non-Throwing Functions
+        ////////////////////////////////////////////////////////////////////////
+
+
         /**
-         * Returns the dot product of an NVector with another NVector.
+         * Adds another NVector to the vector itself, entry by entry,
+         * reporting the errors instead of throwing.
          * 
-         * @param vector The vector with which the dot product will be taken.
+         * @param vector The vector to be added.
          * 
-         * @return The dot product of the vector itself with the given vector.
-        */ 
-        T dotProduct(NVector<T>& vector)
+         * @return ExceptionsResults::Error::None, if the vector was added;
+         * ExceptionsResults::Error::Dimensions, otherwise.
+        */
+        ExceptionsResults::Error tryAddIP(const NVector<T, A>& vector) noexcept
         {
             // Validate the sizes are the same.
-            ValidationGeneral::validateDimensions(
-                dimension, vector.size(), true
+            if(dimension != vector.dimension)
+                return ExceptionsResults::Error::Dimensions;
+
+            combineKernel(
+                vector.container.data(), [](T a, T b) { return a + b; }
             );
 
+            return ExceptionsResults::Error::None;
+        }
+
+
+        /**
+         * Returns the value of the entry with the given index, reporting an
+         * index out of range as an error instead of throwing.
+         * 
+         * @param index The requested index to be accessed.
+         * 
+         * @return The value of the entry or
+         * ExceptionsResults::Error::IndexOutOfRange.
+        */
+        ExceptionsResults::Result<T> tryAt(size_t index) noexcept
+        {
+            // Validate the index is in range.
+            if(index >= dimension)
+                return ExceptionsResults::Error::IndexOutOfRange;
+
+            return container[index];
+        }
+
+
+        /**
+         * Calculates the cross product between two vectors and stores it in
+         * the given, preallocated, output vector; reporting the errors instead
+         * of throwing.
+         * 
+         * @param vector The vector that will be used as the second argument of
+         * the cross product.
+         * 
+         * @param output The vector where the result will be stored; it can be
+         * the vector itself or the given vector.
+         * 
+         * @return ExceptionsResults::Error::None, if the cross product was
+         * calculated; ExceptionsResults::Error::Dimensions, if any of the
+         * vectors is not of size 3.
+        */
+        ExceptionsResults::Error tryCrossProduct(
+            const NVector<T, A>& vector, NVector<T, A>& output
+        ) noexcept
+        {
+            // Validate the sizes are the same and of size 3.
+            if(
+                dimension != 3 || vector.dimension != 3 ||
+                output.dimension != 3
+            )
+                return ExceptionsResults::Error::Dimensions;
+
+            crossProductKernel(vector.container.data(), output.data());
+
+            return ExceptionsResults::Error::None;
+        }
+
+
+        /**
+         * Divides each entry of the vector itself by a scalar quantity,
+         * reporting the errors instead of throwing.
+         * 
+         * @param value The value by which each entry will be divided.
+         * 
+         * @return ExceptionsResults::Error::None, if the vector was divided;
+         * ExceptionsResults::Error::DivisionByZero, if the value is zero, in
+         * which case the vector is not modified.
+        */
+        ExceptionsResults::Error tryDivideIP(T value) noexcept
+        {
+            // Validate finite division.
+            ExceptionsResults::Error error =
+                ValidationGeneral::checkDivision((A) value);
+
+            if(error != ExceptionsResults::Error::None) return error;
+
+            divideKernel((A) value);
+
+            return ExceptionsResults::Error::None;
+        }
+
+
+        /**
+         * Divides the vector itself by another NVector, entry by entry,
+         * reporting the errors instead of throwing.
+         * 
+         * @param vector The vector by which the vector itself is divided.
+         * 
+         * @return ExceptionsResults::Error::None, if the vector was divided;
+         * ExceptionsResults::Error::Dimensions or
+         * ExceptionsResults::Error::DivisionByZero, in which case the vector
+         * is not modified.
+        */
+        ExceptionsResults::Error tryDivideIP(
+            const NVector<T, A>& vector
+        ) noexcept
+        {
+            // Validate the sizes are the same.
+            if(dimension != vector.dimension)
+                return ExceptionsResults::Error::Dimensions;
+
             // Auxiliary variables.
-            T accum = (T) 0;
+            const T* entries = vector.container.data();
 
-            // Perform the dot product.
+            // Validate finite division, before any entry is modified.
             for(size_t i = 0; i < dimension; ++i)
-                accum += container[i] * vector[i];
-            
-            return accum;
+                if(
+                    ValidationGeneral::checkDivision((A) entries[i]) !=
+                    ExceptionsResults::Error::None
+                )
+                    return ExceptionsResults::Error::DivisionByZero;
+
+            combineKernel(
+                entries, [](T a, T b) { return (T) ((A) a / (A) b); }
+            );
+
+            return ExceptionsResults::Error::None;
         }
 
 
         /**
-         * Returns the L2 norm of the vector.
+         * Returns the dot product of an NVector with another NVector,
+         * reporting the errors instead of throwing.
          * 
-         * @return The L2 norm of the vector.
-        */ 
-        T norm()
+         * @param vector The vector with which the dot product will be taken.
+         * 
+         * @return The dot product of the vector itself with the given vector,
+         * ExceptionsResults::Error::Dimensions or, for the integer types,
+         * ExceptionsResults::Error::Overflow.
+        */
+        ExceptionsResults::Result<A> tryDotProduct(
+            const NVector<T, A>& vector
+        ) const noexcept
         {
-            return std::sqrt(normSquared());
+            // Validate the sizes are the same.
+            ExceptionsResults::Error error =
+                ValidationGeneral::checkDimensions(dimension, vector.dimension);
+
+            if(error != ExceptionsResults::Error::None) return error;
+
+            // Auxiliary variables.
+            bool overflow{false};
+            A value = dotProductKernel(
+                vector.container.data(), precision, overflow
+            );
+
+            if(overflow) return ExceptionsResults::Error::Overflow;
+
+            return value;
         }
 
 
         /**
-         * Returns the L2 norm, squared, of the vector.
+         * Multiplies the vector itself by another NVector, entry by entry,
+         * reporting the errors instead of throwing.
          * 
-         * @return The L2 norm, squared, of the vector.
-        */ 
-        T normSquared()
+         * @param vector The vector by which the vector itself is multiplied.
+         * 
+         * @return ExceptionsResults::Error::None, if the vector was
+         * multiplied; ExceptionsResults::Error::Dimensions, otherwise.
+        */
+        ExceptionsResults::Error tryMultiplyIP(
+            const NVector<T, A>& vector
+        ) noexcept
+        {
+            // Validate the sizes are the same.
+            if(dimension != vector.dimension)
+                return ExceptionsResults::Error::Dimensions;
+
+            combineKernel(
+                vector.container.data(), [](T a, T b) { return a * b; }
+            );
+
+            return ExceptionsResults::Error::None;
+        }
+
+
+        /**
+         * Normalizes the vector itself, in place, if its norm is not zero;
+         * reporting the errors instead of throwing.
+         * 
+         * @return ExceptionsResults::Error::None, if the vector was
+         * normalized; ExceptionsResults::Error::DivisionByZero, if its norm is
+         * zero, in which case the vector is not modified.
+        */
+        template <typename F = A>
+        ExceptionsResults::Error tryNormalizeIP() noexcept
+        {
+            // Checked on use, such that the class can be instantiated with
+            // any type.
+            static_assert(
+                !std::is_integral<F>::value && !TypesInteger::IsFixed<F>::value,
+                "The norm needs a floating point accumulation type, use "
+                "normSquared for the integer and fixed point vectors."
+            );
+
+            // Validate the norm is not zero.
+            A vnorm = std::sqrt(normSquared());
+            ExceptionsResults::Error error =
+                ValidationGeneral::checkDivision(vnorm);
+
+            if(error != ExceptionsResults::Error::None) return error;
+
+            // Divide each entry by its norm.
+            divideKernel(vnorm);
+
+            return ExceptionsResults::Error::None;
+        }
+
+
+        /**
+         * Sets the value of the entry with the given index, reporting an index
+         * out of range as an error instead of throwing.
+         * 
+         * @param index The requested index to be set.
+         * 
+         * @param value The value to be set.
+         * 
+         * @return ExceptionsResults::Error::None, if the value was set;
+         * ExceptionsResults::Error::IndexOutOfRange, otherwise.
+        */
+        ExceptionsResults::Error trySet(size_t index, T value) noexcept
+        {
+            // Validate the index is in range.
+            if(index >= dimension)
+                return ExceptionsResults::Error::IndexOutOfRange;
+
+            container[index] = value;
+            normValid = false;
+
+            return ExceptionsResults::Error::None;
+        }
+
+
+        /**
+         * Subtracts another NVector from the vector itself, entry by entry,
+         * reporting the errors instead of throwing.
+         * 
+         * @param vector The vector to be subtracted.
+         * 
+         * @return ExceptionsResults::Error::None, if the vector was
+         * subtracted; ExceptionsResults::Error::Dimensions, otherwise.
+        */
+        ExceptionsResults::Error trySubtractIP(
+            const NVector<T, A>& vector
+        ) noexcept
         {
-            return dotProduct(*this);
+            // Validate the sizes are the same.
+            if(dimension != vector.dimension)
+                return ExceptionsResults::Error::Dimensions;
+
+            combineKernel(
+                vector.container.data(), [](T a, T b) { return a - b; }
+            );
+
+            return ExceptionsResults::Error::None;
         }
 
 
         private:
+        //######################################################################
+        // Functions
+        //######################################################################
+
+
+        /**
+         * Combines each entry of the vector with the given entries, entry by
+         * entry, without validating the dimensions.
+         * 
+         * @param entries The entries to be combined; there must be as many as
+         * the dimension of the vector.
+         * 
+         * @param operation The operation that returns the new value of an
+         * entry from the entry and the given entry.
+        */
+        template <typename F>
+        void combineKernel(const T* entries, F operation) noexcept
+        {
+            for(size_t i = 0; i < dimension; ++i)
+                container[i] = operation(container[i], entries[i]);
+
+            normValid = false;
+        }
+
+
+        /**
+         * Calculates the cross product between the vector itself and the
+         * given entries, without validating the dimensions.
+         * 
+         * @param b The entries of the second argument of the cross product.
+         * 
+         * @param c The entries where the result will be stored; they can be
+         * the entries of any of the arguments.
+        */
+        void crossProductKernel(const T* b, T* c) noexcept
+        {
+            // Auxiliary variables.
+            const T* a = container.data();
+            T x = a[1] * b[2] - a[2] * b[1];
+            T y = a[2] * b[0] - a[0] * b[2];
+            T z = a[0] * b[1] - a[1] * b[0];
+
+            // Set the components, after reading all the inputs.
+            c[0] = x; c[1] = y; c[2] = z;
+        }
+
+
+        /**
+         * Divides each entry of the vector by the given value, without
+         * validating the division.
+         * 
+         * @param value The value by which each entry will be divided.
+        */
+        void divideKernel(A value) noexcept
+        {
+            for(size_t i = 0; i < dimension; ++i)
+                container[i] = (T) ((A) container[i] / value);
+
+            normValid = false;
+        }
+
+
+        /**
+         * Returns the dot product of the vector itself with the given
+         * entries, without validating the dimensions, throwing if the
+         * integer accumulation overflows.
+         * 
+         * @param entries The entries with which the dot product will be taken;
+         * there must be as many as the dimension of the vector.
+         * 
+         * @param requested The precision of the accumulation.
+         * 
+         * @return The dot product, accumulated with the accumulation type.
+         * 
+         * @throw ExceptionsNumerical::Overflow, if the integer accumulation
+         * overflows.
+        */
+        A dotProductChecked(const T* entries, Precision requested) const
+        {
+            // Auxiliary variables.
+            bool overflow{false};
+            A value = dotProductKernel(entries, requested, overflow);
+
+            if(overflow) throw ExceptionsNumerical::Overflow();
+
+            return value;
+        }
+
+
+        /**
+         * Returns the dot product of the vector itself with the given
+         * entries, without validating the dimensions. The integer products
+         * and sums are exact, and their overflow is reported instead of
+         * wrapping around; the fixed point products are summed exactly and
+         * rounded, and saturated, once.
+         * 
+         * @param entries The entries with which the dot product will be taken;
+         * there must be as many as the dimension of the vector.
+         * 
+         * @param requested The precision of the accumulation.
+         * 
+         * @param overflow Set to true if the integer accumulation overflows,
+         * in which case the returned value is meaningless; left untouched
+         * otherwise.
+         * 
+         * @return The dot product, accumulated with the accumulation type.
+        */
+        A dotProductKernel(
+            const T* entries, Precision requested, bool& overflow
+        ) const noexcept
+        {
+            // Auxiliary variables.
+            A accum = (A) 0;
+
+            // Only the floating point sums have rounding errors.
+            if constexpr(std::is_floating_point<A>::value)
+            {
+                if(requested == Precision::Compensated)
+                    return MathCompensated::dot2<T, A>(
+                        container.data(), entries, dimension
+                    );
+
+                for(size_t i = 0; i < dimension; ++i)
+                    accum += (A) container[i] * (A) entries[i];
+            }
+            else if constexpr(
+                std::is_integral<A>::value && 2 * sizeof(T) <= sizeof(A)
+            )
+            {
+                // Auxiliary variables.
+                typedef TypesInteger::Wider<A> W;
+                constexpr int half = 4 * sizeof(A);
+                constexpr A mask = ((A) 1 << half) - 1;
+                W total = 0;
+
+                // The products of entries of half the width always fit; their
+                // high and low halves are added separately, which can not
+                // overflow within a chunk, such that the loop is vectorized,
+                // and the chunks are added exactly in the wider type.
+                for(size_t i = 0; i < dimension; i += integerChunk)
+                {
+                    size_t last = std::min(dimension, i + integerChunk);
+                    A high = 0, low = 0;
+
+                    for(size_t j = i; j < last; ++j)
+                    {
+                        A product = (A) container[j] * (A) entries[j];
+                        high += product >> half;
+                        low += product & mask;
+                    }
+
+                    total += (W) high * ((W) 1 << half) + (W) low;
+                }
+
+                accum = (A) total;
+                if(total != (W) accum) overflow = true;
+            }
+            else if constexpr(std::is_integral<A>::value)
+            {
+                // The products and sums of entries as wide as the accumulation
+                // type are checked one by one.
+                bool overflows{false};
+
+                for(size_t i = 0; i < dimension; ++i)
+                {
+                    A product;
+
+                    overflows |= TypesInteger::overflowMultiply(
+                        (A) container[i], (A) entries[i], product
+                    );
+                    overflows |= TypesInteger::overflowAdd(
+                        accum, product, accum
+                    );
+                }
+
+                if(overflows) overflow = true;
+            }
+            else
+            {
+                static_assert(
+                    sizeof(T) <= sizeof(int32_t),
+                    "The exact fixed point dot product needs 32 bit storage."
+                );
+
+                // The products have twice the fraction bits, such that their
+                // sum is exact in the wider type.
+                TypesInteger::Wider<decltype(accum.raw())> sum = 0;
+
+                for(size_t i = 0; i < dimension; ++i)
+                    sum += (decltype(sum)) ((A) container[i]).raw() *
+                        ((A) entries[i]).raw();
+
+                accum = A::fromProduct(sum);
+            }
+
+            return accum;
+        }
+
+
         //######################################################################
         // Variables
         //######################################################################
 
 
-        // Vector that contains the variables.
-        std::vector<T> container{0};
+        // Number of entries compared between early exit checks.
+        static constexpr size_t compareBlock{32};
+
+
+        // Number of integer products whose halves are added without
+        // overflowing the accumulation type.
+        static constexpr size_t integerChunk{(size_t) 1 << 30};
+
+
+        // Vector that contains the variables; its entries are only set to
+        // zero when requested.
+        std::vector<T, MemoryAllocators::DefaultInit<T>> container;
 
 
         // Size of the vector to be constructed.
         size_t dimension{0};
+
+
+        // True, if the squared norm must be cached.
+        bool normCached{false};
+
+
+        // True, if the cached squared norm matches the entries; updated by the
+        // constant reductions.
+        mutable bool normValid{false};
+
+
+        // The cached squared norm.
+        mutable A normValue{0};
+
+
+        // The precision of the reductions when none is requested.
+        Precision precision{Precision::Standard};
     };
 }
+
+
+//##############################################################################
+// Specializations
+//##############################################################################
+
+
+/**
+ * Hash of the vectors, such that they can be used as keys of the unordered
+ * containers.
+*/
+namespace std
+{
+template <typename T, typename A>
+struct hash<NVector::NVector<T, A>>
+{
+    /**
+     * Returns the hash of the given vector.
+     * 
+     * @param vector The vector to be hashed.
+     * 
+     * @return The hash of the entries of the vector.
+    */
+    size_t operator () (const NVector::NVector<T, A>& vector) const
+    {
+        return vector.hash();
+    }
+};
+}
+
+
+//##############################################################################
+// Explicit Instantiations
+//##############################################################################
+
+
+// The common types can be instantiated once, in the library built by
+// build.sh, such that each translation unit does not compile them again, if
+// NVECTORS_USE_LIBRARY is defined, as the build scripts do. The library must
+// be linked in any case, since it defines the non-template functions of the
+// headers.
+//
+// The member templates, which are checked on use, are not instantiated with
+// the classes; the ones of the norms are declared with their default
+// arguments, as extern template here and as template in the library.
+#define NVECTORS_NORM_MEMBERS(declaration, T) \
+    declaration T NVector::NVector<T>::norm<T>() const; \
+    declaration T NVector::NVector<T>::norm<T>(::NVector::Precision) const; \
+    declaration NVector::NVector<T> NVector::NVector<T>::normalize<T>(); \
+    declaration NVector::NVector<T> NVector::NVector<T>::normalizeIP<T>(); \
+    declaration NVector::NVector<T> NVector::NVector<T>::projection<T>( \
+        ::NVector::NVector<T>, bool \
+    ); \
+    declaration ExceptionsResults::Error \
+        NVector::NVector<T>::tryNormalizeIP<T>() noexcept;
+
+#ifdef NVECTORS_USE_LIBRARY
+extern template class NVector::NVector<float>;
+extern template class NVector::NVector<double>;
+extern template class NVector::NVector<long double>;
+NVECTORS_NORM_MEMBERS(extern template, float)
+NVECTORS_NORM_MEMBERS(extern template, double)
+NVECTORS_NORM_MEMBERS(extern template, long double)
+#endif
@@ -0,0 +1,610 @@
+/*
+    File that contains the scalar quantized companion container of the vector
+    of NVectors and its functions.
+*/
+#pragma once
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+
+// User defined.
+#include "./Headers/Parallel/parallelGeneral.hpp"
+#include "./Headers/Validation/validationGeneral.hpp"
+#include "./Headers/Validation/validationNumerical.hpp"
+#include "./nvectors.hpp"
+#include "./vnvectors.hpp"
+
+
+//##############################################################################
+// Namespaces
+//##############################################################################
+
+
+namespace QVNVectors
+{
+    //##########################################################################
+    // Enumerations
+    //##########################################################################
+
+
+    /**
+     * The metric with which the quantized NVectors are compared to a query.
+    */
+    enum class Metric
+    {
+        // The dot product; the greater, the closer.
+        DotProduct,
+
+        // The squared Euclidean distance; the smaller, the closer.
+        L2
+    };
+
+
+    /**
+     * The granularity of the quantization parameters.
+    */
+    enum class Mode
+    {
+        // A scale and an offset per NVector.
+        PerVector,
+
+        // A scale and an offset per dimension, shared by all the NVectors.
+        PerDimension
+    };
+
+
+    //##########################################################################
+    // Classes
+    //##########################################################################
+
+
+    /**
+     * Class that stores the NVectors of a vector of NVectors as 8 bit signed
+     * integers, x = scale * q + offset with q in [-127, 127], such that the
+     * memory and bandwidth are a quarter of the single precision ones. The
+     * queries are quantized as well, such that the approximate dot products
+     * and distances are computed with integer arithmetic.
+    */
+    template <typename T>
+    class QVNVectors
+    {
+        public:
+        //######################################################################
+        // Constructor(s) and Destructor(s)
+        //######################################################################
+
+
+        /**
+         * Constructs the quantized version of the given vector of NVectors;
+         * it can be empty, in which case the searches find nothing.
+         * 
+         * @param vectors The vector of NVectors to be quantized.
+         * 
+         * @param qmode The granularity of the quantization parameters.
+        */
+        QVNVectors(VNVectors::VNVectors<T>& vectors, Mode qmode) :
+        dimension{vectors.dimensions()},
+        vsize{vectors.size()},
+        mode{qmode}
+        {
+            // Validate the quantities.
+            ValidationNumerical::isFloating<T>((T) 1, true);
+
+            // Auxiliary variables.
+            size_t parameters = mode == Mode::PerVector ? vsize : dimension;
+
+            // Create with the exact number of entries.
+            codes = std::vector<int8_t>(vsize * dimension, 0);
+            scales = std::vector<T>(parameters, (T) 1);
+            offsets = std::vector<T>(parameters, (T) 0);
+            norms = std::vector<T>(vsize, (T) 0);
+
+            // Get the quantization parameters.
+            if(mode == Mode::PerVector) parametersVector(vectors);
+            else parametersDimension(vectors);
+
+            // Quantize the NVectors.
+            for(size_t i = 0; i < vsize; ++i)
+            {
+                const T* entries = vectors[i].data();
+                int8_t* code = codes.data() + i * dimension;
+
+                for(size_t j = 0; j < dimension; ++j)
+                {
+                    // Index of the quantization parameters.
+                    size_t k = mode == Mode::PerVector ? i : j;
+                    T value = std::round((entries[j] - offsets[k]) / scales[k]);
+
+                    code[j] = (int8_t) std::clamp(value, (T) -127, (T) 127);
+
+                    // Keep the norm of the dequantized NVector.
+                    value = scales[k] * code[j] + offsets[k];
+                    norms[i] += value * value;
+                }
+            }
+        }
+
+
+        /**
+         * Destructs the given object pointer.
+        */
+        ~QVNVectors(){}
+
+
+        //######################################################################
+        // Functions
+        //######################################################################
+
+
+        ////////////////////////////////////////////////////////////////////////
+        // Non-Template Functions
+        ////////////////////////////////////////////////////////////////////////
+
+
+        /**
+         * Returns the number of entries of the quantized NVectors.
+         * 
+         * @return The number of entries of the quantized NVectors.
+        */
+        size_t dimensions() const
+        {
+            return dimension;
+        }
+
+
+        /**
+         * Returns the number of quantized NVectors.
+         * 
+         * @return The number of quantized NVectors.
+        */
+        size_t size() const
+        {
+            return vsize;
+        }
+
+
+        ////////////////////////////////////////////////////////////////////////
+        // Template Functions
+        ////////////////////////////////////////////////////////////////////////
+
+
+        /**
+         * Returns the approximate value of the requested NVector.
+         * 
+         * @param index The index of the requested NVector.
+         * 
+         * @return The dequantized NVector.
+        */
+        NVector::NVector<T> dequantize(size_t index) const
+        {
+            // Validate the index is in range; the size can be zero.
+            ValidationNumerical::rangeGreater<size_t>(index, vsize, true);
+
+            // Auxiliary variables.
+            NVector::NVector<T> vector = NVector::NVector<T>(dimension);
+            const int8_t* code = codes.data() + index * dimension;
+            T* entries = vector.data();
+
+            for(size_t j = 0; j < dimension; ++j)
+            {
+                size_t k = mode == Mode::PerVector ? index : j;
+                entries[j] = scales[k] * code[j] + offsets[k];
+            }
+
+            return vector;
+        }
+
+
+        /**
+         * Returns the approximate scores of all the quantized NVectors with
+         * respect to the given query.
+         * 
+         * @param query The NVector with which the quantized NVectors will be
+         * compared.
+         * 
+         * @param metric The metric with which the score is calculated.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+         * 
+         * @return The approximate score of each of the quantized NVectors.
+        */
+        std::vector<T> scores(
+            NVector::NVector<T>& query, Metric metric, bool parallel
+        )
+        {
+            // Validate the dimensions.
+            ValidationGeneral::validateDimensions(
+                dimension, query.size(), true
+            );
+
+            // Auxiliary variables.
+            std::vector<T> output(vsize);
+            std::vector<int8_t> qcode(dimension);
+            T qscale, qconstant;
+            T qnorm = query.normSquared();
+
+            // Quantize the query.
+            quantizeQuery(query, qcode, qscale, qconstant);
+
+            // Calculate the scores of the given range.
+            auto function = [&](size_t first, size_t last)
+            {
+                for(size_t i = first; i < last; ++i)
+                {
+                    // The integer dot product.
+                    int64_t accum = dotProduct(
+                        codes.data() + i * dimension, qcode.data()
+                    );
+
+                    // The approximate floating point dot product.
+                    T dot = mode == Mode::PerVector ?
+                        scales[i] * qscale * accum + offsets[i] * qconstant :
+                        qscale * accum + qconstant;
+
+                    output[i] = metric == Metric::DotProduct ?
+                        dot : std::max((T) 0, norms[i] - 2 * dot + qnorm);
+                }
+            };
+
+            // Split the NVectors among the threads, if requested.
+            if(parallel)
+                ParallelGeneral::parallelFor(0, vsize, parallelGrain, function);
+            else
+                function(0, vsize);
+
+            return output;
+        }
+
+
+        /**
+         * Searches the quantized NVectors closest to the given query. The
+         * candidates are selected with the approximate scores and, if the
+         * original vector of NVectors is given, the best candidates are
+         * scored again with the original NVectors.
+         * 
+         * @param query The NVector with which the quantized NVectors will be
+         * compared.
+         * 
+         * @param k The number of NVectors to be returned.
+         * 
+         * @param metric The metric with which the score is calculated.
+         * 
+         * @param original The vector of NVectors from which the quantized
+         * NVectors were created, used to score the best candidates again;
+         * nullptr, if the approximate scores must be returned.
+         * 
+         * @param candidates The number of candidates to be scored again; it is
+         * never less than k.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+         * 
+         * @return The indexes of the closest NVectors and their scores,
+         * ordered from the closest to the farthest.
+        */
+        std::vector<std::pair<size_t, T>> search(
+            NVector::NVector<T>& query, size_t k, Metric metric,
+            VNVectors::VNVectors<T>* original, size_t candidates,
+            bool parallel
+        )
+        {
+            // Auxiliary variables.
+            std::vector<T> approximate = scores(query, metric, parallel);
+            std::vector<std::pair<size_t, T>> found;
+
+            // Validate the original NVectors, if given.
+            if(original)
+                ValidationGeneral::validateDimensions(
+                    vsize, original->size(), true
+                );
+
+            // Number of candidates to be kept.
+            k = std::min(k, vsize);
+            candidates = std::min(std::max(k, candidates), vsize);
+            if(!original) candidates = k;
+
+            // Select the best candidates.
+            found.reserve(vsize);
+            for(size_t i = 0; i < vsize; ++i)
+                found.emplace_back(i, approximate[i]);
+
+            selectBest(found, candidates, metric);
+
+            // Score the candidates again with the original NVectors.
+            if(original)
+            {
+                for(std::pair<size_t, T>& candidate : found)
+                    candidate.second = exactScore(
+                        (*original)[candidate.first], query, metric
+                    );
+
+                selectBest(found, k, metric);
+            }
+
+            return found;
+        }
+
+
+        private:
+        //######################################################################
+        // Functions
+        //######################################################################
+
+
+        /**
+         * Returns the integer dot product of two quantized NVectors; the
+         * products are accumulated in 32 bits over chunks that cannot
+         * overflow, such that the loops can be vectorized.
+         * 
+         * @param a The codes of the first quantized NVector.
+         * 
+         * @param b The codes of the second quantized NVector.
+         * 
+         * @return The integer dot product.
+        */
+        int64_t dotProduct(const int8_t* a, const int8_t* b) const
+        {
+            // Auxiliary variables.
+            int64_t accum{0};
+
+            for(size_t i = 0; i < dimension; i += integerChunk)
+            {
+                // Number of entries in the current chunk.
+                size_t length = std::min(integerChunk, dimension - i);
+                int32_t partial{0};
+
+                for(size_t j = 0; j < length; ++j)
+                    partial += (int32_t) a[i + j] * (int32_t) b[i + j];
+
+                accum += partial;
+            }
+
+            return accum;
+        }
+
+
+        /**
+         * Returns the exact score of an original NVector with respect to the
+         * given query.
+         * 
+         * @param vector The original NVector.
+         * 
+         * @param query The NVector with which the original one is compared.
+         * 
+         * @param metric The metric with which the score is calculated.
+         * 
+         * @return The exact score.
+        */
+        T exactScore(
+            NVector::NVector<T>& vector, NVector::NVector<T>& query,
+            Metric metric
+        )
+        {
+            // Validate the dimensions.
+            ValidationGeneral::validateDimensions(
+                dimension, vector.size(), true
+            );
+
+            // The dot product is already available.
+            if(metric == Metric::DotProduct) return vector.dotProduct(query);
+
+            // Auxiliary variables.
+            const T* a = vector.data();
+            const T* b = query.data();
+            T accum = (T) 0;
+
+            for(size_t j = 0; j < dimension; ++j)
+                accum += (a[j] - b[j]) * (a[j] - b[j]);
+
+            return accum;
+        }
+
+
+        /**
+         * Gets the scale and offset of each dimension, such that the range of
+         * values of the dimension is mapped to [-127, 127].
+         * 
+         * @param vectors The vector of NVectors to be quantized.
+        */
+        void parametersDimension(VNVectors::VNVectors<T>& vectors)
+        {
+            // Without NVectors, the parameters keep their unit values.
+            if(vsize == 0) return;
+
+            // Auxiliary variables.
+            const T* first = vectors[0].data();
+            std::vector<T> lower(first, first + dimension);
+            std::vector<T> upper(lower);
+
+            // Get the range of each dimension.
+            for(size_t i = 1; i < vsize; ++i)
+            {
+                const T* entries = vectors[i].data();
+
+                for(size_t j = 0; j < dimension; ++j)
+                {
+                    lower[j] = std::min(lower[j], entries[j]);
+                    upper[j] = std::max(upper[j], entries[j]);
+                }
+            }
+
+            // Get the parameters.
+            for(size_t j = 0; j < dimension; ++j)
+                setParameters(j, lower[j], upper[j]);
+        }
+
+
+        /**
+         * Gets the scale and offset of each NVector, such that the range of
+         * values of the NVector is mapped to [-127, 127].
+         * 
+         * @param vectors The vector of NVectors to be quantized.
+        */
+        void parametersVector(VNVectors::VNVectors<T>& vectors)
+        {
+            for(size_t i = 0; i < vsize; ++i)
+            {
+                // Auxiliary variables.
+                const T* entries = vectors[i].data();
+                auto range = std::minmax_element(entries, entries + dimension);
+
+                setParameters(i, *range.first, *range.second);
+            }
+        }
+
+
+        /**
+         * Quantizes the given query, symmetrically, such that the integer dot
+         * product with the codes approximates the dot product with the
+         * quantized NVectors.
+         * 
+         * @param query The query to be quantized.
+         * 
+         * @param qcode The codes of the quantized query.
+         * 
+         * @param qscale The scale of the quantized query.
+         * 
+         * @param qconstant The term of the dot product that multiplies the
+         * offsets; the sum of the entries of the query, if there is a scale
+         * per NVector, or the dot product of the query with the offsets, if
+         * there is a scale per dimension.
+        */
+        void quantizeQuery(
+            NVector::NVector<T>& query, std::vector<int8_t>& qcode, T& qscale,
+            T& qconstant
+        )
+        {
+            // Auxiliary variables.
+            std::vector<T> scaled(query.data(), query.data() + dimension);
+            T largest = (T) 0;
+
+            qconstant = (T) 0;
+
+            // With a scale per dimension, the scales are moved to the query.
+            for(size_t j = 0; j < dimension; ++j)
+            {
+                if(mode == Mode::PerVector)
+                {
+                    qconstant += scaled[j];
+                }
+                else
+                {
+                    qconstant += offsets[j] * scaled[j];
+                    scaled[j] *= scales[j];
+                }
+
+                largest = std::max(largest, std::fabs(scaled[j]));
+            }
+
+            // Quantize the, possibly scaled, query.
+            qscale = largest > (T) 0 ? largest / (T) 127 : (T) 1;
+            for(size_t j = 0; j < dimension; ++j)
+                qcode[j] = (int8_t) std::round(scaled[j] / qscale);
+        }
+
+
+        /**
+         * Keeps the given number of candidates with the best scores, ordered
+         * from the best to the worst.
+         * 
+         * @param found The candidates and their scores.
+         * 
+         * @param count The number of candidates to be kept.
+         * 
+         * @param metric The metric with which the scores were calculated.
+        */
+        void selectBest(
+            std::vector<std::pair<size_t, T>>& found, size_t count,
+            Metric metric
+        )
+        {
+            // Auxiliary variables.
+            auto better = [metric](
+                const std::pair<size_t, T>& a, const std::pair<size_t, T>& b
+            )
+            {
+                if(a.second != b.second)
+                    return metric == Metric::DotProduct ?
+                        a.second > b.second : a.second < b.second;
+
+                return a.first < b.first;
+            };
+
+            count = std::min(count, found.size());
+            std::partial_sort(
+                found.begin(), found.begin() + count, found.end(), better
+            );
+            found.resize(count);
+        }
+
+
+        /**
+         * Sets the scale and offset with the given index, such that the given
+         * range is mapped to [-127, 127].
+         * 
+         * @param index The index of the parameters.
+         * 
+         * @param lower The lower bound of the range.
+         * 
+         * @param upper The upper bound of the range.
+        */
+        void setParameters(size_t index, T lower, T upper)
+        {
+            offsets[index] = (upper + lower) / (T) 2;
+            scales[index] = upper > lower ? (upper - lower) / (T) 254 : (T) 1;
+        }
+
+
+        //######################################################################
+        // Variables
+        //######################################################################
+
+
+        // Maximum number of integer products accumulated in 32 bits.
+        static constexpr size_t integerChunk{65536};
+
+
+        // Minimum number of NVectors that each thread must process.
+        static constexpr size_t parallelGrain{4096};
+
+
+        // Codes of the quantized NVectors, one after the other.
+        std::vector<int8_t> codes;
+
+
+        // Squared norm of each of the dequantized NVectors.
+        std::vector<T> norms;
+
+
+        // Offsets of the quantization.
+        std::vector<T> offsets;
+
+
+        // Scales of the quantization.
+        std::vector<T> scales;
+
+
+        // Size of the quantized NVectors.
+        size_t dimension{0};
+
+
+        // Number of quantized NVectors.
+        size_t vsize{0};
+
+
+        // Granularity of the quantization parameters.
+        Mode mode{Mode::PerVector};
+    };
+}
@@ -1,7 +1,14 @@
 
-# Compile the program.
-g++ -std=c++17 -o main.exe main.cpp `
-    ./Implementations/Validation/validationGeneral.cpp
+# Build the library.
+./build.ps1
+if ($LASTEXITCODE -ne 0) { exit 1 }
+
+# Compile the program, optimized, against the library, which defines the
+# non-template functions of the headers.
+$cxx = if ($env:CXX) { $env:CXX } else { "g++" }
+$flags = if ($env:CXXFLAGS) { $env:CXXFLAGS -split " " } else { @() }
+& $cxx -std=c++17 -O2 -flto -pthread @flags -DNVECTORS_USE_LIBRARY `
+    -o main.exe main.cpp ./Build/libnvectors.a
 
 # Execute the program.
 ./main.exe
@@ -1,8 +1,13 @@
 #!/bin/bash
 
-# Compile and link.
-c++ -std=c++17 -o main main.cpp \
-    ./Implementations/Validation/validationGeneral.cpp
+# Build the library.
+./build.sh || exit 1
+
+# Compile and link, optimized, against the library, which defines the
+# non-template functions of the headers and whose instantiations are then not
+# compiled again.
+"${CXX:-c++}" -std=c++17 -O2 -flto -pthread $CXXFLAGS -DNVECTORS_USE_LIBRARY \
+    -o main main.cpp ./Build/libnvectors.a
 
 # Run the progam.
 ./main
@@ -0,0 +1,481 @@
+/*
+    File that contains the random fills of the NVectors and the vectors of
+    NVectors; the value of each entry only depends on the seed and on the
+    index of the entry, such that the results are the same for any number of
+    threads.
+*/
+#pragma once
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+
+// User defined.
+#include "./Headers/Math/mathApproximations.hpp"
+#include "./Headers/Parallel/parallelGeneral.hpp"
+#include "./Headers/Random/randomGeneral.hpp"
+#include "./Headers/Validation/validationNumerical.hpp"
+#include "./nvectors.hpp"
+#include "./ufuncs.hpp"
+#include "./vnvectors.hpp"
+
+
+//##############################################################################
+// Namespaces
+//##############################################################################
+
+
+namespace Sampling
+{
+    //##########################################################################
+    // Variables
+    //##########################################################################
+
+
+    // Minimum number of entries that each thread must fill.
+    constexpr size_t parallelEntries{1 << 16};
+
+
+    //##########################################################################
+    // Functions
+    //##########################################################################
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Auxiliary Functions
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    /**
+     * Returns the number of values of the given type built from each block
+     * of four random words: four with 24 bits, for single precision, or two
+     * with 53 bits, otherwise.
+     * 
+     * @return The number of values of each block.
+    */
+    template <typename T>
+    constexpr size_t valuesPerBlock() noexcept
+    {
+        return sizeof(T) <= sizeof(uint32_t) ? 4 : 2;
+    }
+
+
+    /**
+     * Computes the values of the block with the given index, either uniform
+     * in [0, 1) or standard normal; the normal ones come in pairs from the
+     * Box-Muller transform of consecutive uniform values, such that there
+     * are no rejections nor branches.
+     * 
+     * @param generator The counter based generator.
+     * 
+     * @param index The index of the block.
+     * 
+     * @param normal True, if the values must be standard normal; False, if
+     * uniform.
+     * 
+     * @param values Where the values of the block are stored.
+    */
+    template <typename T>
+    void blockValues(
+        const RandomGeneral::Philox& generator, uint64_t index, bool normal,
+        T (&values)[4]
+    ) noexcept
+    {
+        // Auxiliary variables.
+        constexpr size_t count = valuesPerBlock<T>();
+        constexpr T tau = (T) 6.28318530717958647692;
+        std::array<uint32_t, 4> words = generator.block(index);
+
+        if constexpr(count == 4)
+            for(size_t l = 0; l < 4; ++l)
+                values[l] = RandomGeneral::unit<T>(words[l]);
+        else
+        {
+            values[0] = RandomGeneral::unit<T>(words[0], words[1]);
+            values[1] = RandomGeneral::unit<T>(words[2], words[3]);
+        }
+
+        if(!normal) return;
+
+        for(size_t l = 0; l < count; l += 2)
+        {
+            // The radius uses 1 - u, in (0, 1], such that it is finite.
+            T radius = std::sqrt(
+                (T) -2 * MathApproximations::log((T) 1 - values[l])
+            );
+            T angle = tau * values[l + 1];
+
+            values[l] = radius * std::cos(angle);
+            values[l + 1] = radius * std::sin(angle);
+        }
+    }
+
+
+    /**
+     * Fills the entries [first, last) of the given rows, counted by rows,
+     * with shift + scale * value, where the values are uniform in [0, 1) or
+     * standard normal.
+     * 
+     * @param rows The pointers to the entries of each row.
+     * 
+     * @param dimension The number of entries of each row.
+     * 
+     * @param first The index of the first entry to be filled.
+     * 
+     * @param last The index of the entry after the last one to be filled.
+     * 
+     * @param generator The counter based generator.
+     * 
+     * @param normal True, if the values must be standard normal; False, if
+     * uniform.
+     * 
+     * @param scale The factor of the values.
+     * 
+     * @param shift The number added to the values.
+    */
+    template <typename T, typename A>
+    void fillKernel(
+        const std::vector<T*>& rows, size_t dimension, uint64_t first,
+        uint64_t last, const RandomGeneral::Philox& generator, bool normal,
+        A scale, A shift
+    ) noexcept
+    {
+        // Auxiliary variables.
+        constexpr size_t count = valuesPerBlock<A>();
+        size_t row = (size_t) (first / dimension);
+        size_t column = (size_t) (first % dimension);
+        A values[4];
+
+        for(uint64_t entry = first; entry < last;)
+        {
+            blockValues(generator, entry / count, normal, values);
+
+            for(size_t l = entry % count; l < count && entry < last; ++l)
+            {
+                rows[row][column] = (T) (shift + scale * values[l]);
+                ++entry;
+
+                if(++column == dimension)
+                {
+                    column = 0;
+                    ++row;
+                }
+            }
+        }
+    }
+
+
+    /**
+     * Fills all the entries of the given rows, splitting them among several
+     * threads if requested.
+     * 
+     * @param rows The pointers to the entries of each row.
+     * 
+     * @param dimension The number of entries of each row.
+     * 
+     * @param seed The seed of the random values.
+     * 
+     * @param normal True, if the values must be normal; False, if uniform.
+     * 
+     * @param scale The factor of the values.
+     * 
+     * @param shift The number added to the values.
+     * 
+     * @param parallel True, if the entries must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T, typename A>
+    void fill(
+        const std::vector<T*>& rows, size_t dimension, uint64_t seed,
+        bool normal, A scale, A shift, bool parallel
+    )
+    {
+        // The integer entries have their own uniform fill, and no other.
+        static_assert(
+            std::is_floating_point<T>::value &&
+            std::is_floating_point<A>::value,
+            "Only floating point entries can be filled with unit or normal "
+            "values."
+        );
+
+        // Auxiliary variables.
+        RandomGeneral::Philox generator(seed);
+        size_t entries = rows.size() * dimension;
+
+        auto kernel = [&](size_t first, size_t last)
+        {
+            fillKernel<T, A>(
+                rows, dimension, first, last, generator, normal, scale, shift
+            );
+        };
+
+        if(parallel)
+            ParallelGeneral::parallelFor(0, entries, parallelEntries, kernel);
+        else
+            kernel(0, entries);
+    }
+
+
+    /**
+     * Fills all the entries of the given rows with the unbiased integers in
+     * [lower, upper), splitting them among several threads if requested.
+     * 
+     * @param rows The pointers to the entries of each row.
+     * 
+     * @param dimension The number of entries of each row.
+     * 
+     * @param seed The seed of the random values.
+     * 
+     * @param lower The lower end of the range.
+     * 
+     * @param upper The upper end of the range.
+     * 
+     * @param parallel True, if the entries must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void fillIntegers(
+        const std::vector<T*>& rows, size_t dimension, uint64_t seed, T lower,
+        T upper, bool parallel
+    )
+    {
+        // Validate the range is not empty.
+        ValidationNumerical::rangeGreater(lower, upper, true);
+
+        // Auxiliary variables.
+        RandomGeneral::Philox generator(seed);
+        size_t entries = rows.size() * dimension;
+
+        auto kernel = [&](size_t first, size_t last)
+        {
+            for(size_t entry = first; entry < last; ++entry)
+                rows[entry / dimension][entry % dimension] =
+                    RandomGeneral::bounded(generator, entry, lower, upper);
+        };
+
+        if(parallel)
+            ParallelGeneral::parallelFor(0, entries, parallelEntries, kernel);
+        else
+            kernel(0, entries);
+    }
+
+
+    /**
+     * Divides the given entries by their L2 norm.
+     * 
+     * @param entries The entries to be normalized.
+     * 
+     * @param dimension The number of entries.
+    */
+    template <typename T, typename A>
+    void normalizeKernel(T* entries, size_t dimension) noexcept
+    {
+        // Auxiliary variables.
+        A accum = (A) 0;
+
+        for(size_t j = 0; j < dimension; ++j)
+            accum += (A) entries[j] * (A) entries[j];
+
+        A scale = (A) 1 / std::sqrt(accum);
+        for(size_t j = 0; j < dimension; ++j)
+            entries[j] = (T) ((A) entries[j] * scale);
+    }
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // NVector Functions
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    /**
+     * Fills the NVector with a direction uniformly distributed on the unit
+     * sphere, i.e., a normalized vector of independent normal entries.
+     * 
+     * @param vector The NVector to be filled.
+     * 
+     * @param seed The seed of the random values.
+     * 
+     * @param parallel True, if the entries must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T, typename A>
+    void direction(
+        NVector::NVector<T, A>& vector, uint64_t seed, bool parallel
+    )
+    {
+        // Auxiliary variables.
+        std::vector<T*> rows{vector.data()};
+
+        fill<T, A>(rows, vector.size(), seed, true, (A) 1, (A) 0, parallel);
+        normalizeKernel<T, A>(rows[0], vector.size());
+    }
+
+
+    /**
+     * Fills the NVector with independent normal values.
+     * 
+     * @param vector The NVector to be filled.
+     * 
+     * @param mean The mean of the values.
+     * 
+     * @param deviation The standard deviation of the values.
+     * 
+     * @param seed The seed of the random values.
+     * 
+     * @param parallel True, if the entries must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T, typename A>
+    void normal(
+        NVector::NVector<T, A>& vector, T mean, T deviation, uint64_t seed,
+        bool parallel
+    )
+    {
+        // Auxiliary variables.
+        std::vector<T*> rows{vector.data()};
+
+        fill<T, A>(
+            rows, vector.size(), seed, true, (A) deviation, (A) mean, parallel
+        );
+    }
+
+
+    /**
+     * Fills the NVector with independent values, uniform in [lower, upper);
+     * the integer entries are unbiased integers, and the range must not be
+     * empty.
+     * 
+     * @param vector The NVector to be filled.
+     * 
+     * @param lower The lower end of the range.
+     * 
+     * @param upper The upper end of the range.
+     * 
+     * @param seed The seed of the random values.
+     * 
+     * @param parallel True, if the entries must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T, typename A>
+    void uniform(
+        NVector::NVector<T, A>& vector, T lower, T upper, uint64_t seed,
+        bool parallel
+    )
+    {
+        // Auxiliary variables.
+        std::vector<T*> rows{vector.data()};
+
+        if constexpr(std::is_integral<T>::value)
+            fillIntegers<T>(rows, vector.size(), seed, lower, upper, parallel);
+        else
+            fill<T, A>(
+                rows, vector.size(), seed, false, (A) upper - (A) lower,
+                (A) lower, parallel
+            );
+    }
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Vector of NVectors Functions
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    /**
+     * Fills each of the NVectors of the vector of NVectors with a direction
+     * uniformly distributed on the unit sphere.
+     * 
+     * @param vector The vector of NVectors to be filled.
+     * 
+     * @param seed The seed of the random values.
+     * 
+     * @param parallel True, if the entries must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void directions(
+        VNVectors::VNVectors<T>& vector, uint64_t seed, bool parallel
+    )
+    {
+        // Auxiliary variables.
+        std::vector<T*> rows = UFuncs::rows(vector);
+        size_t dimension = vector.dimensions();
+
+        fill<T, T>(rows, dimension, seed, true, (T) 1, (T) 0, parallel);
+
+        UFuncs::forRows(vector, parallel, [&](size_t first, size_t last)
+        {
+            for(size_t i = first; i < last; ++i)
+                normalizeKernel<T, T>(rows[i], dimension);
+        });
+    }
+
+
+    /**
+     * Fills the vector of NVectors with independent normal values; the
+     * entries are counted by rows, such that the values are the same as
+     * those of an NVector with all the entries one after the other.
+     * 
+     * @param vector The vector of NVectors to be filled.
+     * 
+     * @param mean The mean of the values.
+     * 
+     * @param deviation The standard deviation of the values.
+     * 
+     * @param seed The seed of the random values.
+     * 
+     * @param parallel True, if the entries must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void normal(
+        VNVectors::VNVectors<T>& vector, T mean, T deviation, uint64_t seed,
+        bool parallel
+    )
+    {
+        fill<T, T>(
+            UFuncs::rows(vector), vector.dimensions(), seed, true, deviation,
+            mean, parallel
+        );
+    }
+
+
+    /**
+     * Fills the vector of NVectors with independent values, uniform in
+     * [lower, upper); the entries are counted by rows, such that the values
+     * are the same as those of an NVector with all the entries one after the
+     * other.
+     * 
+     * @param vector The vector of NVectors to be filled.
+     * 
+     * @param lower The lower end of the range.
+     * 
+     * @param upper The upper end of the range.
+     * 
+     * @param seed The seed of the random values.
+     * 
+     * @param parallel True, if the entries must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void uniform(
+        VNVectors::VNVectors<T>& vector, T lower, T upper, uint64_t seed,
+        bool parallel
+    )
+    {
+        fill<T, T>(
+            UFuncs::rows(vector), vector.dimensions(), seed, false,
+            upper - lower, lower, parallel
+        );
+    }
+}
@@ -0,0 +1,1033 @@
+/*
+    File that contains the compressed binary snapshots of the NVectors and the
+    vectors of NVectors; the entries are split in blocks that are encoded and
+    decoded by several threads, where each block can be XOR-ed with a previous
+    snapshot, is byte shuffled, has each byte plane run length encoded or
+    Huffman coded and has its own checksum. The sign and exponent bytes, and
+    the entries rounded to a few digits, compress well; the low bytes of full
+    precision entries are close to random and barely compress, for them the
+    delta snapshots are the ones that cut the size several times.
+*/
+#pragma once
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+
+// User defined.
+#include "./Headers/Compression/compressionGeneral.hpp"
+#include "./Headers/Exceptions/exceptionsNVectors.hpp"
+#include "./Headers/Hashing/hashingGeneral.hpp"
+#include "./Headers/Parallel/parallelGeneral.hpp"
+#include "./Headers/Types/typesFloating.hpp"
+#include "./Headers/Validation/validationGeneral.hpp"
+#include "./nvectors.hpp"
+#include "./ufuncs.hpp"
+#include "./vnvectors.hpp"
+
+
+//##############################################################################
+// Namespaces
+//##############################################################################
+
+
+namespace Snapshots
+{
+    //##########################################################################
+    // Variables
+    //##########################################################################
+
+
+    // Bytes that identify a snapshot, at its start.
+    constexpr uint8_t magic[4]{'N', 'V', 'S', 'S'};
+
+
+    // Version of the format of the snapshots; the snapshots of the previous
+    // versions can still be decoded.
+    constexpr uint16_t version{2};
+
+
+    // Number of bytes of the header, before the block table.
+    constexpr size_t headerSize{38};
+
+
+    // Number of bytes of each entry of the block table.
+    constexpr size_t tableEntrySize{9};
+
+
+    // Number of entries of each block; the last block can have less.
+    constexpr uint32_t blockEntries{1 << 16};
+
+
+    // Flag of the snapshots that are XOR-ed with a previous snapshot.
+    constexpr uint8_t flagDelta{1};
+
+
+    // Flag of the snapshots whose entries are stored little endian.
+    constexpr uint8_t flagLittleEndian{2};
+
+
+    //##########################################################################
+    // Enumerations
+    //##########################################################################
+
+
+    /**
+     * The kind of vector stored in a snapshot.
+    */
+    enum class Kind : uint8_t
+    {
+        // A single NVector, with count equal to one.
+        NVector,
+
+        // A vector of NVectors.
+        VNVectors
+    };
+
+
+    /**
+     * The way in which the bytes of a block are stored.
+    */
+    enum class Method : uint8_t
+    {
+        // The shuffled bytes, as they are; when they do not compress.
+        Stored,
+
+        // The run length encoding of the shuffled bytes; only written by
+        // the first version.
+        RunLength,
+
+        // Each byte plane of the shuffled bytes stored with its own
+        // CompressionGeneral::Coding.
+        Planes
+    };
+
+
+    //##########################################################################
+    // Types
+    //##########################################################################
+
+
+    /**
+     * Structure with the fields of the header of a snapshot, such that the
+     * snapshot describes itself.
+    */
+    struct Header
+    {
+        // The version of the format.
+        uint16_t version{0};
+
+        // The kind of vector.
+        Kind kind{Kind::NVector};
+
+        // The code of the type of the entries, see typeCode.
+        uint8_t type{0};
+
+        // The number of bytes of each entry.
+        uint8_t width{0};
+
+        // The flags of the snapshot, flagDelta and flagLittleEndian.
+        uint8_t flags{0};
+
+        // The number of entries of each NVector.
+        uint64_t dimension{0};
+
+        // The number of NVectors.
+        uint64_t count{0};
+
+        // The number of entries of each block.
+        uint32_t blockEntries{0};
+
+        // The number of blocks.
+        uint64_t blocks{0};
+    };
+
+
+    /**
+     * Structure with the entry of a block in the block table.
+    */
+    struct Block
+    {
+        // The number of bytes of the encoded block.
+        uint32_t size{0};
+
+        // The way in which the block is stored.
+        Method method{Method::Stored};
+
+        // The CRC-32 of the raw bytes of the entries of the block.
+        uint32_t crc{0};
+
+        // The position of the encoded block in the snapshot.
+        size_t offset{0};
+    };
+
+
+    //##########################################################################
+    // Functions
+    //##########################################################################
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Auxiliary Functions
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    /**
+     * Returns the code of the given type of entries: 1 for float, 2 for
+     * double, 3 for long double, 4 for half precision and 5 for brain
+     * floating point.
+     * 
+     * @return The code of the type; zero if the type is not known.
+    */
+    template <typename T>
+    constexpr uint8_t typeCode() noexcept
+    {
+// The half precision type is only defined if the compiler supports it.
+#ifdef __FLT16_MAX__
+        if constexpr(std::is_same<T, TypesFloating::Float16>::value)
+            return 4;
+#endif
+        if constexpr(std::is_same<T, float>::value) return 1;
+        else if constexpr(std::is_same<T, double>::value) return 2;
+        else if constexpr(std::is_same<T, long double>::value) return 3;
+        else if constexpr(std::is_same<T, TypesFloating::BFloat16>::value)
+            return 5;
+        else return 0;
+    }
+
+
+    /**
+     * Appends the given unsigned integer, least significant byte first, such
+     * that the headers do not depend on the byte order of the machine.
+     * 
+     * @param bytes Where the integer is appended.
+     * 
+     * @param value The integer to be appended.
+    */
+    template <typename U>
+    void put(std::vector<uint8_t>& bytes, U value)
+    {
+        for(size_t b = 0; b < sizeof(U); ++b)
+            bytes.push_back((uint8_t) ((uint64_t) value >> (8 * b)));
+    }
+
+
+    /**
+     * Reads an unsigned integer stored by put.
+     * 
+     * @param bytes The bytes of the snapshot.
+     * 
+     * @param offset The position of the integer; it is moved after it.
+     * 
+     * @return The integer.
+    */
+    template <typename U>
+    U get(const std::vector<uint8_t>& bytes, size_t& offset)
+    {
+        // Auxiliary variables.
+        uint64_t value{0};
+
+        // Validate the integer is complete.
+        if(bytes.size() < offset || bytes.size() - offset < sizeof(U))
+            throw ExceptionsNVector::Snapshot("the snapshot is truncated.");
+
+        for(size_t b = 0; b < sizeof(U); ++b)
+            value |= (uint64_t) bytes[offset + b] << (8 * b);
+
+        offset += sizeof(U);
+
+        return (U) value;
+    }
+
+
+    /**
+     * Determines if the machine stores the numbers least significant byte
+     * first.
+     * 
+     * @return True, if the machine is little endian; False, otherwise.
+    */
+    inline bool littleEndian() noexcept
+    {
+        // Auxiliary variables.
+        uint16_t probe{1};
+        uint8_t first{0};
+
+        std::memcpy(&first, &probe, 1);
+
+        return first == 1;
+    }
+
+
+    /**
+     * Copies the raw bytes of the entries [first, last) of the given rows,
+     * counted by rows, one entry after the other.
+     * 
+     * @param rows The pointers to the entries of each row.
+     * 
+     * @param dimension The number of entries of each row.
+     * 
+     * @param first The index of the first entry to be copied.
+     * 
+     * @param last The index of the entry after the last one to be copied.
+     * 
+     * @param bytes Where the bytes are stored.
+    */
+    template <typename T>
+    void gather(
+        const std::vector<T*>& rows, size_t dimension, size_t first,
+        size_t last, uint8_t* bytes
+    ) noexcept
+    {
+        // Auxiliary variables.
+        size_t row = first / dimension;
+        size_t column = first % dimension;
+
+        while(first < last)
+        {
+            size_t length = std::min(dimension - column, last - first);
+
+            std::memcpy(bytes, rows[row] + column, length * sizeof(T));
+            bytes += length * sizeof(T);
+            first += length;
+            column = 0;
+            ++row;
+        }
+    }
+
+
+    /**
+     * Copies the given raw bytes into the entries [first, last) of the given
+     * rows, counted by rows; the inverse of gather.
+     * 
+     * @param bytes The bytes of the entries, one entry after the other.
+     * 
+     * @param rows The pointers to the entries of each row.
+     * 
+     * @param dimension The number of entries of each row.
+     * 
+     * @param first The index of the first entry to be copied.
+     * 
+     * @param last The index of the entry after the last one to be copied.
+    */
+    template <typename T>
+    void scatter(
+        const uint8_t* bytes, const std::vector<T*>& rows, size_t dimension,
+        size_t first, size_t last
+    ) noexcept
+    {
+        // Auxiliary variables.
+        size_t row = first / dimension;
+        size_t column = first % dimension;
+
+        while(first < last)
+        {
+            size_t length = std::min(dimension - column, last - first);
+
+            std::memcpy(rows[row] + column, bytes, length * sizeof(T));
+            bytes += length * sizeof(T);
+            first += length;
+            column = 0;
+            ++row;
+        }
+    }
+
+
+    /**
+     * XORs the raw bytes of the entries [first, last) of the given previous
+     * rows into the given bytes; applying it twice restores the bytes.
+     * 
+     * @param previous The pointers to the entries of each previous row.
+     * 
+     * @param dimension The number of entries of each row.
+     * 
+     * @param first The index of the first entry.
+     * 
+     * @param last The index of the entry after the last one.
+     * 
+     * @param bytes The bytes to be XOR-ed.
+     * 
+     * @param work Space for the bytes of the previous entries.
+    */
+    template <typename T>
+    void delta(
+        const std::vector<T*>& previous, size_t dimension, size_t first,
+        size_t last, uint8_t* bytes, uint8_t* work
+    ) noexcept
+    {
+        // Auxiliary variables.
+        size_t size = (last - first) * sizeof(T);
+
+        gather(previous, dimension, first, last, work);
+
+        for(size_t i = 0; i < size; ++i)
+            bytes[i] ^= work[i];
+    }
+
+
+    /**
+     * Builds the snapshot of the given rows, encoding its blocks in several
+     * threads if requested; the result does not depend on the number of
+     * threads.
+     * 
+     * @param rows The pointers to the entries of each row.
+     * 
+     * @param previous The pointers to the entries of each row of the previous
+     * snapshot; nullptr, if the snapshot is not a delta.
+     * 
+     * @param kind The kind of vector of the rows.
+     * 
+     * @param dimension The number of entries of each row.
+     * 
+     * @param parallel True, if the blocks must be split among several
+     * threads; False, otherwise.
+     * 
+     * @return The bytes of the snapshot.
+    */
+    template <typename T>
+    std::vector<uint8_t> encodeRows(
+        const std::vector<T*>& rows, const std::vector<T*>* previous,
+        Kind kind, size_t dimension, bool parallel
+    )
+    {
+        // Auxiliary variables.
+        size_t entries = rows.size() * dimension;
+        size_t blocks = (entries + blockEntries - 1) / blockEntries;
+        std::vector<std::vector<uint8_t>> payloads(blocks);
+        std::vector<Block> table(blocks);
+        std::vector<uint8_t> bytes;
+
+        auto kernel = [&](size_t first, size_t last)
+        {
+            // Auxiliary variables, reused by all the blocks of the thread.
+            std::vector<uint8_t> raw(blockEntries * sizeof(T));
+            std::vector<uint8_t> work(blockEntries * sizeof(T));
+
+            for(size_t b = first; b < last; ++b)
+            {
+                size_t begin = b * blockEntries;
+                size_t end = std::min<size_t>(begin + blockEntries, entries);
+                size_t size = (end - begin) * sizeof(T);
+
+                // The checksum is of the entries, before any transformation.
+                gather(rows, dimension, begin, end, raw.data());
+                table[b].crc = HashingGeneral::crc32(raw.data(), size, 0);
+
+                if(previous != nullptr)
+                    delta(
+                        *previous, dimension, begin, end, raw.data(),
+                        work.data()
+                    );
+
+                CompressionGeneral::shuffle(
+                    raw.data(), end - begin, sizeof(T), work.data()
+                );
+                payloads[b].reserve(size + 5 * sizeof(T));
+                CompressionGeneral::planesEncode(
+                    work.data(), end - begin, sizeof(T), payloads[b]
+                );
+
+                // Store the shuffled bytes if the encoding does not help.
+                table[b].method = Method::Planes;
+                if(payloads[b].size() >= size)
+                {
+                    payloads[b].assign(work.data(), work.data() + size);
+                    table[b].method = Method::Stored;
+                }
+
+                table[b].size = (uint32_t) payloads[b].size();
+            }
+        };
+
+        if(parallel)
+            ParallelGeneral::parallelFor(0, blocks, 1, kernel);
+        else
+            kernel(0, blocks);
+
+        // Write the header.
+        bytes.insert(bytes.end(), magic, magic + 4);
+        put<uint16_t>(bytes, version);
+        put<uint8_t>(bytes, (uint8_t) kind);
+        put<uint8_t>(bytes, typeCode<T>());
+        put<uint8_t>(bytes, (uint8_t) sizeof(T));
+        put<uint8_t>(
+            bytes, (uint8_t) ((previous != nullptr ? flagDelta : 0) |
+            (littleEndian() ? flagLittleEndian : 0))
+        );
+        put<uint64_t>(bytes, dimension);
+        put<uint64_t>(bytes, rows.size());
+        put<uint32_t>(bytes, blockEntries);
+        put<uint64_t>(bytes, blocks);
+
+        // Write the block table, protected by the checksum of the header.
+        for(const Block& block : table)
+        {
+            put<uint32_t>(bytes, block.size);
+            put<uint8_t>(bytes, (uint8_t) block.method);
+            put<uint32_t>(bytes, block.crc);
+        }
+        put<uint32_t>(
+            bytes, HashingGeneral::crc32(bytes.data(), bytes.size(), 0)
+        );
+
+        // Write the blocks.
+        for(const std::vector<uint8_t>& payload : payloads)
+            bytes.insert(bytes.end(), payload.begin(), payload.end());
+
+        return bytes;
+    }
+
+
+    /**
+     * Reads and validates the block table of the given snapshot, whose header
+     * has already been read.
+     * 
+     * @param bytes The bytes of the snapshot.
+     * 
+     * @param header The header of the snapshot.
+     * 
+     * @param offset The position after the header.
+     * 
+     * @return The entries of the block table, with their positions.
+    */
+    inline std::vector<Block> readTable(
+        const std::vector<uint8_t>& bytes, const Header& header, size_t offset
+    )
+    {
+        // Auxiliary variables.
+        std::vector<Block> table;
+
+        // Validate the table fits, before allocating it.
+        if((bytes.size() - offset) / tableEntrySize < header.blocks)
+            throw ExceptionsNVector::Snapshot("the snapshot is truncated.");
+
+        table.resize((size_t) header.blocks);
+        for(Block& block : table)
+        {
+            block.size = get<uint32_t>(bytes, offset);
+            block.method = (Method) get<uint8_t>(bytes, offset);
+            block.crc = get<uint32_t>(bytes, offset);
+        }
+
+        // Validate the header and the table are not corrupted.
+        uint32_t crc = HashingGeneral::crc32(bytes.data(), offset, 0);
+        if(get<uint32_t>(bytes, offset) != crc)
+            throw ExceptionsNVector::Snapshot(
+                "the checksum of the header does not match."
+            );
+
+        // Find the position of each block.
+        for(Block& block : table)
+        {
+            if(bytes.size() - offset < block.size)
+                throw ExceptionsNVector::Snapshot("the snapshot is truncated.");
+
+            block.offset = offset;
+            offset += block.size;
+        }
+
+        if(offset != bytes.size())
+            throw ExceptionsNVector::Snapshot(
+                "there are bytes after the last block."
+            );
+
+        return table;
+    }
+
+
+    /**
+     * Decodes the blocks of the given snapshot into the given rows, in
+     * several threads if requested, checking the checksum of each block.
+     * 
+     * @param bytes The bytes of the snapshot.
+     * 
+     * @param header The header of the snapshot.
+     * 
+     * @param rows The pointers to the entries of each row.
+     * 
+     * @param previous The pointers to the entries of each row of the previous
+     * snapshot; nullptr, if the snapshot is not a delta.
+     * 
+     * @param parallel True, if the blocks must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void decodeRows(
+        const std::vector<uint8_t>& bytes, const Header& header,
+        const std::vector<T*>& rows, const std::vector<T*>* previous,
+        bool parallel
+    )
+    {
+        // Auxiliary variables.
+        size_t offset{headerSize};
+        std::vector<Block> table = readTable(bytes, header, offset);
+        size_t dimension = (size_t) header.dimension;
+        size_t entries = rows.size() * dimension;
+        size_t stride = header.blockEntries;
+
+        // Validate the delta can be undone.
+        if((header.flags & flagDelta) != 0 && previous == nullptr)
+            throw ExceptionsNVector::Snapshot(
+                "the snapshot is a delta, the previous vector is needed."
+            );
+
+        auto kernel = [&](size_t first, size_t last)
+        {
+            // Auxiliary variables, reused by all the blocks of the thread.
+            std::vector<uint8_t> raw(stride * sizeof(T));
+            std::vector<uint8_t> work(stride * sizeof(T));
+
+            for(size_t b = first; b < last; ++b)
+            {
+                size_t begin = b * stride;
+                size_t end = std::min(begin + stride, entries);
+                size_t size = (end - begin) * sizeof(T);
+                const uint8_t* payload = bytes.data() + table[b].offset;
+                bool valid{false};
+
+                if(table[b].method == Method::Stored)
+                {
+                    valid = table[b].size == size;
+                    if(valid) std::memcpy(work.data(), payload, size);
+                }
+                else if(table[b].method == Method::RunLength)
+                    valid = CompressionGeneral::runLengthDecode(
+                        payload, table[b].size, work.data(), size
+                    );
+                else if(table[b].method == Method::Planes)
+                    valid = CompressionGeneral::planesDecode(
+                        payload, table[b].size, end - begin, sizeof(T),
+                        work.data()
+                    );
+
+                if(!valid)
+                    throw ExceptionsNVector::Snapshot(
+                        "block %zu is malformed.", b
+                    );
+
+                CompressionGeneral::unshuffle(
+                    work.data(), end - begin, sizeof(T), raw.data()
+                );
+
+                if((header.flags & flagDelta) != 0)
+                    delta(
+                        *previous, dimension, begin, end, raw.data(),
+                        work.data()
+                    );
+
+                if(HashingGeneral::crc32(raw.data(), size, 0) != table[b].crc)
+                    throw ExceptionsNVector::Checksum(b);
+
+                scatter(raw.data(), rows, dimension, begin, end);
+            }
+        };
+
+        if(parallel)
+            ParallelGeneral::parallelFor(0, table.size(), 1, kernel);
+        else
+            kernel(0, table.size());
+    }
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Header Functions
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    /**
+     * Reads and validates the header of the given snapshot, such that its
+     * contents can be known before decoding it.
+     * 
+     * @param bytes The bytes of the snapshot.
+     * 
+     * @return The header of the snapshot.
+    */
+    inline Header header(const std::vector<uint8_t>& bytes)
+    {
+        // Auxiliary variables.
+        Header result;
+        size_t offset{0};
+        uint64_t entries{0};
+
+        // Validate it is a snapshot of a known version.
+        for(size_t b = 0; b < 4; ++b)
+            if(get<uint8_t>(bytes, offset) != magic[b])
+                throw ExceptionsNVector::Snapshot("the identifier is missing.");
+
+        result.version = get<uint16_t>(bytes, offset);
+        if(result.version == 0 || result.version > version)
+            throw ExceptionsNVector::Snapshot(
+                "version %zu is not supported.", result.version
+            );
+
+        result.kind = (Kind) get<uint8_t>(bytes, offset);
+        result.type = get<uint8_t>(bytes, offset);
+        result.width = get<uint8_t>(bytes, offset);
+        result.flags = get<uint8_t>(bytes, offset);
+        result.dimension = get<uint64_t>(bytes, offset);
+        result.count = get<uint64_t>(bytes, offset);
+        result.blockEntries = get<uint32_t>(bytes, offset);
+        result.blocks = get<uint64_t>(bytes, offset);
+
+        // Validate the quantities are consistent.
+        if(result.dimension == 0 || result.blockEntries == 0)
+            throw ExceptionsNVector::Snapshot("a quantity is zero.");
+
+        if(
+            result.count > std::numeric_limits<size_t>::max() /
+            result.dimension
+        )
+            throw ExceptionsNVector::Snapshot("the vector is too large.");
+
+        entries = result.dimension * result.count;
+        if(
+            result.blocks != entries / result.blockEntries +
+            (entries % result.blockEntries != 0)
+        )
+            throw ExceptionsNVector::Snapshot(
+                "the number of blocks does not match the entries."
+            );
+
+        return result;
+    }
+
+
+    /**
+     * Reads the header of the given snapshot and validates it holds the
+     * given kind of vector, with entries of the given type, stored in the
+     * byte order of this machine.
+     * 
+     * @param bytes The bytes of the snapshot.
+     * 
+     * @param kind The expected kind of vector.
+     * 
+     * @return The header of the snapshot.
+    */
+    template <typename T>
+    Header expectedHeader(const std::vector<uint8_t>& bytes, Kind kind)
+    {
+        // Auxiliary variables.
+        Header result = header(bytes);
+        bool little = (result.flags & flagLittleEndian) != 0;
+
+        if(result.kind != kind)
+            throw ExceptionsNVector::Snapshot(
+                "the snapshot holds another kind of vector."
+            );
+
+        if(result.type != typeCode<T>() || result.width != sizeof(T))
+            throw ExceptionsNVector::Snapshot(
+                "the snapshot holds another type of entries."
+            );
+
+        if(little != littleEndian())
+            throw ExceptionsNVector::Snapshot(
+                "the snapshot was stored with another byte order."
+            );
+
+        if(kind == Kind::NVector && result.count != 1)
+            throw ExceptionsNVector::Snapshot(
+                "the snapshot of an NVector has more than one row."
+            );
+
+        if(result.blockEntries > blockEntries)
+            throw ExceptionsNVector::Snapshot("the blocks are too large.");
+
+        return result;
+    }
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // NVector Functions
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    /**
+     * Builds the snapshot of the given NVector.
+     * 
+     * @param vector The NVector to be stored.
+     * 
+     * @param parallel True, if the blocks must be split among several
+     * threads; False, otherwise.
+     * 
+     * @return The bytes of the snapshot.
+    */
+    template <typename T, typename A>
+    std::vector<uint8_t> encode(NVector::NVector<T, A>& vector, bool parallel)
+    {
+        // Auxiliary variables.
+        std::vector<T*> rows{vector.data()};
+
+        return encodeRows<T>(
+            rows, nullptr, Kind::NVector, vector.size(), parallel
+        );
+    }
+
+
+    /**
+     * Builds the snapshot of the given NVector, XOR-ed with the given previous
+     * NVector, such that the entries that did not change compress to almost
+     * nothing.
+     * 
+     * @param vector The NVector to be stored.
+     * 
+     * @param previous The NVector of the previous snapshot; must have the same
+     * dimension.
+     * 
+     * @param parallel True, if the blocks must be split among several
+     * threads; False, otherwise.
+     * 
+     * @return The bytes of the snapshot.
+    */
+    template <typename T, typename A>
+    std::vector<uint8_t> encode(
+        NVector::NVector<T, A>& vector, NVector::NVector<T, A>& previous,
+        bool parallel
+    )
+    {
+        // Auxiliary variables.
+        std::vector<T*> rows{vector.data()};
+        std::vector<T*> base{previous.data()};
+
+        // Validate the dimensions.
+        ValidationGeneral::validateDimensions(
+            vector.size(), previous.size(), true
+        );
+
+        return encodeRows<T>(
+            rows, &base, Kind::NVector, vector.size(), parallel
+        );
+    }
+
+
+    /**
+     * Builds the NVector stored in the given snapshot.
+     * 
+     * @param bytes The bytes of the snapshot; must not be a delta.
+     * 
+     * @param parallel True, if the blocks must be split among several
+     * threads; False, otherwise.
+     * 
+     * @return The NVector of the snapshot, with the default accumulation
+     * type of the NVectors unless another one is requested.
+    */
+    template <
+        typename T, typename A = typename TypesInteger::Accumulator<T>::type
+    >
+    NVector::NVector<T, A> decodeNVector(
+        const std::vector<uint8_t>& bytes, bool parallel
+    )
+    {
+        // Auxiliary variables.
+        Header info = expectedHeader<T>(bytes, Kind::NVector);
+        NVector::NVector<T, A> result(
+            (size_t) info.dimension, NVector::uninitialized
+        );
+        std::vector<T*> rows{result.data()};
+
+        decodeRows<T>(bytes, info, rows, nullptr, parallel);
+
+        return result;
+    }
+
+
+    /**
+     * Builds the NVector stored in the given snapshot, which can be a delta
+     * of the given previous NVector.
+     * 
+     * @param bytes The bytes of the snapshot.
+     * 
+     * @param previous The NVector of the previous snapshot; must have the same
+     * dimension.
+     * 
+     * @param parallel True, if the blocks must be split among several
+     * threads; False, otherwise.
+     * 
+     * @return The NVector of the snapshot.
+    */
+    template <typename T, typename A>
+    NVector::NVector<T, A> decodeNVector(
+        const std::vector<uint8_t>& bytes, NVector::NVector<T, A>& previous,
+        bool parallel
+    )
+    {
+        // Auxiliary variables.
+        Header info = expectedHeader<T>(bytes, Kind::NVector);
+        NVector::NVector<T, A> result(
+            (size_t) info.dimension, NVector::uninitialized
+        );
+        std::vector<T*> rows{result.data()};
+        std::vector<T*> base{previous.data()};
+
+        // Validate the dimensions.
+        ValidationGeneral::validateDimensions(
+            (size_t) info.dimension, previous.size(), true
+        );
+
+        decodeRows<T>(bytes, info, rows, &base, parallel);
+
+        return result;
+    }
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Vector of NVectors Functions
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    /**
+     * Builds the snapshot of the given vector of NVectors.
+     * 
+     * @param vector The vector of NVectors to be stored.
+     * 
+     * @param parallel True, if the blocks must be split among several
+     * threads; False, otherwise.
+     * 
+     * @return The bytes of the snapshot.
+    */
+    template <typename T>
+    std::vector<uint8_t> encode(
+        VNVectors::VNVectors<T>& vector, bool parallel
+    )
+    {
+        return encodeRows<T>(
+            UFuncs::rows(vector), nullptr, Kind::VNVectors,
+            vector.dimensions(), parallel
+        );
+    }
+
+
+    /**
+     * Builds the snapshot of the given vector of NVectors, XOR-ed with the
+     * given previous vector of NVectors, such that the entries that did not
+     * change compress to almost nothing.
+     * 
+     * @param vector The vector of NVectors to be stored.
+     * 
+     * @param previous The vector of NVectors of the previous snapshot; must
+     * have the same dimension and number of NVectors.
+     * 
+     * @param parallel True, if the blocks must be split among several
+     * threads; False, otherwise.
+     * 
+     * @return The bytes of the snapshot.
+    */
+    template <typename T>
+    std::vector<uint8_t> encode(
+        VNVectors::VNVectors<T>& vector, VNVectors::VNVectors<T>& previous,
+        bool parallel
+    )
+    {
+        // Auxiliary variables.
+        std::vector<T*> base = UFuncs::rows(previous);
+
+        // Validate the dimensions and the sizes.
+        ValidationGeneral::validateDimensions(
+            vector.dimensions(), previous.dimensions(), true
+        );
+        ValidationGeneral::validateDimensions(
+            vector.size(), previous.size(), true
+        );
+
+        return encodeRows<T>(
+            UFuncs::rows(vector), &base, Kind::VNVectors,
+            vector.dimensions(), parallel
+        );
+    }
+
+
+    /**
+     * Builds the vector of NVectors stored in the given snapshot.
+     * 
+     * @param bytes The bytes of the snapshot; must not be a delta.
+     * 
+     * @param parallel True, if the blocks must be split among several
+     * threads; False, otherwise.
+     * 
+     * @return The vector of NVectors of the snapshot.
+    */
+    template <typename T>
+    VNVectors::VNVectors<T> decodeVNVectors(
+        const std::vector<uint8_t>& bytes, bool parallel
+    )
+    {
+        // Auxiliary variables.
+        Header info = expectedHeader<T>(bytes, Kind::VNVectors);
+
+        // An empty vector of NVectors has no blocks to decode.
+        if(info.count == 0)
+        {
+            readTable(bytes, info, headerSize);
+            return VNVectors::VNVectors<T>((size_t) info.dimension);
+        }
+
+        VNVectors::VNVectors<T> result(
+            (size_t) info.dimension, (size_t) info.count,
+            NVector::uninitialized
+        );
+
+        decodeRows<T>(bytes, info, UFuncs::rows(result), nullptr, parallel);
+
+        return result;
+    }
+
+
+    /**
+     * Builds the vector of NVectors stored in the given snapshot, which can
+     * be a delta of the given previous vector of NVectors.
+     * 
+     * @param bytes The bytes of the snapshot.
+     * 
+     * @param previous The vector of NVectors of the previous snapshot; must
+     * have the same dimension and number of NVectors.
+     * 
+     * @param parallel True, if the blocks must be split among several
+     * threads; False, otherwise.
+     * 
+     * @return The vector of NVectors of the snapshot.
+    */
+    template <typename T>
+    VNVectors::VNVectors<T> decodeVNVectors(
+        const std::vector<uint8_t>& bytes, VNVectors::VNVectors<T>& previous,
+        bool parallel
+    )
+    {
+        // Auxiliary variables.
+        Header info = expectedHeader<T>(bytes, Kind::VNVectors);
+        std::vector<T*> base = UFuncs::rows(previous);
+
+        // Validate the dimensions and the sizes.
+        ValidationGeneral::validateDimensions(
+            (size_t) info.dimension, previous.dimensions(), true
+        );
+        ValidationGeneral::validateDimensions(
+            (size_t) info.count, previous.size(), true
+        );
+
+        // An empty vector of NVectors has no blocks to decode.
+        if(info.count == 0)
+        {
+            readTable(bytes, info, headerSize);
+            return VNVectors::VNVectors<T>((size_t) info.dimension);
+        }
+
+        VNVectors::VNVectors<T> result(
+            (size_t) info.dimension, (size_t) info.count,
+            NVector::uninitialized
+        );
+
+        decodeRows<T>(bytes, info, UFuncs::rows(result), &base, parallel);
+
+        return result;
+    }
+}
@@ -0,0 +1,556 @@
+/*
+    File that contains the sparse vector class and its functions.
+*/
+#pragma once
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <ostream>
+#include <vector>
+
+
+// User defined.
+#include "./Headers/Validation/validationGeneral.hpp"
+#include "./Headers/Validation/validationNumerical.hpp"
+#include "./nvectors.hpp"
+
+
+//##############################################################################
+// Namespaces
+//##############################################################################
+
+
+namespace SNVector
+{
+    //##########################################################################
+    // Classes
+    //##########################################################################
+
+
+    /**
+     * Class of vectors that only store their non-zero entries, as pairs of
+     * indexes and values sorted by index; such that the memory and the time
+     * of the operations scale with the number of non-zero entries instead of
+     * the dimension.
+    */
+    template <typename T>
+    class SNVector
+    {
+        public:
+        //######################################################################
+        // Operator Overloads
+        //######################################################################
+
+
+        ////////////////////////////////////////////////////////////////////////
+        // Arithmetic
+        ////////////////////////////////////////////////////////////////////////
+
+
+        /**
+         * Division operator overload. To divide each entry of the vector by the
+         * given scalar quantity.
+         * 
+         * @param vector The basis vector.
+         * 
+         * @param value The value by which each entry will be divided.
+         *  
+         * @return A copy of the vector with each of its entries divided by the
+         * given value.
+        */
+        friend SNVector<T> operator / (SNVector<T> vector, T value)
+        {   
+            // Validate finite division.
+            ValidationGeneral::isNotDivingByZero(value, true);
+
+            // Divide each entry.
+            for(T& entry : vector.values) entry /= value;
+
+            return vector;
+        }
+
+
+        /**
+         * Multiplication operator overload. To multiply each entry of the
+         * vector by the given scalar quantity.
+         * 
+         * @param vector The basis vector.
+         * 
+         * @param value The value by which each entry will be multiplied.
+         *  
+         * @return A copy of the vector with each of its entries multiplied by
+         * the given value.
+        */
+        friend SNVector<T> operator * (SNVector<T> vector, T value)
+        {
+            // Multiply each entry.
+            for(T& entry : vector.values) entry *= value;
+
+            return vector;
+        }
+
+
+        /**
+         * Multiplication operator overload. To multiply each entry of the
+         * vector by the given scalar quantity.
+         * 
+         * @param value The value by which each entry will be multiplied.
+         * 
+         * @param vector The basis vector.
+         * 
+         * @return A copy of the vector with each of its entries multiplied by
+         * the given value.
+        */
+        friend SNVector<T> operator * (T value, SNVector<T> vector)
+        {
+            return vector * value;
+        }
+
+
+        ////////////////////////////////////////////////////////////////////////
+        // Other Functionality
+        ////////////////////////////////////////////////////////////////////////
+
+
+        /**
+         * Comparison operator. Two sparse vectors are equal if they have the
+         * same dimension and the same non-zero entries.
+         * 
+         * @param vector_1 A reference to the first SNVector being compared.
+         * 
+         * @param vector_2 A reference to the second SNVector being compared.
+        */
+        friend bool operator == (
+            const SNVector<T>& vector_1, const SNVector<T>& vector_2
+        )
+        {
+            return vector_1.dimension == vector_2.dimension &&
+                vector_1.indexes == vector_2.indexes &&
+                vector_1.values == vector_2.values;
+        }
+
+
+        /**
+         * Outstream string to be print the vector. To be able to view the
+         * non-zero entries of the vector, as index: value pairs.
+         * 
+         * @param out A reference to the ostream operator.
+         * 
+         * @param vector A reference to the vector to be printed.
+        */
+        friend std::ostream& operator << (
+            std::ostream& out, const SNVector<T>& vector
+        )
+        {
+            // Open the vector.
+            out << "{";
+
+            // Print the content.
+            for(size_t i = 0; i < vector.values.size(); ++i)
+            {
+                out << vector.indexes[i] << ": ";
+                out << std::setprecision(7) << (long double) vector.values[i];
+                if(i + 1 < vector.values.size()) out << ", ";
+            }
+
+            // Close the vector.
+            out << "}";
+
+            return out;
+        }
+
+
+        /**
+         * Returns the value of the entry with the given index; zero, if the
+         * entry is not stored.
+         * 
+         * @param index The requested index to be accessed.
+        */
+        T operator [] (size_t index) const
+        {
+            // Validate the index is in range.
+            ValidationGeneral::validateInRange(index, 0, dimension - 1, true);
+
+            // Search the index.
+            auto found = std::lower_bound(
+                indexes.begin(), indexes.end(), index
+            );
+
+            if(found == indexes.end() || *found != index) return (T) 0;
+
+            return values[found - indexes.begin()];
+        }
+
+
+        //######################################################################
+        // Constructor(s) and Destructor(s)
+        //######################################################################
+
+
+        /**
+         * Constructs a new sparse vector, where all the entries are zero.
+         * 
+         * @param dimensions The number of entries the vector has; must be 
+         * greater than zero.
+        */
+        SNVector(size_t dimensions) :
+        dimension{dimensions}
+        {
+            // Validate the quantities.
+            ValidationNumerical::rangeGreater<size_t>(0, dimension, true);
+            ValidationNumerical::isFloating<T>((T) 1, true);
+        }
+
+
+        /**
+         * Constructs a new sparse vector from the given pairs of indexes and
+         * values; the pairs do not need to be sorted, the values of repeated
+         * indexes are added and zero values are not stored.
+         * 
+         * @param dimensions The number of entries the vector has; must be 
+         * greater than zero.
+         * 
+         * @param nindexes The indexes of the non-zero entries.
+         * 
+         * @param nvalues The values of the non-zero entries.
+        */
+        SNVector(
+            size_t dimensions, const std::vector<size_t>& nindexes,
+            const std::vector<T>& nvalues
+        ) :
+        SNVector(dimensions)
+        {
+            // Validate the quantities.
+            ValidationGeneral::validateDimensions(
+                nindexes.size(), nvalues.size(), true
+            );
+
+            // Auxiliary variables.
+            std::vector<size_t> order(nindexes.size());
+            std::iota(order.begin(), order.end(), 0);
+
+            // Sort the entries by index.
+            std::stable_sort(order.begin(), order.end(),
+                [&nindexes](size_t a, size_t b)
+                {
+                    return nindexes[a] < nindexes[b];
+                }
+            );
+
+            indexes.reserve(order.size());
+            values.reserve(order.size());
+
+            // Add the entries, merging the repeated ones.
+            for(size_t i : order)
+            {
+                ValidationGeneral::validateInRange(
+                    nindexes[i], 0, dimension - 1, true
+                );
+
+                if(!indexes.empty() && indexes.back() == nindexes[i])
+                {
+                    values.back() += nvalues[i];
+                    continue;
+                }
+
+                indexes.push_back(nindexes[i]);
+                values.push_back(nvalues[i]);
+            }
+
+            // Remove the entries that are zero.
+            prune();
+        }
+
+
+        /**
+         * Constructs a new sparse vector with the non-zero entries of the
+         * given dense vector.
+         * 
+         * @param vector The dense vector to be converted.
+        */
+        SNVector(const NVector::NVector<T>& vector) :
+        SNVector(vector.size())
+        {
+            // Auxiliary variables.
+            const T* entries = vector.data();
+
+            // Keep the non-zero entries.
+            for(size_t i = 0; i < dimension; ++i)
+            {
+                if(entries[i] == (T) 0) continue;
+
+                indexes.push_back(i);
+                values.push_back(entries[i]);
+            }
+
+            indexes.shrink_to_fit();
+            values.shrink_to_fit();
+        }
+
+
+        /**
+         * Destructs the given object pointer.
+        */
+        ~SNVector(){}
+
+
+        //######################################################################
+        // Functions
+        //######################################################################
+
+
+        ////////////////////////////////////////////////////////////////////////
+        // Non-Template Functions
+        ////////////////////////////////////////////////////////////////////////
+
+
+        /**
+         * Returns the number of non-zero entries that are stored.
+         * 
+         * @return The number of non-zero entries that are stored.
+        */
+        size_t nonZeros() const
+        {
+            return indexes.size();
+        }
+
+
+        /**
+         * Returns the number of entries of the vector, including the zeros.
+         * 
+         * @return The number of entries of the vector.
+        */
+        size_t size() const
+        {
+            return dimension;
+        }
+
+
+        ////////////////////////////////////////////////////////////////////////
+        // Template Functions
+        ////////////////////////////////////////////////////////////////////////
+
+
+        /**
+         * Returns the dot product with the given dense vector, where only the
+         * entries of the dense vector with a stored index are gathered.
+         * 
+         * @param vector The dense vector with which the dot product will be
+         * taken.
+         * 
+         * @return The dot product of the vector itself with the given vector.
+        */
+        T dotProduct(const NVector::NVector<T>& vector) const
+        {
+            // Validate the sizes are the same.
+            ValidationGeneral::validateDimensions(
+                dimension, vector.size(), true
+            );
+
+            // Auxiliary variables.
+            const T* entries = vector.data();
+            T accum = (T) 0;
+
+            // Gather the entries.
+            for(size_t i = 0; i < indexes.size(); ++i)
+                accum += values[i] * entries[indexes[i]];
+
+            return accum;
+        }
+
+
+        /**
+         * Returns the dot product with the given sparse vector, where only the
+         * common indexes are multiplied. The indexes are merged when both
+         * vectors have a similar number of entries; otherwise, the entries of
+         * the shorter vector are searched in the longer one by galloping.
+         * 
+         * @param vector The sparse vector with which the dot product will be
+         * taken.
+         * 
+         * @return The dot product of the vector itself with the given vector.
+        */
+        T dotProduct(const SNVector<T>& vector) const
+        {
+            // Validate the sizes are the same.
+            ValidationGeneral::validateDimensions(
+                dimension, vector.size(), true
+            );
+
+            // Make the vector itself the shorter one.
+            if(vector.nonZeros() < nonZeros()) return vector.dotProduct(*this);
+
+            // The lengths are very different.
+            if(nonZeros() * gallopRatio < vector.nonZeros())
+                return dotProductGallop(vector);
+
+            // Auxiliary variables.
+            const size_t* ia = indexes.data();
+            const size_t* ib = vector.indexes.data();
+            const size_t na = indexes.size();
+            const size_t nb = vector.indexes.size();
+            size_t i{0}, j{0};
+            T accum = (T) 0;
+
+            // Merge the indexes, advancing without branches on the values.
+            while(i < na && j < nb)
+            {
+                if(ia[i] == ib[j]) accum += values[i] * vector.values[j];
+
+                size_t a = ia[i], b = ib[j];
+                i += a <= b;
+                j += b <= a;
+            }
+
+            return accum;
+        }
+
+
+        /**
+         * Returns the L2 norm of the vector.
+         * 
+         * @return The L2 norm of the vector.
+        */
+        T norm() const
+        {
+            return std::sqrt(normSquared());
+        }
+
+
+        /**
+         * Returns the L2 norm, squared, of the vector.
+         * 
+         * @return The L2 norm, squared, of the vector.
+        */
+        T normSquared() const
+        {
+            // Auxiliary variables.
+            T accum = (T) 0;
+
+            for(const T& entry : values) accum += entry * entry;
+
+            return accum;
+        }
+
+
+        /**
+         * Returns the dense version of the vector.
+         * 
+         * @return The dense vector, with the non-stored entries set to zero.
+        */
+        NVector::NVector<T> toNVector() const
+        {
+            // Auxiliary variables.
+            NVector::NVector<T> vector = NVector::NVector<T>(dimension);
+            T* entries = vector.data();
+
+            // Scatter the entries.
+            for(size_t i = 0; i < indexes.size(); ++i)
+                entries[indexes[i]] = values[i];
+
+            return vector;
+        }
+
+
+        private:
+        //######################################################################
+        // Functions
+        //######################################################################
+
+
+        /**
+         * Returns the dot product with the given sparse vector, which has many
+         * more entries than the vector itself. Each index is searched with an
+         * exponential search followed by a binary search, starting from the
+         * position of the previous match.
+         * 
+         * @param vector The longer sparse vector.
+         * 
+         * @return The dot product of the vector itself with the given vector.
+        */
+        T dotProductGallop(const SNVector<T>& vector) const
+        {
+            // Auxiliary variables.
+            auto first = vector.indexes.begin();
+            auto last = vector.indexes.end();
+            T accum = (T) 0;
+
+            for(size_t i = 0; i < indexes.size() && first != last; ++i)
+            {
+                // Gallop until the index is bracketed.
+                size_t step{1};
+                auto upper = first;
+                while(upper != last && *upper < indexes[i])
+                {
+                    first = upper;
+                    upper = last - upper > (ptrdiff_t) step ?
+                        upper + step : last;
+                    step *= 2;
+                }
+
+                // Search the index in the bracket.
+                first = std::lower_bound(first, upper, indexes[i]);
+                if(first != last && *first == indexes[i])
+                    accum += values[i] *
+                        vector.values[first - vector.indexes.begin()];
+            }
+
+            return accum;
+        }
+
+
+        /**
+         * Removes the stored entries that are zero.
+        */
+        void prune()
+        {
+            // Auxiliary variables.
+            size_t count{0};
+
+            for(size_t i = 0; i < values.size(); ++i)
+            {
+                if(values[i] == (T) 0) continue;
+
+                indexes[count] = indexes[i];
+                values[count] = values[i];
+                ++count;
+            }
+
+            indexes.resize(count);
+            values.resize(count);
+            indexes.shrink_to_fit();
+            values.shrink_to_fit();
+        }
+
+
+        //######################################################################
+        // Variables
+        //######################################################################
+
+
+        // Ratio of the lengths above which the indexes are galloped.
+        static constexpr size_t gallopRatio{16};
+
+
+        // Sorted indexes of the non-zero entries.
+        std::vector<size_t> indexes;
+
+
+        // Values of the non-zero entries.
+        std::vector<T> values;
+
+
+        // Number of entries of the vector, including the zeros.
+        size_t dimension{0};
+    };
+}
@@ -0,0 +1,18 @@
+# Build the library.
+./build.ps1
+if ($LASTEXITCODE -ne 0) { exit 1 }
+
+# Compile, link against the library and run each test; the tests use assert,
+# so they must not be compiled with NDEBUG.
+$cxx = if ($env:CXX) { $env:CXX } else { "g++" }
+$flags = if ($env:CXXFLAGS) { $env:CXXFLAGS -split " " } else { @() }
+foreach ($file in Get-ChildItem ./Tests/*.cpp) {
+    & $cxx -std=c++17 -O2 -flto -pthread @flags -DNVECTORS_USE_LIBRARY `
+        -o test.exe $file.FullName ./Build/libnvectors.a
+    if ($LASTEXITCODE -ne 0) { exit 1 }
+    ./test.exe
+    if ($LASTEXITCODE -ne 0) { Remove-Item test.exe; exit 1 }
+}
+
+# Remove the executable.
+Remove-Item test.exe
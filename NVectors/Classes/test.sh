@@ -0,0 +1,16 @@
+#!/bin/bash
+
+# Build the library.
+./build.sh || exit 1
+
+# Compile, link against the library and run each test; the tests use assert,
+# so they must not be compiled with NDEBUG.
+for file in ./Tests/*.cpp
+do
+    "${CXX:-c++}" -std=c++17 -O2 -flto -pthread $CXXFLAGS \
+        -DNVECTORS_USE_LIBRARY -o test "$file" ./Build/libnvectors.a || exit 1
+    ./test || { rm -f test; exit 1; }
+done
+
+# Remove the executable.
+rm test
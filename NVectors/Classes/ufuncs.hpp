@@ -0,0 +1,1619 @@
+/*
+    File that contains the element-wise functions of the NVectors and the
+    vectors of NVectors, i.e., the universal functions of numpy.
+*/
+#pragma once
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+
+// User defined.
+#include "./Headers/Exceptions/exceptionsNumerical.hpp"
+#include "./Headers/Math/mathApproximations.hpp"
+#include "./Headers/Parallel/parallelGeneral.hpp"
+#include "./Headers/Types/typesInteger.hpp"
+#include "./Headers/Validation/validationGeneral.hpp"
+#include "./nvectors.hpp"
+#include "./vnvectors.hpp"
+
+
+//##############################################################################
+// Namespaces
+//##############################################################################
+
+
+namespace UFuncs
+{
+    //##########################################################################
+    // Variables
+    //##########################################################################
+
+
+    // Minimum number of entries that each thread must process.
+    constexpr size_t parallelEntries{1 << 16};
+
+
+    //##########################################################################
+    // Functions
+    //##########################################################################
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Auxiliary Functions
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    /**
+     * Runs the given kernel over the NVectors of the given vector of
+     * NVectors, splitting them among several threads if required; each
+     * thread gets enough entries to pay for its creation.
+     * 
+     * @param vector The vector of NVectors to be processed.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+     * 
+     * @param kernel The function, with signature kernel(first, last), that
+     * processes the NVectors in the range [first, last).
+    */
+    template <typename T, typename K>
+    void forRows(
+        const VNVectors::VNVectors<T>& vector, bool parallel, K kernel
+    )
+    {
+        // Auxiliary variables.
+        size_t grain = std::max<size_t>(
+            parallelEntries / std::max<size_t>(vector.dimensions(), 1), 1
+        );
+
+        if(parallel)
+            ParallelGeneral::parallelFor(0, vector.size(), grain, kernel);
+        else
+            kernel(0, vector.size());
+    }
+
+
+    /**
+     * Returns the pointers to the entries of each of the NVectors of the
+     * given vector of NVectors, such that the threads only use pointers.
+     * 
+     * @param vector The vector of NVectors.
+     * 
+     * @return The pointers to the entries of each of the NVectors.
+    */
+    template <typename T>
+    std::vector<T*> rows(VNVectors::VNVectors<T>& vector)
+    {
+        // Auxiliary variables.
+        std::vector<T*> pointers(vector.size());
+
+        for(size_t i = 0; i < vector.size(); ++i)
+            pointers[i] = vector[i].data();
+
+        return pointers;
+    }
+
+
+    /**
+     * Returns the pointers to the entries of each of the NVectors of the
+     * given vector of NVectors, that are only read, such that the cached
+     * norms of the NVectors are kept.
+     * 
+     * @param vector The vector of NVectors.
+     * 
+     * @return The pointers to the entries of each of the NVectors.
+    */
+    template <typename T>
+    std::vector<const T*> rows(const VNVectors::VNVectors<T>& vector)
+    {
+        // Auxiliary variables.
+        std::vector<const T*> pointers(vector.size());
+
+        for(size_t i = 0; i < vector.size(); ++i)
+            pointers[i] = vector[i].data();
+
+        return pointers;
+    }
+
+
+    /**
+     * Validates that the given vectors of NVectors have the same size and
+     * dimension.
+     * 
+     * @param vector_1 The first vector of NVectors.
+     * 
+     * @param vector_2 The second vector of NVectors.
+    */
+    template <typename T>
+    void validateShapes(
+        VNVectors::VNVectors<T>& vector_1, VNVectors::VNVectors<T>& vector_2
+    )
+    {
+        ValidationGeneral::validateDimensions(
+            vector_1.dimensions(), vector_2.dimensions(), true
+        );
+        ValidationGeneral::validateDimensions(
+            vector_1.size(), vector_2.size(), true
+        );
+    }
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Mapping Functions
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    /**
+     * Applies the given function to each of the entries of the NVector and
+     * stores the results in the given output, i.e., output[i] =
+     * function(vector[i]).
+     * 
+     * @param vector The NVector whose entries are the arguments.
+     * 
+     * @param output The NVector where the results will be stored; it can be
+     * the given NVector itself.
+     * 
+     * @param function The element-wise function, with signature function(T).
+    */
+    template <typename T, typename A, typename F>
+    void map(
+        NVector::NVector<T, A>& vector, NVector::NVector<T, A>& output,
+        F function
+    )
+    {
+        // Validate the dimensions.
+        ValidationGeneral::validateDimensions(
+            vector.size(), output.size(), true
+        );
+
+        // Auxiliary variables.
+        const T* a = vector.data();
+        T* c = output.data();
+
+        for(size_t i = 0; i < output.size(); ++i) c[i] = function(a[i]);
+    }
+
+
+    /**
+     * Applies the given function to each pair of entries of the NVectors and
+     * stores the results in the given output, i.e., output[i] =
+     * function(vector_1[i], vector_2[i]).
+     * 
+     * @param vector_1 The NVector whose entries are the first arguments.
+     * 
+     * @param vector_2 The NVector whose entries are the second arguments.
+     * 
+     * @param output The NVector where the results will be stored; it can be
+     * any of the given NVectors.
+     * 
+     * @param function The element-wise function, with signature
+     * function(T, T).
+    */
+    template <typename T, typename A, typename F>
+    void map(
+        NVector::NVector<T, A>& vector_1, NVector::NVector<T, A>& vector_2,
+        NVector::NVector<T, A>& output, F function
+    )
+    {
+        // Validate the dimensions.
+        ValidationGeneral::validateDimensions(
+            vector_1.size(), vector_2.size(), true
+        );
+        ValidationGeneral::validateDimensions(
+            vector_1.size(), output.size(), true
+        );
+
+        // Auxiliary variables.
+        const T* a = vector_1.data();
+        const T* b = vector_2.data();
+        T* c = output.data();
+
+        for(size_t i = 0; i < output.size(); ++i) c[i] = function(a[i], b[i]);
+    }
+
+
+    /**
+     * Applies the given function to each triple of entries of the NVectors
+     * and stores the results in the given output, i.e., output[i] =
+     * function(vector_1[i], vector_2[i], vector_3[i]).
+     * 
+     * @param vector_1 The NVector whose entries are the first arguments.
+     * 
+     * @param vector_2 The NVector whose entries are the second arguments.
+     * 
+     * @param vector_3 The NVector whose entries are the third arguments.
+     * 
+     * @param output The NVector where the results will be stored; it can be
+     * any of the given NVectors.
+     * 
+     * @param function The element-wise function, with signature
+     * function(T, T, T).
+    */
+    template <typename T, typename A, typename F>
+    void map(
+        NVector::NVector<T, A>& vector_1, NVector::NVector<T, A>& vector_2,
+        NVector::NVector<T, A>& vector_3, NVector::NVector<T, A>& output,
+        F function
+    )
+    {
+        // Validate the dimensions.
+        ValidationGeneral::validateDimensions(
+            vector_1.size(), vector_2.size(), true
+        );
+        ValidationGeneral::validateDimensions(
+            vector_1.size(), vector_3.size(), true
+        );
+        ValidationGeneral::validateDimensions(
+            vector_1.size(), output.size(), true
+        );
+
+        // Auxiliary variables.
+        const T* a = vector_1.data();
+        const T* b = vector_2.data();
+        const T* d = vector_3.data();
+        T* c = output.data();
+
+        for(size_t i = 0; i < output.size(); ++i)
+            c[i] = function(a[i], b[i], d[i]);
+    }
+
+
+    /**
+     * Applies the given function to each of the entries of the vector of
+     * NVectors and stores the results in the given output, i.e.,
+     * output[i][j] = function(vector[i][j]).
+     * 
+     * @param vector The vector of NVectors whose entries are the arguments.
+     * 
+     * @param output The vector of NVectors where the results will be stored;
+     * it can be the given vector of NVectors itself.
+     * 
+     * @param function The element-wise function, with signature function(T);
+     * it must be safe to call from several threads.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T, typename F>
+    void map(
+        VNVectors::VNVectors<T>& vector, VNVectors::VNVectors<T>& output,
+        F function, bool parallel
+    )
+    {
+        // Validate the dimensions and the sizes.
+        validateShapes(vector, output);
+
+        // Auxiliary variables.
+        std::vector<T*> a = rows(vector);
+        std::vector<T*> c = rows(output);
+        size_t dimension = output.dimensions();
+
+        forRows(output, parallel, [&](size_t first, size_t last)
+        {
+            for(size_t i = first; i < last; ++i)
+                for(size_t j = 0; j < dimension; ++j)
+                    c[i][j] = function(a[i][j]);
+        });
+    }
+
+
+    /**
+     * Applies the given function to each pair of entries of the vectors of
+     * NVectors and stores the results in the given output, i.e.,
+     * output[i][j] = function(vector_1[i][j], vector_2[i][j]).
+     * 
+     * @param vector_1 The vector of NVectors whose entries are the first
+     * arguments.
+     * 
+     * @param vector_2 The vector of NVectors whose entries are the second
+     * arguments.
+     * 
+     * @param output The vector of NVectors where the results will be stored;
+     * it can be any of the given vectors of NVectors.
+     * 
+     * @param function The element-wise function, with signature
+     * function(T, T); it must be safe to call from several threads.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T, typename F>
+    void map(
+        VNVectors::VNVectors<T>& vector_1, VNVectors::VNVectors<T>& vector_2,
+        VNVectors::VNVectors<T>& output, F function, bool parallel
+    )
+    {
+        // Validate the dimensions and the sizes.
+        validateShapes(vector_1, vector_2);
+        validateShapes(vector_1, output);
+
+        // Auxiliary variables.
+        std::vector<T*> a = rows(vector_1);
+        std::vector<T*> b = rows(vector_2);
+        std::vector<T*> c = rows(output);
+        size_t dimension = output.dimensions();
+
+        forRows(output, parallel, [&](size_t first, size_t last)
+        {
+            for(size_t i = first; i < last; ++i)
+                for(size_t j = 0; j < dimension; ++j)
+                    c[i][j] = function(a[i][j], b[i][j]);
+        });
+    }
+
+
+    /**
+     * Applies the given function to each triple of entries of the vectors of
+     * NVectors and stores the results in the given output, i.e.,
+     * output[i][j] = function(vector_1[i][j], vector_2[i][j],
+     * vector_3[i][j]).
+     * 
+     * @param vector_1 The vector of NVectors whose entries are the first
+     * arguments.
+     * 
+     * @param vector_2 The vector of NVectors whose entries are the second
+     * arguments.
+     * 
+     * @param vector_3 The vector of NVectors whose entries are the third
+     * arguments.
+     * 
+     * @param output The vector of NVectors where the results will be stored;
+     * it can be any of the given vectors of NVectors.
+     * 
+     * @param function The element-wise function, with signature
+     * function(T, T, T); it must be safe to call from several threads.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T, typename F>
+    void map(
+        VNVectors::VNVectors<T>& vector_1, VNVectors::VNVectors<T>& vector_2,
+        VNVectors::VNVectors<T>& vector_3, VNVectors::VNVectors<T>& output,
+        F function, bool parallel
+    )
+    {
+        // Validate the dimensions and the sizes.
+        validateShapes(vector_1, vector_2);
+        validateShapes(vector_1, vector_3);
+        validateShapes(vector_1, output);
+
+        // Auxiliary variables.
+        std::vector<T*> a = rows(vector_1);
+        std::vector<T*> b = rows(vector_2);
+        std::vector<T*> d = rows(vector_3);
+        std::vector<T*> c = rows(output);
+        size_t dimension = output.dimensions();
+
+        forRows(output, parallel, [&](size_t first, size_t last)
+        {
+            for(size_t i = first; i < last; ++i)
+                for(size_t j = 0; j < dimension; ++j)
+                    c[i][j] = function(a[i][j], b[i][j], d[i][j]);
+        });
+    }
+
+
+    /**
+     * Applies the given integer operation to each pair of entries of the
+     * NVectors and stores the results in the given output, only if none of
+     * them overflows; i.e., the output is left untouched if any overflows.
+     * 
+     * @param vector_1 The NVector whose entries are the first arguments.
+     * 
+     * @param vector_2 The NVector whose entries are the second arguments.
+     * 
+     * @param output The NVector where the results will be stored; it can be
+     * any of the given NVectors.
+     * 
+     * @param operation The operation, with signature bool operation(T, T,
+     * T& result), that stores the wrapped result and returns if it overflows.
+     * 
+     * @throw ExceptionsNumerical::Overflow, if any of the results overflows.
+    */
+    template <typename T, typename A, typename F>
+    void mapChecked(
+        NVector::NVector<T, A>& vector_1, NVector::NVector<T, A>& vector_2,
+        NVector::NVector<T, A>& output, F operation
+    )
+    {
+        // Validate the dimensions.
+        ValidationGeneral::validateDimensions(
+            vector_1.size(), vector_2.size(), true
+        );
+        ValidationGeneral::validateDimensions(
+            vector_1.size(), output.size(), true
+        );
+
+        // Auxiliary variables.
+        const T* a = vector_1.cbegin();
+        const T* b = vector_2.cbegin();
+        size_t dimension = vector_1.size();
+        unsigned char overflow{0};
+
+        // Check all the entries first, without branches, such that it
+        // vectorizes.
+        for(size_t i = 0; i < dimension; ++i)
+        {
+            T result;
+            overflow |= (unsigned char) operation(a[i], b[i], result);
+        }
+
+        if(overflow) throw ExceptionsNumerical::Overflow();
+
+        map(vector_1, vector_2, output, [&operation](T x, T y)
+        {
+            T value;
+            operation(x, y, value);
+
+            return value;
+        });
+    }
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Unary Functions
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    /**
+     * Computes the absolute value of each of the entries of the NVector and
+     * stores the results in the given output.
+     * 
+     * @param vector The NVector whose entries are the arguments.
+     * 
+     * @param output The NVector where the results will be stored; it can be the
+     * given NVector itself.
+    */
+    template <typename T, typename A>
+    void abs(NVector::NVector<T, A>& vector, NVector::NVector<T, A>& output)
+    {
+        map(vector, output, [](T x){ return std::abs(x); });
+    }
+
+
+    /**
+     * Computes the absolute value of each of the entries of the NVector, in
+     * place.
+     * 
+     * @param vector The NVector whose entries are the arguments.
+    */
+    template <typename T, typename A>
+    void absIP(NVector::NVector<T, A>& vector)
+    {
+        map(vector, vector, [](T x){ return std::abs(x); });
+    }
+
+
+    /**
+     * Computes the absolute value of each of the entries of the vector of
+     * NVectors and stores the results in the given output.
+     * 
+     * @param vector The vector of NVectors whose entries are the arguments.
+     * 
+     * @param output The vector of NVectors where the results will be stored; it
+     * can be the given vector of NVectors itself.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void abs(
+        VNVectors::VNVectors<T>& vector, VNVectors::VNVectors<T>& output,
+        bool parallel
+    )
+    {
+        map(vector, output, [](T x){ return std::abs(x); }, parallel);
+    }
+
+
+    /**
+     * Computes the absolute value of each of the entries of the vector of
+     * NVectors, in place.
+     * 
+     * @param vector The vector of NVectors whose entries are the arguments.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void absIP(VNVectors::VNVectors<T>& vector, bool parallel)
+    {
+        map(vector, vector, [](T x){ return std::abs(x); }, parallel);
+    }
+
+
+    /**
+     * Computes the value of each of the entries of the NVector clamped to the
+     * given range, i.e., min(max(x, lower), upper), and stores the results in
+     * the given output.
+     * 
+     * @param vector The NVector whose entries are the arguments.
+     * 
+     * @param lower The lower end of the range.
+     * 
+     * @param upper The upper end of the range; it must not be less than the
+     * lower end.
+     * 
+     * @param output The NVector where the results will be stored; it can be the
+     * given NVector itself.
+    */
+    template <typename T, typename A>
+    void clamp(
+        NVector::NVector<T, A>& vector, T lower, T upper,
+        NVector::NVector<T, A>& output
+    )
+    {
+        map(vector, output, [lower, upper](T x)
+        {
+            return std::min(std::max(x, lower), upper);
+        });
+    }
+
+
+    /**
+     * Computes the value of each of the entries of the NVector clamped to the
+     * given range, i.e., min(max(x, lower), upper), in place.
+     * 
+     * @param vector The NVector whose entries are the arguments.
+     * 
+     * @param lower The lower end of the range.
+     * 
+     * @param upper The upper end of the range; it must not be less than the
+     * lower end.
+    */
+    template <typename T, typename A>
+    void clampIP(NVector::NVector<T, A>& vector, T lower, T upper)
+    {
+        map(vector, vector, [lower, upper](T x)
+        {
+            return std::min(std::max(x, lower), upper);
+        });
+    }
+
+
+    /**
+     * Computes the value of each of the entries of the vector of NVectors
+     * clamped to the given range, i.e., min(max(x, lower), upper), and stores
+     * the results in the given output.
+     * 
+     * @param vector The vector of NVectors whose entries are the arguments.
+     * 
+     * @param lower The lower end of the range.
+     * 
+     * @param upper The upper end of the range; it must not be less than the
+     * lower end.
+     * 
+     * @param output The vector of NVectors where the results will be stored; it
+     * can be the given vector of NVectors itself.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void clamp(
+        VNVectors::VNVectors<T>& vector, T lower, T upper,
+        VNVectors::VNVectors<T>& output, bool parallel
+    )
+    {
+        map(vector, output, [lower, upper](T x)
+        {
+            return std::min(std::max(x, lower), upper);
+        }, parallel);
+    }
+
+
+    /**
+     * Computes the value of each of the entries of the vector of NVectors
+     * clamped to the given range, i.e., min(max(x, lower), upper), in place.
+     * 
+     * @param vector The vector of NVectors whose entries are the arguments.
+     * 
+     * @param lower The lower end of the range.
+     * 
+     * @param upper The upper end of the range; it must not be less than the
+     * lower end.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void clampIP(
+        VNVectors::VNVectors<T>& vector, T lower, T upper, bool parallel
+    )
+    {
+        map(vector, vector, [lower, upper](T x)
+        {
+            return std::min(std::max(x, lower), upper);
+        }, parallel);
+    }
+
+
+    /**
+     * Computes the exponential of each of the entries of the NVector and stores
+     * the results in the given output. The error is below 1.5 units in the last
+     * place, see MathApproximations::exp.
+     * 
+     * @param vector The NVector whose entries are the arguments.
+     * 
+     * @param output The NVector where the results will be stored; it can be the
+     * given NVector itself.
+    */
+    template <typename T, typename A>
+    void exp(NVector::NVector<T, A>& vector, NVector::NVector<T, A>& output)
+    {
+        map(vector, output, [](T x){ return MathApproximations::exp(x); });
+    }
+
+
+    /**
+     * Computes the exponential of each of the entries of the NVector, in place.
+     * The error is below 1.5 units in the last place, see
+     * MathApproximations::exp.
+     * 
+     * @param vector The NVector whose entries are the arguments.
+    */
+    template <typename T, typename A>
+    void expIP(NVector::NVector<T, A>& vector)
+    {
+        map(vector, vector, [](T x){ return MathApproximations::exp(x); });
+    }
+
+
+    /**
+     * Computes the exponential of each of the entries of the vector of NVectors
+     * and stores the results in the given output. The error is below 1.5 units
+     * in the last place, see MathApproximations::exp.
+     * 
+     * @param vector The vector of NVectors whose entries are the arguments.
+     * 
+     * @param output The vector of NVectors where the results will be stored; it
+     * can be the given vector of NVectors itself.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void exp(
+        VNVectors::VNVectors<T>& vector, VNVectors::VNVectors<T>& output,
+        bool parallel
+    )
+    {
+        map(vector, output, [](T x)
+        {
+            return MathApproximations::exp(x);
+        }, parallel);
+    }
+
+
+    /**
+     * Computes the exponential of each of the entries of the vector of
+     * NVectors, in place. The error is below 1.5 units in the last place, see
+     * MathApproximations::exp.
+     * 
+     * @param vector The vector of NVectors whose entries are the arguments.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void expIP(VNVectors::VNVectors<T>& vector, bool parallel)
+    {
+        map(vector, vector, [](T x)
+        {
+            return MathApproximations::exp(x);
+        }, parallel);
+    }
+
+
+    /**
+     * Computes the natural logarithm of each of the entries of the NVector and
+     * stores the results in the given output. The error is below 1 unit in the
+     * last place, see MathApproximations::log; zero gives -infinity and the
+     * negative entries give not a number.
+     * 
+     * @param vector The NVector whose entries are the arguments.
+     * 
+     * @param output The NVector where the results will be stored; it can be the
+     * given NVector itself.
+    */
+    template <typename T, typename A>
+    void log(NVector::NVector<T, A>& vector, NVector::NVector<T, A>& output)
+    {
+        map(vector, output, [](T x){ return MathApproximations::log(x); });
+    }
+
+
+    /**
+     * Computes the natural logarithm of each of the entries of the NVector, in
+     * place. The error is below 1 unit in the last place, see
+     * MathApproximations::log; zero gives -infinity and the negative entries
+     * give not a number.
+     * 
+     * @param vector The NVector whose entries are the arguments.
+    */
+    template <typename T, typename A>
+    void logIP(NVector::NVector<T, A>& vector)
+    {
+        map(vector, vector, [](T x){ return MathApproximations::log(x); });
+    }
+
+
+    /**
+     * Computes the natural logarithm of each of the entries of the vector of
+     * NVectors and stores the results in the given output. The error is below 1
+     * unit in the last place, see MathApproximations::log; zero gives -infinity
+     * and the negative entries give not a number.
+     * 
+     * @param vector The vector of NVectors whose entries are the arguments.
+     * 
+     * @param output The vector of NVectors where the results will be stored; it
+     * can be the given vector of NVectors itself.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void log(
+        VNVectors::VNVectors<T>& vector, VNVectors::VNVectors<T>& output,
+        bool parallel
+    )
+    {
+        map(vector, output, [](T x)
+        {
+            return MathApproximations::log(x);
+        }, parallel);
+    }
+
+
+    /**
+     * Computes the natural logarithm of each of the entries of the vector of
+     * NVectors, in place. The error is below 1 unit in the last place, see
+     * MathApproximations::log; zero gives -infinity and the negative entries
+     * give not a number.
+     * 
+     * @param vector The vector of NVectors whose entries are the arguments.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void logIP(VNVectors::VNVectors<T>& vector, bool parallel)
+    {
+        map(vector, vector, [](T x)
+        {
+            return MathApproximations::log(x);
+        }, parallel);
+    }
+
+
+    /**
+     * Computes the square root of each of the entries of the NVector and stores
+     * the results in the given output. The negative entries give not a number.
+     * 
+     * @param vector The NVector whose entries are the arguments.
+     * 
+     * @param output The NVector where the results will be stored; it can be the
+     * given NVector itself.
+    */
+    template <typename T, typename A>
+    void sqrt(NVector::NVector<T, A>& vector, NVector::NVector<T, A>& output)
+    {
+        map(vector, output, [](T x){ return std::sqrt(x); });
+    }
+
+
+    /**
+     * Computes the square root of each of the entries of the NVector, in place.
+     * The negative entries give not a number.
+     * 
+     * @param vector The NVector whose entries are the arguments.
+    */
+    template <typename T, typename A>
+    void sqrtIP(NVector::NVector<T, A>& vector)
+    {
+        map(vector, vector, [](T x){ return std::sqrt(x); });
+    }
+
+
+    /**
+     * Computes the square root of each of the entries of the vector of NVectors
+     * and stores the results in the given output. The negative entries give not
+     * a number.
+     * 
+     * @param vector The vector of NVectors whose entries are the arguments.
+     * 
+     * @param output The vector of NVectors where the results will be stored; it
+     * can be the given vector of NVectors itself.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void sqrt(
+        VNVectors::VNVectors<T>& vector, VNVectors::VNVectors<T>& output,
+        bool parallel
+    )
+    {
+        map(vector, output, [](T x){ return std::sqrt(x); }, parallel);
+    }
+
+
+    /**
+     * Computes the square root of each of the entries of the vector of
+     * NVectors, in place. The negative entries give not a number.
+     * 
+     * @param vector The vector of NVectors whose entries are the arguments.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void sqrtIP(VNVectors::VNVectors<T>& vector, bool parallel)
+    {
+        map(vector, vector, [](T x){ return std::sqrt(x); }, parallel);
+    }
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Binary Functions
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    /**
+     * Computes if the entries of the NVectors are equal, entry by entry, as 1
+     * if they are and 0 otherwise, and stores the results in the given output.
+     * 
+     * @param vector_1 The NVector whose entries are the first arguments.
+     * 
+     * @param vector_2 The NVector whose entries are the second arguments.
+     * 
+     * @param output The NVector where the results will be stored; it can be any
+     * of the given NVectors.
+    */
+    template <typename T, typename A>
+    void equal(
+        NVector::NVector<T, A>& vector_1, NVector::NVector<T, A>& vector_2,
+        NVector::NVector<T, A>& output
+    )
+    {
+        map(vector_1, vector_2, output, [](T x, T y)
+        {
+            return x == y ? (T) 1 : (T) 0;
+        });
+    }
+
+
+    /**
+     * Computes if the entries of the vectors of NVectors are equal, entry by
+     * entry, as 1 if they are and 0 otherwise, and stores the results in the
+     * given output.
+     * 
+     * @param vector_1 The vector of NVectors whose entries are the first
+     * arguments.
+     * 
+     * @param vector_2 The vector of NVectors whose entries are the second
+     * arguments.
+     * 
+     * @param output The vector of NVectors where the results will be stored; it
+     * can be any of the given vectors of NVectors.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void equal(
+        VNVectors::VNVectors<T>& vector_1, VNVectors::VNVectors<T>& vector_2,
+        VNVectors::VNVectors<T>& output, bool parallel
+    )
+    {
+        map(vector_1, vector_2, output, [](T x, T y)
+        {
+            return x == y ? (T) 1 : (T) 0;
+        }, parallel);
+    }
+
+
+    /**
+     * Computes if the entries of the first one of the NVectors are greater,
+     * entry by entry, as 1 if they are and 0 otherwise, and stores the results
+     * in the given output.
+     * 
+     * @param vector_1 The NVector whose entries are the first arguments.
+     * 
+     * @param vector_2 The NVector whose entries are the second arguments.
+     * 
+     * @param output The NVector where the results will be stored; it can be any
+     * of the given NVectors.
+    */
+    template <typename T, typename A>
+    void greater(
+        NVector::NVector<T, A>& vector_1, NVector::NVector<T, A>& vector_2,
+        NVector::NVector<T, A>& output
+    )
+    {
+        map(vector_1, vector_2, output, [](T x, T y)
+        {
+            return x > y ? (T) 1 : (T) 0;
+        });
+    }
+
+
+    /**
+     * Computes if the entries of the first one of the vectors of NVectors are
+     * greater, entry by entry, as 1 if they are and 0 otherwise, and stores the
+     * results in the given output.
+     * 
+     * @param vector_1 The vector of NVectors whose entries are the first
+     * arguments.
+     * 
+     * @param vector_2 The vector of NVectors whose entries are the second
+     * arguments.
+     * 
+     * @param output The vector of NVectors where the results will be stored; it
+     * can be any of the given vectors of NVectors.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void greater(
+        VNVectors::VNVectors<T>& vector_1, VNVectors::VNVectors<T>& vector_2,
+        VNVectors::VNVectors<T>& output, bool parallel
+    )
+    {
+        map(vector_1, vector_2, output, [](T x, T y)
+        {
+            return x > y ? (T) 1 : (T) 0;
+        }, parallel);
+    }
+
+
+    /**
+     * Computes if the entries of the first one of the NVectors are less, entry
+     * by entry, as 1 if they are and 0 otherwise, and stores the results in the
+     * given output.
+     * 
+     * @param vector_1 The NVector whose entries are the first arguments.
+     * 
+     * @param vector_2 The NVector whose entries are the second arguments.
+     * 
+     * @param output The NVector where the results will be stored; it can be any
+     * of the given NVectors.
+    */
+    template <typename T, typename A>
+    void less(
+        NVector::NVector<T, A>& vector_1, NVector::NVector<T, A>& vector_2,
+        NVector::NVector<T, A>& output
+    )
+    {
+        map(vector_1, vector_2, output, [](T x, T y)
+        {
+            return x < y ? (T) 1 : (T) 0;
+        });
+    }
+
+
+    /**
+     * Computes if the entries of the first one of the vectors of NVectors are
+     * less, entry by entry, as 1 if they are and 0 otherwise, and stores the
+     * results in the given output.
+     * 
+     * @param vector_1 The vector of NVectors whose entries are the first
+     * arguments.
+     * 
+     * @param vector_2 The vector of NVectors whose entries are the second
+     * arguments.
+     * 
+     * @param output The vector of NVectors where the results will be stored; it
+     * can be any of the given vectors of NVectors.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void less(
+        VNVectors::VNVectors<T>& vector_1, VNVectors::VNVectors<T>& vector_2,
+        VNVectors::VNVectors<T>& output, bool parallel
+    )
+    {
+        map(vector_1, vector_2, output, [](T x, T y)
+        {
+            return x < y ? (T) 1 : (T) 0;
+        }, parallel);
+    }
+
+
+    /**
+     * Computes the maximum of the entries of the NVectors, entry by entry, and
+     * stores the results in the given output.
+     * 
+     * @param vector_1 The NVector whose entries are the first arguments.
+     * 
+     * @param vector_2 The NVector whose entries are the second arguments.
+     * 
+     * @param output The NVector where the results will be stored; it can be any
+     * of the given NVectors.
+    */
+    template <typename T, typename A>
+    void maximum(
+        NVector::NVector<T, A>& vector_1, NVector::NVector<T, A>& vector_2,
+        NVector::NVector<T, A>& output
+    )
+    {
+        map(vector_1, vector_2, output, [](T x, T y){ return std::max(x, y); });
+    }
+
+
+    /**
+     * Computes the maximum of the entries of the NVectors, entry by entry, in
+     * place of the first one.
+     * 
+     * @param vector_1 The NVector whose entries are the first arguments.
+     * 
+     * @param vector_2 The NVector whose entries are the second arguments.
+    */
+    template <typename T, typename A>
+    void maximumIP(
+        NVector::NVector<T, A>& vector_1, NVector::NVector<T, A>& vector_2
+    )
+    {
+        map(vector_1, vector_2, vector_1, [](T x, T y)
+        {
+            return std::max(x, y);
+        });
+    }
+
+
+    /**
+     * Computes the maximum of the entries of the vectors of NVectors, entry by
+     * entry, and stores the results in the given output.
+     * 
+     * @param vector_1 The vector of NVectors whose entries are the first
+     * arguments.
+     * 
+     * @param vector_2 The vector of NVectors whose entries are the second
+     * arguments.
+     * 
+     * @param output The vector of NVectors where the results will be stored; it
+     * can be any of the given vectors of NVectors.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void maximum(
+        VNVectors::VNVectors<T>& vector_1, VNVectors::VNVectors<T>& vector_2,
+        VNVectors::VNVectors<T>& output, bool parallel
+    )
+    {
+        map(vector_1, vector_2, output, [](T x, T y)
+        {
+            return std::max(x, y);
+        }, parallel);
+    }
+
+
+    /**
+     * Computes the maximum of the entries of the vectors of NVectors, entry by
+     * entry, in place of the first one.
+     * 
+     * @param vector_1 The vector of NVectors whose entries are the first
+     * arguments.
+     * 
+     * @param vector_2 The vector of NVectors whose entries are the second
+     * arguments.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void maximumIP(
+        VNVectors::VNVectors<T>& vector_1, VNVectors::VNVectors<T>& vector_2,
+        bool parallel
+    )
+    {
+        map(vector_1, vector_2, vector_1, [](T x, T y)
+        {
+            return std::max(x, y);
+        }, parallel);
+    }
+
+
+    /**
+     * Computes the minimum of the entries of the NVectors, entry by entry, and
+     * stores the results in the given output.
+     * 
+     * @param vector_1 The NVector whose entries are the first arguments.
+     * 
+     * @param vector_2 The NVector whose entries are the second arguments.
+     * 
+     * @param output The NVector where the results will be stored; it can be any
+     * of the given NVectors.
+    */
+    template <typename T, typename A>
+    void minimum(
+        NVector::NVector<T, A>& vector_1, NVector::NVector<T, A>& vector_2,
+        NVector::NVector<T, A>& output
+    )
+    {
+        map(vector_1, vector_2, output, [](T x, T y){ return std::min(x, y); });
+    }
+
+
+    /**
+     * Computes the minimum of the entries of the NVectors, entry by entry, in
+     * place of the first one.
+     * 
+     * @param vector_1 The NVector whose entries are the first arguments.
+     * 
+     * @param vector_2 The NVector whose entries are the second arguments.
+    */
+    template <typename T, typename A>
+    void minimumIP(
+        NVector::NVector<T, A>& vector_1, NVector::NVector<T, A>& vector_2
+    )
+    {
+        map(vector_1, vector_2, vector_1, [](T x, T y)
+        {
+            return std::min(x, y);
+        });
+    }
+
+
+    /**
+     * Computes the minimum of the entries of the vectors of NVectors, entry by
+     * entry, and stores the results in the given output.
+     * 
+     * @param vector_1 The vector of NVectors whose entries are the first
+     * arguments.
+     * 
+     * @param vector_2 The vector of NVectors whose entries are the second
+     * arguments.
+     * 
+     * @param output The vector of NVectors where the results will be stored; it
+     * can be any of the given vectors of NVectors.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void minimum(
+        VNVectors::VNVectors<T>& vector_1, VNVectors::VNVectors<T>& vector_2,
+        VNVectors::VNVectors<T>& output, bool parallel
+    )
+    {
+        map(vector_1, vector_2, output, [](T x, T y)
+        {
+            return std::min(x, y);
+        }, parallel);
+    }
+
+
+    /**
+     * Computes the minimum of the entries of the vectors of NVectors, entry by
+     * entry, in place of the first one.
+     * 
+     * @param vector_1 The vector of NVectors whose entries are the first
+     * arguments.
+     * 
+     * @param vector_2 The vector of NVectors whose entries are the second
+     * arguments.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void minimumIP(
+        VNVectors::VNVectors<T>& vector_1, VNVectors::VNVectors<T>& vector_2,
+        bool parallel
+    )
+    {
+        map(vector_1, vector_2, vector_1, [](T x, T y)
+        {
+            return std::min(x, y);
+        }, parallel);
+    }
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Ternary Functions
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    /**
+     * Computes the product of the first two of the NVectors plus the third one,
+     * entry by entry, and stores the results in the given output. The operation
+     * is fused when the hardware has a fast fused multiply-add, see
+     * MathApproximations::multiplyAdd.
+     * 
+     * @param vector_1 The NVector whose entries are the first arguments.
+     * 
+     * @param vector_2 The NVector whose entries are the second arguments.
+     * 
+     * @param vector_3 The NVector whose entries are the third arguments.
+     * 
+     * @param output The NVector where the results will be stored; it can be any
+     * of the given NVectors.
+    */
+    template <typename T, typename A>
+    void fma(
+        NVector::NVector<T, A>& vector_1, NVector::NVector<T, A>& vector_2,
+        NVector::NVector<T, A>& vector_3, NVector::NVector<T, A>& output
+    )
+    {
+        map(vector_1, vector_2, vector_3, output, [](T x, T y, T z)
+        {
+            return MathApproximations::multiplyAdd(x, y, z);
+        });
+    }
+
+
+    /**
+     * Computes the product of the first two of the NVectors plus the third one,
+     * entry by entry, in place of the first one. The operation is fused when
+     * the hardware has a fast fused multiply-add, see
+     * MathApproximations::multiplyAdd.
+     * 
+     * @param vector_1 The NVector whose entries are the first arguments.
+     * 
+     * @param vector_2 The NVector whose entries are the second arguments.
+     * 
+     * @param vector_3 The NVector whose entries are the third arguments.
+    */
+    template <typename T, typename A>
+    void fmaIP(
+        NVector::NVector<T, A>& vector_1, NVector::NVector<T, A>& vector_2,
+        NVector::NVector<T, A>& vector_3
+    )
+    {
+        map(vector_1, vector_2, vector_3, vector_1, [](T x, T y, T z)
+        {
+            return MathApproximations::multiplyAdd(x, y, z);
+        });
+    }
+
+
+    /**
+     * Computes the product of the first two of the vectors of NVectors plus the
+     * third one, entry by entry, and stores the results in the given output.
+     * The operation is fused when the hardware has a fast fused multiply-add,
+     * see MathApproximations::multiplyAdd.
+     * 
+     * @param vector_1 The vector of NVectors whose entries are the first
+     * arguments.
+     * 
+     * @param vector_2 The vector of NVectors whose entries are the second
+     * arguments.
+     * 
+     * @param vector_3 The vector of NVectors whose entries are the third
+     * arguments.
+     * 
+     * @param output The vector of NVectors where the results will be stored; it
+     * can be any of the given vectors of NVectors.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void fma(
+        VNVectors::VNVectors<T>& vector_1, VNVectors::VNVectors<T>& vector_2,
+        VNVectors::VNVectors<T>& vector_3, VNVectors::VNVectors<T>& output,
+        bool parallel
+    )
+    {
+        map(vector_1, vector_2, vector_3, output, [](T x, T y, T z)
+        {
+            return MathApproximations::multiplyAdd(x, y, z);
+        }, parallel);
+    }
+
+
+    /**
+     * Computes the product of the first two of the vectors of NVectors plus the
+     * third one, entry by entry, in place of the first one. The operation is
+     * fused when the hardware has a fast fused multiply-add, see
+     * MathApproximations::multiplyAdd.
+     * 
+     * @param vector_1 The vector of NVectors whose entries are the first
+     * arguments.
+     * 
+     * @param vector_2 The vector of NVectors whose entries are the second
+     * arguments.
+     * 
+     * @param vector_3 The vector of NVectors whose entries are the third
+     * arguments.
+     * 
+     * @param parallel True, if the NVectors must be split among several
+     * threads; False, otherwise.
+    */
+    template <typename T>
+    void fmaIP(
+        VNVectors::VNVectors<T>& vector_1, VNVectors::VNVectors<T>& vector_2,
+        VNVectors::VNVectors<T>& vector_3, bool parallel
+    )
+    {
+        map(vector_1, vector_2, vector_3, vector_1, [](T x, T y, T z)
+        {
+            return MathApproximations::multiplyAdd(x, y, z);
+        }, parallel);
+    }
+
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Integer Functions
+    ////////////////////////////////////////////////////////////////////////////
+
+
+    /**
+     * Computes the sum of the integer NVectors, entry by entry, and stores
+     * the results in the given output; throws instead of wrapping around if
+     * any of the results overflows, before any entry is written.
+     * 
+     * @param vector_1 The NVector whose entries are the first arguments.
+     * 
+     * @param vector_2 The NVector whose entries are the second arguments.
+     * 
+     * @param output The NVector where the results will be stored; it can be any
+     * of the given NVectors.
+     * 
+     * @throw ExceptionsNumerical::Overflow, if any of the results overflows.
+    */
+    template <typename T, typename A>
+    void addChecked(
+        NVector::NVector<T, A>& vector_1, NVector::NVector<T, A>& vector_2,
+        NVector::NVector<T, A>& output
+    )
+    {
+        mapChecked(vector_1, vector_2, output, [](T x, T y, T& result)
+        {
+            return TypesInteger::overflowAdd(x, y, result);
+        });
+    }
+
+
+    /**
+     * Computes the sum of the integer NVectors, entry by entry, in place
+     * of the first one; throws instead of wrapping around if any of the
+     * results overflows, before any entry is written.
+     * 
+     * @param vector_1 The NVector whose entries are the first arguments.
+     * 
+     * @param vector_2 The NVector whose entries are the second arguments.
+     * 
+     * @throw ExceptionsNumerical::Overflow, if any of the results overflows.
+    */
+    template <typename T, typename A>
+    void addCheckedIP(
+        NVector::NVector<T, A>& vector_1, NVector::NVector<T, A>& vector_2
+    )
+    {
+        addChecked(vector_1, vector_2, vector_1);
+    }
+
+
+    /**
+     * Computes the sum of the integer NVectors, entry by entry, clamped
+     * to the range of the type, and stores the results in the given output.
+     * 
+     * @param vector_1 The NVector whose entries are the first arguments.
+     * 
+     * @param vector_2 The NVector whose entries are the second arguments.
+     * 
+     * @param output The NVector where the results will be stored; it can be any
+     * of the given NVectors.
+    */
+    template <typename T, typename A>
+    void addSaturate(
+        NVector::NVector<T, A>& vector_1, NVector::NVector<T, A>& vector_2,
+        NVector::NVector<T, A>& output
+    )
+    {
+        map(vector_1, vector_2, output, [](T x, T y)
+        {
+            return TypesInteger::saturateAdd(x, y);
+        });
+    }
+
+
+    /**
+     * Computes the sum of the integer NVectors, entry by entry, clamped
+     * to the range of the type, in place of the first one.
+     * 
+     * @param vector_1 The NVector whose entries are the first arguments.
+     * 
+     * @param vector_2 The NVector whose entries are the second arguments.
+    */
+    template <typename T, typename A>
+    void addSaturateIP(
+        NVector::NVector<T, A>& vector_1, NVector::NVector<T, A>& vector_2
+    )
+    {
+        addSaturate(vector_1, vector_2, vector_1);
+    }
+
+
+    /**
+     * Computes the product of the integer NVectors, entry by entry, and stores
+     * the results in the given output; throws instead of wrapping around if
+     * any of the results overflows, before any entry is written.
+     * 
+     * @param vector_1 The NVector whose entries are the first arguments.
+     * 
+     * @param vector_2 The NVector whose entries are the second arguments.
+     * 
+     * @param output The NVector where the results will be stored; it can be any
+     * of the given NVectors.
+     * 
+     * @throw ExceptionsNumerical::Overflow, if any of the results overflows.
+    */
+    template <typename T, typename A>
+    void multiplyChecked(
+        NVector::NVector<T, A>& vector_1, NVector::NVector<T, A>& vector_2,
+        NVector::NVector<T, A>& output
+    )
+    {
+        mapChecked(vector_1, vector_2, output, [](T x, T y, T& result)
+        {
+            return TypesInteger::overflowMultiply(x, y, result);
+        });
+    }
+
+
+    /**
+     * Computes the product of the integer NVectors, entry by entry, in place
+     * of the first one; throws instead of wrapping around if any of the
+     * results overflows, before any entry is written.
+     * 
+     * @param vector_1 The NVector whose entries are the first arguments.
+     * 
+     * @param vector_2 The NVector whose entries are the second arguments.
+     * 
+     * @throw ExceptionsNumerical::Overflow, if any of the results overflows.
+    */
+    template <typename T, typename A>
+    void multiplyCheckedIP(
+        NVector::NVector<T, A>& vector_1, NVector::NVector<T, A>& vector_2
+    )
+    {
+        multiplyChecked(vector_1, vector_2, vector_1);
+    }
+
+
+    /**
+     * Computes the product of the integer NVectors, entry by entry, clamped
+     * to the range of the type, and stores the results in the given output.
+     * 
+     * @param vector_1 The NVector whose entries are the first arguments.
+     * 
+     * @param vector_2 The NVector whose entries are the second arguments.
+     * 
+     * @param output The NVector where the results will be stored; it can be any
+     * of the given NVectors.
+    */
+    template <typename T, typename A>
+    void multiplySaturate(
+        NVector::NVector<T, A>& vector_1, NVector::NVector<T, A>& vector_2,
+        NVector::NVector<T, A>& output
+    )
+    {
+        map(vector_1, vector_2, output, [](T x, T y)
+        {
+            return TypesInteger::saturateMultiply(x, y);
+        });
+    }
+
+
+    /**
+     * Computes the product of the integer NVectors, entry by entry, clamped
+     * to the range of the type, in place of the first one.
+     * 
+     * @param vector_1 The NVector whose entries are the first arguments.
+     * 
+     * @param vector_2 The NVector whose entries are the second arguments.
+    */
+    template <typename T, typename A>
+    void multiplySaturateIP(
+        NVector::NVector<T, A>& vector_1, NVector::NVector<T, A>& vector_2
+    )
+    {
+        multiplySaturate(vector_1, vector_2, vector_1);
+    }
+
+
+    /**
+     * Computes the difference of the integer NVectors, entry by entry, and
+     * stores the results in the given output; throws instead of wrapping
+     * around if any of the results overflows, before any entry is written.
+     * 
+     * @param vector_1 The NVector whose entries are the first arguments.
+     * 
+     * @param vector_2 The NVector whose entries are the second arguments.
+     * 
+     * @param output The NVector where the results will be stored; it can be any
+     * of the given NVectors.
+     * 
+     * @throw ExceptionsNumerical::Overflow, if any of the results overflows.
+    */
+    template <typename T, typename A>
+    void subtractChecked(
+        NVector::NVector<T, A>& vector_1, NVector::NVector<T, A>& vector_2,
+        NVector::NVector<T, A>& output
+    )
+    {
+        mapChecked(vector_1, vector_2, output, [](T x, T y, T& result)
+        {
+            return TypesInteger::overflowSubtract(x, y, result);
+        });
+    }
+
+
+    /**
+     * Computes the difference of the integer NVectors, entry by entry, in place
+     * of the first one; throws instead of wrapping around if any of the
+     * results overflows, before any entry is written.
+     * 
+     * @param vector_1 The NVector whose entries are the first arguments.
+     * 
+     * @param vector_2 The NVector whose entries are the second arguments.
+     * 
+     * @throw ExceptionsNumerical::Overflow, if any of the results overflows.
+    */
+    template <typename T, typename A>
+    void subtractCheckedIP(
+        NVector::NVector<T, A>& vector_1, NVector::NVector<T, A>& vector_2
+    )
+    {
+        subtractChecked(vector_1, vector_2, vector_1);
+    }
+
+
+    /**
+     * Computes the difference of the integer NVectors, entry by entry, clamped
+     * to the range of the type, and stores the results in the given output.
+     * 
+     * @param vector_1 The NVector whose entries are the first arguments.
+     * 
+     * @param vector_2 The NVector whose entries are the second arguments.
+     * 
+     * @param output The NVector where the results will be stored; it can be any
+     * of the given NVectors.
+    */
+    template <typename T, typename A>
+    void subtractSaturate(
+        NVector::NVector<T, A>& vector_1, NVector::NVector<T, A>& vector_2,
+        NVector::NVector<T, A>& output
+    )
+    {
+        map(vector_1, vector_2, output, [](T x, T y)
+        {
+            return TypesInteger::saturateSubtract(x, y);
+        });
+    }
+
+
+    /**
+     * Computes the difference of the integer NVectors, entry by entry, clamped
+     * to the range of the type, in place of the first one.
+     * 
+     * @param vector_1 The NVector whose entries are the first arguments.
+     * 
+     * @param vector_2 The NVector whose entries are the second arguments.
+    */
+    template <typename T, typename A>
+    void subtractSaturateIP(
+        NVector::NVector<T, A>& vector_1, NVector::NVector<T, A>& vector_2
+    )
+    {
+        subtractSaturate(vector_1, vector_2, vector_1);
+    }
+}
@@ -0,0 +1,1356 @@
+/*
+    File that contains the strided views of the vectors and their functions.
+*/
+#pragma once
+
+
+//##############################################################################
+// Imports
+//##############################################################################
+
+
+// General.
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+
+// User defined.
+#include "./Headers/Validation/validationGeneral.hpp"
+#include "./Headers/Validation/validationNumerical.hpp"
+#include "./nvectors.hpp"
+#include "./vnvectors.hpp"
+
+
+//##############################################################################
+// Namespaces
+//##############################################################################
+
+
+namespace Views
+{
+    //##########################################################################
+    // Classes
+    //##########################################################################
+
+
+    /**
+     * Class that selects the indexes start, start + step, start + 2 * step,
+     * ..., up to, but not including, stop; as the slices of numpy, without
+     * negative indexes.
+    */
+    class Slice
+    {
+        public:
+        //######################################################################
+        // Constructors
+        //######################################################################
+
+
+        /**
+         * Creates a new slice.
+         * 
+         * @param start The first selected index.
+         * 
+         * @param stop The index after the last selected index; it is clamped
+         * to the length of the sliced range.
+         * 
+         * @param step The distance between the selected indexes; it must be
+         * greater than zero.
+        */
+        Slice(size_t start, size_t stop, size_t step) :
+        first{start},
+        last{stop},
+        stride{step}
+        {
+            // Validate the quantities.
+            ValidationNumerical::rangeGreater<size_t>(0, stride, true);
+        }
+
+
+        //######################################################################
+        // Functions
+        //######################################################################
+
+
+        /**
+         * Returns the number of indexes selected from a range of the given
+         * length.
+         * 
+         * @param length The length of the sliced range.
+         * 
+         * @return The number of selected indexes.
+        */
+        size_t count(size_t length) const
+        {
+            // Auxiliary variables.
+            size_t stop = std::min(last, length);
+
+            return first < stop ? (stop - first + stride - 1) / stride : 0;
+        }
+
+
+        /**
+         * Returns the first selected index.
+         * 
+         * @return The first selected index.
+        */
+        size_t start() const
+        {
+            return first;
+        }
+
+
+        /**
+         * Returns the distance between the selected indexes.
+         * 
+         * @return The distance between the selected indexes.
+        */
+        size_t step() const
+        {
+            return stride;
+        }
+
+
+        private:
+        //######################################################################
+        // Variables
+        //######################################################################
+
+
+        // The first selected index.
+        size_t first{0};
+
+
+        // The index after the last selected index.
+        size_t last{0};
+
+
+        // The distance between the selected indexes.
+        size_t stride{1};
+    };
+
+
+    /**
+     * Class that views the entries of an NVector, or of any contiguous
+     * storage, with a stride; the entries are not copied, such that the
+     * changes made through the view are made in the viewed storage. The view
+     * is valid as long as the viewed storage is. The mutating operations of a
+     * view of an NVector invalidate its cached norm, if any. The products are
+     * accumulated like the ones of the NVectors, see TypesInteger::Accumulator.
+    */
+    template <
+        typename T, typename A = typename TypesInteger::Accumulator<T>::type
+    >
+    class NVectorView
+    {
+        public:
+        //######################################################################
+        // Operator Overloads
+        //######################################################################
+
+
+        ////////////////////////////////////////////////////////////////////////
+        // Arithmetic
+        ////////////////////////////////////////////////////////////////////////
+
+
+        /**
+         * Addition operator overload. To add a scalar quantity to the viewed
+         * entries.
+         * 
+         * @param view The view to be added.
+         * 
+         * @param value The value to be added.
+         * 
+         * @return A new NVector with the value added to each viewed entry.
+        */
+        friend NVector::NVector<T, A> operator + (
+            NVectorView<T, A> view, T value
+        )
+        {
+            // Auxiliary variables.
+            NVector::NVector<T, A> vector = view.materialize();
+
+            vector += value;
+
+            return vector;
+        }
+
+
+        /**
+         * Division operator overload. To divide the viewed entries by a scalar
+         * quantity.
+         * 
+         * @param view The view to be divided.
+         * 
+         * @param value The value by which each entry will be divided.
+         * 
+         * @return A new NVector with each viewed entry divided by the value.
+        */
+        friend NVector::NVector<T, A> operator / (
+            NVectorView<T, A> view, T value
+        )
+        {
+            // Auxiliary variables.
+            NVector::NVector<T, A> vector = view.materialize();
+
+            vector /= value;
+
+            return vector;
+        }
+
+
+        /**
+         * Multiplication operator overload. To multiply the viewed entries by
+         * a scalar quantity.
+         * 
+         * @param view The view to be multiplied.
+         * 
+         * @param value The value by which each entry will be multiplied.
+         * 
+         * @return A new NVector with each viewed entry multiplied by the value.
+        */
+        friend NVector::NVector<T, A> operator * (
+            NVectorView<T, A> view, T value
+        )
+        {
+            // Auxiliary variables.
+            NVector::NVector<T, A> vector = view.materialize();
+
+            vector *= value;
+
+            return vector;
+        }
+
+
+        /**
+         * Subtraction operator overload. To subtract a scalar quantity from
+         * the viewed entries.
+         * 
+         * @param view The view from which the value will be subtracted.
+         * 
+         * @param value The value to be subtracted.
+         * 
+         * @return A new NVector with the value subtracted from each viewed
+         * entry.
+        */
+        friend NVector::NVector<T, A> operator - (
+            NVectorView<T, A> view, T value
+        )
+        {
+            // Auxiliary variables.
+            NVector::NVector<T, A> vector = view.materialize();
+
+            vector -= value;
+
+            return vector;
+        }
+
+
+        ////////////////////////////////////////////////////////////////////////
+        // Compound Assignment
+        ////////////////////////////////////////////////////////////////////////
+
+
+        /**
+         * Addition assignment operator. To add a scalar quantity to each of the
+         * viewed entries.
+         * 
+         * @param value The value to be added.
+         * 
+         * @return A reference to the view itself.
+        */
+        NVectorView<T, A>& operator += (T value)
+        {
+            invalidate();
+
+            for(size_t i = 0; i < dimension; ++i) entries[i * stride] += value;
+
+            return *this;
+        }
+
+
+        /**
+         * Addition assignment operator. To add the entries of another view to
+         * the viewed entries, entry by entry.
+         * 
+         * @param view The view to be added; it must have the same dimension.
+         * 
+         * @return A reference to the view itself.
+        */
+        NVectorView<T, A>& operator += (const NVectorView<T, A>& view)
+        {
+            // Validate the dimensionality of the view to be added.
+            ValidationGeneral::validateDimensions(
+                dimension, view.dimension, true
+            );
+
+            invalidate();
+
+            for(size_t i = 0; i < dimension; ++i)
+                entries[i * stride] += view.entries[i * view.stride];
+
+            return *this;
+        }
+
+
+        /**
+         * Addition assignment operator. To add the entries of an NVector to
+         * the viewed entries, entry by entry.
+         * 
+         * @param vector The vector to be added; it must have the same
+         * dimension.
+         * 
+         * @return A reference to the view itself.
+        */
+        NVectorView<T, A>& operator += (const NVector::NVector<T, A>& vector)
+        {
+            return *this += viewOf(vector);
+        }
+
+
+        /**
+         * Division assignment operator. To divide each of the viewed entries
+         * by a scalar quantity.
+         * 
+         * @param value The value by which each entry will be divided.
+         * 
+         * @return A reference to the view itself.
+        */
+        NVectorView<T, A>& operator /= (T value)
+        {
+            // Validate finite division.
+            ValidationGeneral::isNotDivingByZero((A) value, true);
+
+            invalidate();
+
+            for(size_t i = 0; i < dimension; ++i)
+                entries[i * stride] = (T) ((A) entries[i * stride] / (A) value);
+
+            return *this;
+        }
+
+
+        /**
+         * Division assignment operator. To divide the viewed entries by the
+         * entries of another view, entry by entry; nothing is written if any
+         * of the divisors is zero.
+         * 
+         * @param view The view by which the entries will be divided; it must
+         * have the same dimension.
+         * 
+         * @return A reference to the view itself.
+        */
+        NVectorView<T, A>& operator /= (const NVectorView<T, A>& view)
+        {
+            // Validate the dimensionality of the view.
+            ValidationGeneral::validateDimensions(
+                dimension, view.dimension, true
+            );
+
+            // Validate finite division, before any entry is written.
+            for(size_t i = 0; i < dimension; ++i)
+                ValidationGeneral::isNotDivingByZero(
+                    (A) view.entries[i * view.stride], true
+                );
+
+            invalidate();
+
+            for(size_t i = 0; i < dimension; ++i)
+                entries[i * stride] = (T) (
+                    (A) entries[i * stride] / (A) view.entries[i * view.stride]
+                );
+
+            return *this;
+        }
+
+
+        /**
+         * Division assignment operator. To divide the viewed entries by the
+         * entries of an NVector, entry by entry; nothing is written if any of
+         * the divisors is zero.
+         * 
+         * @param vector The vector by which the entries will be divided; it
+         * must have the same dimension.
+         * 
+         * @return A reference to the view itself.
+        */
+        NVectorView<T, A>& operator /= (const NVector::NVector<T, A>& vector)
+        {
+            return *this /= viewOf(vector);
+        }
+
+
+        /**
+         * Multiplication assignment operator. To multiply each of the viewed
+         * entries by a scalar quantity.
+         * 
+         * @param value The value by which each entry will be multiplied.
+         * 
+         * @return A reference to the view itself.
+        */
+        NVectorView<T, A>& operator *= (T value)
+        {
+            invalidate();
+
+            for(size_t i = 0; i < dimension; ++i) entries[i * stride] *= value;
+
+            return *this;
+        }
+
+
+        /**
+         * Multiplication assignment operator. To multiply the viewed entries
+         * by the entries of another view, entry by entry.
+         * 
+         * @param view The view by which the entries will be multiplied; it
+         * must have the same dimension.
+         * 
+         * @return A reference to the view itself.
+        */
+        NVectorView<T, A>& operator *= (const NVectorView<T, A>& view)
+        {
+            // Validate the dimensionality of the view.
+            ValidationGeneral::validateDimensions(
+                dimension, view.dimension, true
+            );
+
+            invalidate();
+
+            for(size_t i = 0; i < dimension; ++i)
+                entries[i * stride] *= view.entries[i * view.stride];
+
+            return *this;
+        }
+
+
+        /**
+         * Multiplication assignment operator. To multiply the viewed entries
+         * by the entries of an NVector, entry by entry.
+         * 
+         * @param vector The vector by which the entries will be multiplied; it
+         * must have the same dimension.
+         * 
+         * @return A reference to the view itself.
+        */
+        NVectorView<T, A>& operator *= (const NVector::NVector<T, A>& vector)
+        {
+            return *this *= viewOf(vector);
+        }
+
+
+        /**
+         * Subtraction assignment operator. To subtract a scalar quantity from
+         * each of the viewed entries.
+         * 
+         * @param value The value to be subtracted.
+         * 
+         * @return A reference to the view itself.
+        */
+        NVectorView<T, A>& operator -= (T value)
+        {
+            invalidate();
+
+            for(size_t i = 0; i < dimension; ++i) entries[i * stride] -= value;
+
+            return *this;
+        }
+
+
+        /**
+         * Subtraction assignment operator. To subtract the entries of another
+         * view from the viewed entries, entry by entry.
+         * 
+         * @param view The view to be subtracted; it must have the same
+         * dimension.
+         * 
+         * @return A reference to the view itself.
+        */
+        NVectorView<T, A>& operator -= (const NVectorView<T, A>& view)
+        {
+            // Validate the dimensionality of the view to be subtracted.
+            ValidationGeneral::validateDimensions(
+                dimension, view.dimension, true
+            );
+
+            invalidate();
+
+            for(size_t i = 0; i < dimension; ++i)
+                entries[i * stride] -= view.entries[i * view.stride];
+
+            return *this;
+        }
+
+
+        /**
+         * Subtraction assignment operator. To subtract the entries of an
+         * NVector from the viewed entries, entry by entry.
+         * 
+         * @param vector The vector to be subtracted; it must have the same
+         * dimension.
+         * 
+         * @return A reference to the view itself.
+        */
+        NVectorView<T, A>& operator -= (const NVector::NVector<T, A>& vector)
+        {
+            return *this -= viewOf(vector);
+        }
+
+
+        ////////////////////////////////////////////////////////////////////////
+        // Other Functionality
+        ////////////////////////////////////////////////////////////////////////
+
+
+        /**
+         * Outstream string to be print the view. To be able to view the
+         * viewed entries.
+         * 
+         * @param out A reference to the ostream operator.
+         * 
+         * @param view A copy of the view to be printed.
+        */
+        friend std::ostream& operator << (
+            std::ostream& out, NVectorView<T, A> view
+        )
+        {
+            // Open the view.
+            out << "(";
+
+            // Print the content.
+            for(size_t i = 0; i < view.dimension; ++i)
+            {
+                out << std::setprecision(7)
+                    << (long double) view.entries[i * view.stride];
+                if(i + 1 < view.dimension) out << ", ";
+            }
+
+            // Close the view.
+            out << ")";
+
+            return out;
+        }
+
+
+        /**
+         * Index operator overload. To be able to access the viewed entries.
+         * The cached norm of the viewed NVector, if any, is invalidated, since
+         * the entry can be written through the returned reference.
+         * 
+         * @param index The requested index to be accessed.
+        */
+        T& operator [] (size_t index)
+        {
+            // Auxiliary variables.
+            size_t lower{0}, upper{dimension - 1};
+
+            // Validate the index is in range.
+            if(dimension == 0)
+                throw ExceptionsGeneral::IndexOutOfRange(lower, lower, index);
+            ValidationGeneral::validateInRange(index, lower, upper, true);
+
+            invalidate();
+
+            return entries[index * stride];
+        }
+
+
+        /**
+         * Index operator overload, for constant views; the entries can not be
+         * written, so the cached norm of the viewed NVector is kept.
+         * 
+         * @param index The requested index to be accessed.
+        */
+        const T& operator [] (size_t index) const
+        {
+            // Auxiliary variables.
+            size_t lower{0}, upper{dimension - 1};
+
+            // Validate the index is in range.
+            if(dimension == 0)
+                throw ExceptionsGeneral::IndexOutOfRange(lower, lower, index);
+            ValidationGeneral::validateInRange(index, lower, upper, true);
+
+            return entries[index * stride];
+        }
+
+
+        //######################################################################
+        // Constructors
+        //######################################################################
+
+
+        /**
+         * Creates a view of the entries of the given NVector that are
+         * selected by the given slice.
+         * 
+         * @param vector The NVector to be viewed.
+         * 
+         * @param slice The entries to be viewed.
+        */
+        NVectorView(NVector::NVector<T, A>& vector, Slice slice) :
+        NVectorView(
+            const_cast<T*>(std::as_const(vector).data()) +
+            std::min(slice.start(), vector.size()),
+            slice.count(vector.size()), slice.step(), &vector
+        )
+        {}
+
+
+        /**
+         * Creates a view of the given entries.
+         * 
+         * @param first A pointer to the first viewed entry.
+         * 
+         * @param dimensions The number of viewed entries.
+         * 
+         * @param step The distance between the viewed entries.
+         * 
+         * @param vector The NVector that owns the entries, whose cached norm
+         * is invalidated by the mutating operations; none, if the entries are
+         * not owned by an NVector.
+        */
+        NVectorView(
+            T* first, size_t dimensions, size_t step,
+            NVector::NVector<T, A>* vector = nullptr
+        ) :
+        entries{first},
+        dimension{dimensions},
+        stride{step},
+        owner{vector}
+        {}
+
+
+        //######################################################################
+        // Functions
+        //######################################################################
+
+
+        /**
+         * Returns the dot product of the view with another view; the products
+         * are accumulated with the accumulation type. The integer and fixed
+         * point products are exact and checked, as the ones of the NVectors.
+         * 
+         * @param view The view with which the dot product will be taken.
+         * 
+         * @return The dot product of the view itself with the given view.
+         * 
+         * @throw ExceptionsNumerical::Overflow, if the integer accumulation
+         * overflows.
+        */
+        A dotProduct(const NVectorView<T, A>& view) const
+        {
+            // Validate the sizes are the same.
+            ValidationGeneral::validateDimensions(
+                dimension, view.dimension, true
+            );
+
+            // The kernel of the NVectors widens and checks the integer and
+            // fixed point products, on contiguous copies of the entries.
+            if constexpr(!std::is_floating_point<A>::value)
+                return materialize().dotProduct(view.materialize());
+            else
+            {
+                // Auxiliary variables.
+                A accum = (A) 0;
+
+                for(size_t i = 0; i < dimension; ++i)
+                    accum += (A) entries[i * stride] *
+                        (A) view.entries[i * view.stride];
+
+                return accum;
+            }
+        }
+
+
+        /**
+         * Returns the dot product of the view with an NVector; the products
+         * are accumulated with the accumulation type. The integer and fixed
+         * point products are exact and checked, as the ones of the NVectors.
+         * 
+         * @param vector The vector with which the dot product will be taken.
+         * 
+         * @return The dot product of the view itself with the given vector.
+         * 
+         * @throw ExceptionsNumerical::Overflow, if the integer accumulation
+         * overflows.
+        */
+        A dotProduct(const NVector::NVector<T, A>& vector) const
+        {
+            // The NVector is not copied for its kernel.
+            if constexpr(!std::is_floating_point<A>::value)
+                return materialize().dotProduct(vector);
+            else
+                return dotProduct(viewOf(vector));
+        }
+
+
+        /**
+         * Returns a contiguous copy of the viewed entries.
+         * 
+         * @return A new NVector with the viewed entries.
+        */
+        NVector::NVector<T, A> materialize() const
+        {
+            // Auxiliary variables.
+            NVector::NVector<T, A> vector = NVector::NVector<T, A>(
+                dimension, NVector::uninitialized
+            );
+            T* output = vector.data();
+
+            for(size_t i = 0; i < dimension; ++i)
+                output[i] = entries[i * stride];
+
+            return vector;
+        }
+
+
+        /**
+         * Returns the L2 norm of the viewed entries.
+         * 
+         * @return The L2 norm of the viewed entries.
+        */
+        template <typename F = A>
+        A norm() const
+        {
+            // Checked on use, such that the class can be instantiated with
+            // any type.
+            static_assert(
+                !std::is_integral<F>::value && !TypesInteger::IsFixed<F>::value,
+                "The norm needs a floating point accumulation type, use "
+                "normSquared for the integer and fixed point views."
+            );
+
+            return std::sqrt(normSquared());
+        }
+
+
+        /**
+         * Returns the L2 norm, squared, of the viewed entries.
+         * 
+         * @return The L2 norm, squared, of the viewed entries.
+        */
+        A normSquared() const
+        {
+            return dotProduct(*this);
+        }
+
+
+        /**
+         * Returns the number of viewed entries.
+         * 
+         * @return The number of viewed entries.
+        */
+        size_t size() const
+        {
+            return dimension;
+        }
+
+
+        /**
+         * Returns a view of the entries of the view that are selected by the
+         * given slice; the strides are combined, nothing is copied.
+         * 
+         * @param selection The entries of the view to be viewed.
+         * 
+         * @return The view of the selected entries.
+        */
+        NVectorView<T, A> slice(Slice selection)
+        {
+            return NVectorView<T, A>(
+                entries + std::min(selection.start(), dimension) * stride,
+                selection.count(dimension), selection.step() * stride, owner
+            );
+        }
+
+
+        private:
+        //######################################################################
+        // Functions
+        //######################################################################
+
+
+        /**
+         * Invalidates the cached norm of the viewed NVector, if any, before
+         * the viewed entries are written.
+        */
+        void invalidate()
+        {
+            if(owner != nullptr) owner->invalidateNorm();
+        }
+
+
+        /**
+         * Returns a view of all the entries of the given NVector, that is
+         * only read, such that its cached norm is kept.
+         * 
+         * @param vector The NVector to be viewed.
+         * 
+         * @return The view of the entries of the NVector.
+        */
+        static NVectorView<T, A> viewOf(const NVector::NVector<T, A>& vector)
+        {
+            return NVectorView<T, A>(
+                const_cast<T*>(vector.data()), vector.size(), 1
+            );
+        }
+
+
+        //######################################################################
+        // Variables
+        //######################################################################
+
+
+        // A pointer to the first viewed entry.
+        T* entries{nullptr};
+
+
+        // The number of viewed entries.
+        size_t dimension{0};
+
+
+        // The distance between the viewed entries.
+        size_t stride{1};
+
+
+        // The NVector that owns the viewed entries, if any.
+        NVector::NVector<T, A>* owner{nullptr};
+    };
+
+
+    /**
+     * Class that views a block of a vector of NVectors, selecting the
+     * NVectors and the entries of each NVector with slices; the entries are
+     * not copied, such that the changes made through the view are made in the
+     * viewed vector of NVectors. The view only stores where the first viewed
+     * NVector is and the distance between the viewed NVectors, such that
+     * views and slices are built in constant time. The view is valid as long
+     * as the viewed vector of NVectors is not resized.
+    */
+    template <typename T>
+    class VNVectorsView
+    {
+        public:
+        //######################################################################
+        // Operator Overloads
+        //######################################################################
+
+
+        ////////////////////////////////////////////////////////////////////////
+        // Compound Assignment
+        ////////////////////////////////////////////////////////////////////////
+
+
+        /**
+         * Addition assignment operator. To add a scalar quantity to each of the
+         * viewed entries.
+         * 
+         * @param value The value to be added.
+         * 
+         * @return A reference to the view itself.
+        */
+        VNVectorsView<T>& operator += (T value)
+        {
+            for(size_t i = 0; i < vsize; ++i) (*this)[i] += value;
+
+            return *this;
+        }
+
+
+        /**
+         * Addition assignment operator. To add the given view to each of the
+         * viewed NVectors, entry by entry.
+         * 
+         * @param view The view to be added; it must have the dimension of the
+         * viewed NVectors.
+         * 
+         * @return A reference to the view itself.
+        */
+        VNVectorsView<T>& operator += (const NVectorView<T>& view)
+        {
+            for(size_t i = 0; i < vsize; ++i) (*this)[i] += view;
+
+            return *this;
+        }
+
+
+        /**
+         * Addition assignment operator. To add the given NVector to each of
+         * the viewed NVectors, entry by entry.
+         * 
+         * @param vector The vector to be added; it must have the dimension of
+         * the viewed NVectors.
+         * 
+         * @return A reference to the view itself.
+        */
+        VNVectorsView<T>& operator += (const NVector::NVector<T>& vector)
+        {
+            for(size_t i = 0; i < vsize; ++i) (*this)[i] += vector;
+
+            return *this;
+        }
+
+
+        /**
+         * Addition assignment operator. To add the NVectors of another view
+         * to the viewed NVectors, entry by entry.
+         * 
+         * @param view The view to be added; it must have the same number of
+         * NVectors and of entries.
+         * 
+         * @return A reference to the view itself.
+        */
+        VNVectorsView<T>& operator += (const VNVectorsView<T>& view)
+        {
+            // Validate the number of NVectors.
+            ValidationGeneral::validateDimensions(vsize, view.vsize, true);
+
+            for(size_t i = 0; i < vsize; ++i) (*this)[i] += view.row(i);
+
+            return *this;
+        }
+
+
+        /**
+         * Division assignment operator. To divide each of the viewed entries
+         * by a scalar quantity.
+         * 
+         * @param value The value by which each entry will be divided.
+         * 
+         * @return A reference to the view itself.
+        */
+        VNVectorsView<T>& operator /= (T value)
+        {
+            // Validate finite division.
+            ValidationGeneral::isNotDivingByZero(value, true);
+
+            for(size_t i = 0; i < vsize; ++i) (*this)[i] /= value;
+
+            return *this;
+        }
+
+
+        /**
+         * Division assignment operator. To divide each of the viewed NVectors
+         * by the given view, entry by entry; nothing is written if any of the
+         * divisors is zero.
+         * 
+         * @param view The view by which the NVectors will be divided; it must
+         * have the dimension of the viewed NVectors.
+         * 
+         * @return A reference to the view itself.
+        */
+        VNVectorsView<T>& operator /= (const NVectorView<T>& view)
+        {
+            // Validate the dimensions and the divisors once, for all rows.
+            ValidationGeneral::validateDimensions(
+                dimension, view.size(), true
+            );
+            for(size_t j = 0; j < dimension; ++j)
+                ValidationGeneral::isNotDivingByZero(view[j], true);
+
+            for(size_t i = 0; i < vsize; ++i) (*this)[i] /= view;
+
+            return *this;
+        }
+
+
+        /**
+         * Division assignment operator. To divide each of the viewed NVectors
+         * by the given NVector, entry by entry; nothing is written if any of
+         * the divisors is zero.
+         * 
+         * @param vector The vector by which the NVectors will be divided; it
+         * must have the dimension of the viewed NVectors.
+         * 
+         * @return A reference to the view itself.
+        */
+        VNVectorsView<T>& operator /= (const NVector::NVector<T>& vector)
+        {
+            return *this /= NVectorView<T>(
+                const_cast<T*>(vector.data()), vector.size(), 1
+            );
+        }
+
+
+        /**
+         * Division assignment operator. To divide the viewed NVectors by the
+         * NVectors of another view, entry by entry; nothing is written if any
+         * of the divisors is zero.
+         * 
+         * @param view The view by which the NVectors will be divided; it must
+         * have the same number of NVectors and of entries.
+         * 
+         * @return A reference to the view itself.
+        */
+        VNVectorsView<T>& operator /= (const VNVectorsView<T>& view)
+        {
+            // Validate the sizes and the divisors, before any entry is written.
+            ValidationGeneral::validateDimensions(vsize, view.vsize, true);
+            ValidationGeneral::validateDimensions(
+                dimension, view.dimension, true
+            );
+            for(size_t i = 0; i < vsize; ++i)
+                for(size_t j = 0; j < dimension; ++j)
+                    ValidationGeneral::isNotDivingByZero(
+                        view.row(i)[j], true
+                    );
+
+            for(size_t i = 0; i < vsize; ++i) (*this)[i] /= view.row(i);
+
+            return *this;
+        }
+
+
+        /**
+         * Multiplication assignment operator. To multiply each of the viewed
+         * entries by a scalar quantity.
+         * 
+         * @param value The value by which each entry will be multiplied.
+         * 
+         * @return A reference to the view itself.
+        */
+        VNVectorsView<T>& operator *= (T value)
+        {
+            for(size_t i = 0; i < vsize; ++i) (*this)[i] *= value;
+
+            return *this;
+        }
+
+
+        /**
+         * Multiplication assignment operator. To multiply each of the viewed
+         * NVectors by the given view, entry by entry.
+         * 
+         * @param view The view by which the NVectors will be multiplied; it
+         * must have the dimension of the viewed NVectors.
+         * 
+         * @return A reference to the view itself.
+        */
+        VNVectorsView<T>& operator *= (const NVectorView<T>& view)
+        {
+            for(size_t i = 0; i < vsize; ++i) (*this)[i] *= view;
+
+            return *this;
+        }
+
+
+        /**
+         * Multiplication assignment operator. To multiply each of the viewed
+         * NVectors by the given NVector, entry by entry.
+         * 
+         * @param vector The vector by which the NVectors will be multiplied;
+         * it must have the dimension of the viewed NVectors.
+         * 
+         * @return A reference to the view itself.
+        */
+        VNVectorsView<T>& operator *= (const NVector::NVector<T>& vector)
+        {
+            for(size_t i = 0; i < vsize; ++i) (*this)[i] *= vector;
+
+            return *this;
+        }
+
+
+        /**
+         * Multiplication assignment operator. To multiply the viewed NVectors
+         * by the NVectors of another view, entry by entry.
+         * 
+         * @param view The view by which the NVectors will be multiplied; it
+         * must have the same number of NVectors and of entries.
+         * 
+         * @return A reference to the view itself.
+        */
+        VNVectorsView<T>& operator *= (const VNVectorsView<T>& view)
+        {
+            // Validate the number of NVectors.
+            ValidationGeneral::validateDimensions(vsize, view.vsize, true);
+
+            for(size_t i = 0; i < vsize; ++i) (*this)[i] *= view.row(i);
+
+            return *this;
+        }
+
+
+        /**
+         * Subtraction assignment operator. To subtract a scalar quantity from
+         * each of the viewed entries.
+         * 
+         * @param value The value to be subtracted.
+         * 
+         * @return A reference to the view itself.
+        */
+        VNVectorsView<T>& operator -= (T value)
+        {
+            for(size_t i = 0; i < vsize; ++i) (*this)[i] -= value;
+
+            return *this;
+        }
+
+
+        /**
+         * Subtraction assignment operator. To subtract the given view from
+         * each of the viewed NVectors, entry by entry.
+         * 
+         * @param view The view to be subtracted; it must have the dimension
+         * of the viewed NVectors.
+         * 
+         * @return A reference to the view itself.
+        */
+        VNVectorsView<T>& operator -= (const NVectorView<T>& view)
+        {
+            for(size_t i = 0; i < vsize; ++i) (*this)[i] -= view;
+
+            return *this;
+        }
+
+
+        /**
+         * Subtraction assignment operator. To subtract the given NVector from
+         * each of the viewed NVectors, entry by entry.
+         * 
+         * @param vector The vector to be subtracted; it must have the
+         * dimension of the viewed NVectors.
+         * 
+         * @return A reference to the view itself.
+        */
+        VNVectorsView<T>& operator -= (const NVector::NVector<T>& vector)
+        {
+            for(size_t i = 0; i < vsize; ++i) (*this)[i] -= vector;
+
+            return *this;
+        }
+
+
+        /**
+         * Subtraction assignment operator. To subtract the NVectors of another
+         * view from the viewed NVectors, entry by entry.
+         * 
+         * @param view The view to be subtracted; it must have the same number
+         * of NVectors and of entries.
+         * 
+         * @return A reference to the view itself.
+        */
+        VNVectorsView<T>& operator -= (const VNVectorsView<T>& view)
+        {
+            // Validate the number of NVectors.
+            ValidationGeneral::validateDimensions(vsize, view.vsize, true);
+
+            for(size_t i = 0; i < vsize; ++i) (*this)[i] -= view.row(i);
+
+            return *this;
+        }
+
+
+        ////////////////////////////////////////////////////////////////////////
+        // Other Functionality
+        ////////////////////////////////////////////////////////////////////////
+
+
+        /**
+         * Outstream string to be print the view. To be able to view the
+         * viewed NVectors.
+         * 
+         * @param out A reference to the ostream operator.
+         * 
+         * @param view A copy of the view to be printed.
+        */
+        friend std::ostream& operator << (
+            std::ostream& out, VNVectorsView<T> view
+        )
+        {
+            for(size_t i = 0; i < view.size(); ++i)
+                out << view.row(i) << std::endl;
+
+            return out;
+        }
+
+
+        /**
+         * Index operator overload. To be able to access the viewed NVectors.
+         * 
+         * @param index The requested index to be accessed.
+         * 
+         * @return The view of the entries of the NVector.
+        */
+        NVectorView<T> operator [] (size_t index)
+        {
+            // Auxiliary variables.
+            size_t lower{0}, upper{vsize - 1};
+
+            // Validate the index is in range.
+            if(vsize == 0)
+                throw ExceptionsGeneral::IndexOutOfRange(lower, lower, index);
+            ValidationGeneral::validateInRange(index, lower, upper, true);
+
+            return row(index);
+        }
+
+
+        //######################################################################
+        // Constructors
+        //######################################################################
+
+
+        /**
+         * Creates a view of the NVectors of the given vector of NVectors, and
+         * of their entries, that are selected by the given slices.
+         * 
+         * @param vector The vector of NVectors to be viewed.
+         * 
+         * @param vectors The NVectors to be viewed.
+         * 
+         * @param entries The entries of each NVector to be viewed.
+        */
+        VNVectorsView(
+            VNVectors::VNVectors<T>& vector, Slice vectors, Slice entries
+        ) :
+        vsize{vectors.count(vector.size())},
+        rowStep{vectors.step()},
+        dimension{entries.count(vector.dimensions())},
+        offset{std::min(entries.start(), vector.dimensions())},
+        stride{entries.step()}
+        {
+            // Only where the first viewed NVector is, is stored.
+            if(vsize > 0) first = &vector[vectors.start()];
+        }
+
+
+        //######################################################################
+        // Functions
+        //######################################################################
+
+
+        /**
+         * Returns the number of viewed entries of each NVector.
+         * 
+         * @return The number of viewed entries of each NVector.
+        */
+        size_t dimensions() const
+        {
+            return dimension;
+        }
+
+
+        /**
+         * Returns a contiguous copy of the viewed NVectors.
+         * 
+         * @return A new vector of NVectors with the viewed entries.
+        */
+        VNVectors::VNVectors<T> materialize() const
+        {
+            // A view without NVectors gives an empty vector of NVectors.
+            if(vsize == 0) return VNVectors::VNVectors<T>(dimension);
+
+            return VNVectors::VNVectors<T>(dimension, vsize,
+                [this](size_t i, size_t j)
+                {
+                    return row(i)[j];
+                }
+            );
+        }
+
+
+        /**
+         * Returns the number of viewed NVectors.
+         * 
+         * @return The number of viewed NVectors.
+        */
+        size_t size() const
+        {
+            return vsize;
+        }
+
+
+        /**
+         * Returns a view of the NVectors, and of their entries, of the view
+         * that are selected by the given slices; the strides are combined,
+         * nothing is copied.
+         * 
+         * @param vectors The NVectors of the view to be viewed.
+         * 
+         * @param entries The entries of each NVector of the view to be viewed.
+         * 
+         * @return The view of the selected NVectors and entries.
+        */
+        VNVectorsView<T> slice(Slice vectors, Slice entries)
+        {
+            // Auxiliary variables.
+            VNVectorsView<T> view = *this;
+
+            view.vsize = vectors.count(vsize);
+            view.first =
+                view.vsize > 0 ? first + vectors.start() * rowStep : nullptr;
+            view.rowStep = rowStep * vectors.step();
+
+            view.dimension = entries.count(dimension);
+            view.offset =
+                offset + std::min(entries.start(), dimension) * stride;
+            view.stride = stride * entries.step();
+
+            return view;
+        }
+
+
+        private:
+        //######################################################################
+        // Functions
+        //######################################################################
+
+
+        /**
+         * Returns the view of the entries of the NVector with the given
+         * index, without validating the index. The viewed NVector is only
+         * invalidated when the view is written.
+         * 
+         * @param index The index of the viewed NVector.
+         * 
+         * @return The view of the entries of the NVector.
+        */
+        NVectorView<T> row(size_t index) const
+        {
+            // Auxiliary variables.
+            NVector::NVector<T>* vector = first + index * rowStep;
+
+            return NVectorView<T>(
+                const_cast<T*>(std::as_const(*vector).data()) + offset,
+                dimension, stride, vector
+            );
+        }
+
+
+        //######################################################################
+        // Variables
+        //######################################################################
+
+
+        // The first viewed NVector, whose cached norm, as the ones of the
+        // other viewed NVectors, is invalidated by the mutating operations.
+        NVector::NVector<T>* first{nullptr};
+
+
+        // The number of viewed NVectors.
+        size_t vsize{0};
+
+
+        // The distance between the viewed NVectors.
+        size_t rowStep{1};
+
+
+        // The number of viewed entries of each NVector.
+        size_t dimension{0};
+
+
+        // The index of the first viewed entry of each NVector.
+        size_t offset{0};
+
+
+        // The distance between the viewed entries of each NVector.
+        size_t stride{1};
+    };
+}
@@ -10,13 +10,28 @@
 
 
 // General.
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <numeric>
 #include <ostream>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 
 // User defined.
+#include "./Headers/Exceptions/exceptionsNVectors.hpp"
+#include "./Headers/Exceptions/exceptionsResults.hpp"
+#include "./Headers/Hashing/hashingGeneral.hpp"
+#include "./Headers/Parallel/parallelGeneral.hpp"
 #include "./Headers/Validation/validationGeneral.hpp"
 #include "./Headers/Validation/validationNumerical.hpp"
 #include "./nvectors.hpp"
@@ -38,6 +53,27 @@ namespace VNVectors
     class VNVectors
     {
         public:
+        //######################################################################
+        // Types
+        //######################################################################
+
+
+        // Types of the NVectors, as the standard containers name them.
+        typedef NVector::NVector<T> value_type;
+        typedef size_t size_type;
+        typedef NVector::NVector<T>& reference;
+        typedef const NVector::NVector<T>& const_reference;
+
+
+        // Random access iterators over the NVectors; both only read them, such
+        // that no NVector can be replaced by one of another dimension, and
+        // the NVectors are written through the index operator.
+        typedef typename std::vector<NVector::NVector<T>>::const_iterator
+            iterator;
+        typedef typename std::vector<NVector::NVector<T>>::const_iterator
+            const_iterator;
+
+
         //######################################################################
         // Operator Overloads
         //######################################################################
@@ -62,8 +98,7 @@ namespace VNVectors
         friend VNVectors<T> operator + (VNVectors<T> vector, T value)
         {
             // Add the value to the vector.
-            for(size_t i = 0; i < vector.size(); ++i) 
-                vector[i] = vector[i] + value;
+            vector += value;
 
             return vector;
         }
@@ -83,8 +118,7 @@ namespace VNVectors
         friend VNVectors<T> operator + (T value, VNVectors<T> vector)
         {
             // Add the value to the vector.
-            for(size_t i = 0; i < vector.size(); ++i) 
-                vector[i] = vector[i] + value;
+            vector += value;
 
             return vector;
         }
@@ -106,8 +140,7 @@ namespace VNVectors
         )
         {
             // Add the value to the vector.
-            for(size_t i = 0; i < vector.size(); ++i) 
-                vector[i] = vector[i] + value;
+            vector += value;
 
             return vector;
         }
@@ -129,8 +162,7 @@ namespace VNVectors
         )
         {
             // Add the value to the vector.
-            for(size_t i = 0; i < vector.size(); ++i) 
-                vector[i] = vector[i] + value;
+            vector += value;
 
             return vector;
         }
@@ -147,12 +179,8 @@ namespace VNVectors
         */
         VNVectors<T> operator + (VNVectors<T> vector)
         {
-            // Validate the dimensionality of the vector to be added.
-            ValidationGeneral::validateDimensions(vsize, vector.size(), true);
-
-            // Add the value to the vector.
-            for(size_t i = 0; i < vector.size(); ++i) 
-                vector[i] = vector[i] + container[i];
+            // Add the values to the vector.
+            vector += *this;
 
             return vector;
         }
@@ -172,8 +200,7 @@ namespace VNVectors
         friend VNVectors<T> operator / (VNVectors<T> vector, T value)
         { 
             // Divide each entry.
-            for(size_t i = 0; i < vector.size(); ++i)
-                vector[i] = vector[i] / value;
+            vector /= value;
 
             return vector;
         }
@@ -193,8 +220,7 @@ namespace VNVectors
         friend VNVectors<T> operator * (VNVectors<T> vector, T value)
         {
             // Multiply each entry.
-            for(size_t i = 0; i < vector.size(); ++i) 
-                vector[i] = vector[i] * value;
+            vector *= value;
 
             return vector;
         }
@@ -214,8 +240,7 @@ namespace VNVectors
         friend VNVectors<T> operator * (T value, VNVectors<T> vector)
         {
             // Multiply each entry.
-            for(size_t i = 0; i < vector.size(); ++i)
-                vector[i] = vector[i] * value;
+            vector *= value;
 
             return vector;
         }
@@ -233,8 +258,7 @@ namespace VNVectors
         friend VNVectors<T> operator - (VNVectors<T> vector, const T value)
         {           
             // Subtract from each vector component.
-            for(size_t i = 0; i < vector.size(); ++i) 
-                vector[i] = vector[i] - value;
+            vector -= value;
 
             return vector;
         }
@@ -252,8 +276,7 @@ namespace VNVectors
         friend VNVectors<T> operator - (const T value, VNVectors<T> vector)
         {            
             // Subtract from each vector entry.
-            for(size_t i = 0; i < vector.size(); ++i)
-                vector[i] = value - vector[i];
+            vector.broadcastIP(value, [](T a, T b){ return b - a; }, false);
 
             return vector;
         }
@@ -275,9 +298,8 @@ namespace VNVectors
             VNVectors<T> vector, NVector::NVector<T> value
         )
         {
-            // Add the value to the vector.
-            for(size_t i = 0; i < vector.size(); ++i) 
-                vector[i] = vector[i] - value;
+            // Subtract the value from each NVector.
+            vector -= value;
 
             return vector;
         }
@@ -299,9 +321,10 @@ namespace VNVectors
             NVector::NVector<T> value, VNVectors<T> vector
         )
         {
-            // Add the value to the vector.
-            for(size_t i = 0; i < vector.size(); ++i) 
-                vector[i] = value - vector[i];
+            // Subtract each NVector from the value.
+            vector.broadcastRowsIP(
+                value, [](T a, T b){ return b - a; }, false
+            );
 
             return vector;
         }
@@ -318,25 +341,339 @@ namespace VNVectors
         */
         VNVectors<T> operator - (VNVectors<T> vector)
         {
-            // Validate the dimensionality of the vector to be added.
-            ValidationGeneral::validateDimensions(vsize, vector.size(), true);
-            
             // Subtract each value.
-            for(size_t i = 0; i < container.size(); ++i)
-                vector[i] = container[i] - vector[i];
+            vector.broadcastIP(*this, [](T a, T b){ return b - a; }, false);
+
+            return vector;
+        }
+
+
+        /**
+         * Multiplication operator overload. To multiply each NVector of the
+         * vector of NVectors by the given NVector, entry by entry.
+         * 
+         * @param vector The vector of NVectors to be multiplied.
+         * 
+         * @param value The NVector by which each NVector will be multiplied.
+         * 
+         * @return A copy of the vector of NVectors with each of its NVectors
+         * multiplied by the given NVector.
+        */
+        friend VNVectors<T> operator * (
+            VNVectors<T> vector, NVector::NVector<T> value
+        )
+        {
+            // Multiply each NVector.
+            vector *= value;
+
+            return vector;
+        }
+
+
+        /**
+         * Multiplication operator overload. To multiply each NVector of the
+         * vector of NVectors by the given NVector, entry by entry.
+         * 
+         * @param value The NVector by which each NVector will be multiplied.
+         * 
+         * @param vector The vector of NVectors to be multiplied.
+         * 
+         * @return A copy of the vector of NVectors with each of its NVectors
+         * multiplied by the given NVector.
+        */
+        friend VNVectors<T> operator * (
+            NVector::NVector<T> value, VNVectors<T> vector
+        )
+        {
+            // Multiply each NVector.
+            vector *= value;
+
+            return vector;
+        }
+
+
+        /**
+         * Multiplication operator overload. To multiply two vectors of
+         * NVectors, entry by entry; they need to have the same number of
+         * NVectors for this to happen.
+         * 
+         * @param vector The vector of NVectors to be multiplied.
+         * 
+         * @return A copy of the vector of NVectors with each of its entries
+         * multiplied by the entry of the current vector of NVectors.
+        */
+        VNVectors<T> operator * (VNVectors<T> vector)
+        {
+            // Multiply each entry.
+            vector *= *this;
+
+            return vector;
+        }
+
+
+        /**
+         * Division operator overload. To divide each NVector of the vector of
+         * NVectors by the given NVector, entry by entry.
+         * 
+         * @param vector The vector of NVectors to be divided.
+         * 
+         * @param value The NVector by which each NVector will be divided.
+         * 
+         * @return A copy of the vector of NVectors with each of its NVectors
+         * divided by the given NVector.
+        */
+        friend VNVectors<T> operator / (
+            VNVectors<T> vector, NVector::NVector<T> value
+        )
+        {
+            // Divide each NVector.
+            vector /= value;
+
+            return vector;
+        }
+
+
+        /**
+         * Division operator overload. To divide the current vector of NVectors
+         * by another one, entry by entry; they need to have the same number of
+         * NVectors for this to happen.
+         * 
+         * @param vector The vector of NVectors by which the current one is
+         * divided.
+         * 
+         * @return A copy of the current vector of NVectors with each of its
+         * entries divided by the entry of the given vector of NVectors.
+        */
+        VNVectors<T> operator / (VNVectors<T> vector)
+        {
+            // Validate finite division, before any entry is modified.
+            vector.validateDivisors();
+
+            // Divide each entry.
+            vector.broadcastIP(*this, [](T a, T b){ return b / a; }, false);
 
             return vector;
         }
 
 
+        ////////////////////////////////////////////////////////////////////////
+        // Compound Assignment
+        ////////////////////////////////////////////////////////////////////////
+
+
+        /**
+         * Addition assignment operator. To add a scalar quantity to each of the
+         * entries of the vector of NVectors.
+         * 
+         * @param value The value to be added.
+         * 
+         * @return A reference to the vector of NVectors itself.
+        */
+        VNVectors<T>& operator += (T value)
+        {
+            broadcastIP(value, [](T a, T b){ return a + b; }, false);
+
+            return *this;
+        }
+
+
+        /**
+         * Addition assignment operator. To add the given NVector to each of the
+         * NVectors of the vector of NVectors.
+         * 
+         * @param value The NVector to be added.
+         * 
+         * @return A reference to the vector of NVectors itself.
+        */
+        VNVectors<T>& operator += (NVector::NVector<T>& value)
+        {
+            broadcastRowsIP(value, [](T a, T b){ return a + b; }, false);
+
+            return *this;
+        }
+
+
+        /**
+         * Addition assignment operator. To add another vector of NVectors to
+         * the vector of NVectors, entry by entry.
+         * 
+         * @param vector The vector of NVectors to be added.
+         * 
+         * @return A reference to the vector of NVectors itself.
+        */
+        VNVectors<T>& operator += (VNVectors<T>& vector)
+        {
+            broadcastIP(vector, [](T a, T b){ return a + b; }, false);
+
+            return *this;
+        }
+
+
+        /**
+         * Division assignment operator. To divide each of the entries of the
+         * vector of NVectors by a scalar quantity.
+         * 
+         * @param value The value by which each entry will be divided.
+         * 
+         * @return A reference to the vector of NVectors itself.
+        */
+        VNVectors<T>& operator /= (T value)
+        {
+            // Validate finite division.
+            ValidationGeneral::isNotDivingByZero(value, true);
+
+            broadcastIP(value, [](T a, T b){ return a / b; }, false);
+
+            return *this;
+        }
+
+
+        /**
+         * Division assignment operator. To divide each of the NVectors of the
+         * vector of NVectors by the given NVector, entry by entry.
+         * 
+         * @param value The NVector by which each NVector will be divided.
+         * 
+         * @return A reference to the vector of NVectors itself.
+        */
+        VNVectors<T>& operator /= (NVector::NVector<T>& value)
+        {
+            // Validate finite division, before any entry is modified.
+            const T* entries = value.data();
+            for(size_t i = 0; i < value.size(); ++i)
+                ValidationGeneral::isNotDivingByZero(entries[i], true);
+
+            broadcastRowsIP(value, [](T a, T b){ return a / b; }, false);
+
+            return *this;
+        }
+
+
+        /**
+         * Division assignment operator. To divide the vector of NVectors by
+         * another vector of NVectors, entry by entry.
+         * 
+         * @param vector The vector of NVectors by which the entries will be
+         * divided.
+         * 
+         * @return A reference to the vector of NVectors itself.
+        */
+        VNVectors<T>& operator /= (VNVectors<T>& vector)
+        {
+            // Validate finite division, before any entry is modified.
+            vector.validateDivisors();
+
+            broadcastIP(vector, [](T a, T b){ return a / b; }, false);
+
+            return *this;
+        }
+
+
+        /**
+         * Multiplication assignment operator. To multiply each of the entries
+         * of the vector of NVectors by a scalar quantity.
+         * 
+         * @param value The value by which each entry will be multiplied.
+         * 
+         * @return A reference to the vector of NVectors itself.
+        */
+        VNVectors<T>& operator *= (T value)
+        {
+            broadcastIP(value, [](T a, T b){ return a * b; }, false);
+
+            return *this;
+        }
+
+
+        /**
+         * Multiplication assignment operator. To multiply each of the NVectors
+         * of the vector of NVectors by the given NVector, entry by entry.
+         * 
+         * @param value The NVector by which each NVector will be multiplied.
+         * 
+         * @return A reference to the vector of NVectors itself.
+        */
+        VNVectors<T>& operator *= (NVector::NVector<T>& value)
+        {
+            broadcastRowsIP(value, [](T a, T b){ return a * b; }, false);
+
+            return *this;
+        }
+
+
+        /**
+         * Multiplication assignment operator. To multiply the vector of
+         * NVectors by another vector of NVectors, entry by entry.
+         * 
+         * @param vector The vector of NVectors to be multiplied.
+         * 
+         * @return A reference to the vector of NVectors itself.
+        */
+        VNVectors<T>& operator *= (VNVectors<T>& vector)
+        {
+            broadcastIP(vector, [](T a, T b){ return a * b; }, false);
+
+            return *this;
+        }
+
+
+        /**
+         * Subtraction assignment operator. To subtract a scalar quantity from
+         * each of the entries of the vector of NVectors.
+         * 
+         * @param value The value to be subtracted.
+         * 
+         * @return A reference to the vector of NVectors itself.
+        */
+        VNVectors<T>& operator -= (T value)
+        {
+            broadcastIP(value, [](T a, T b){ return a - b; }, false);
+
+            return *this;
+        }
+
+
+        /**
+         * Subtraction assignment operator. To subtract the given NVector from
+         * each of the NVectors of the vector of NVectors, e.g., to center the
+         * NVectors on their mean.
+         * 
+         * @param value The NVector to be subtracted.
+         * 
+         * @return A reference to the vector of NVectors itself.
+        */
+        VNVectors<T>& operator -= (NVector::NVector<T>& value)
+        {
+            broadcastRowsIP(value, [](T a, T b){ return a - b; }, false);
+
+            return *this;
+        }
+
+
+        /**
+         * Subtraction assignment operator. To subtract another vector of
+         * NVectors from the vector of NVectors, entry by entry.
+         * 
+         * @param vector The vector of NVectors to be subtracted.
+         * 
+         * @return A reference to the vector of NVectors itself.
+        */
+        VNVectors<T>& operator -= (VNVectors<T>& vector)
+        {
+            broadcastIP(vector, [](T a, T b){ return a - b; }, false);
+
+            return *this;
+        }
+
+
         ////////////////////////////////////////////////////////////////////////
         // Other Functionality
         ////////////////////////////////////////////////////////////////////////
 
 
         /**
-         * Comparison operator. To be able to access the indexes of the
-         * vectors of NVectors for comparison.
+         * Comparison operator. To compare the vectors of NVectors, NVector by
+         * NVector, for exact equality.
          * 
          * @param vector_1 A reference to the first vector of NVectors being
          * compared.
@@ -344,22 +681,21 @@ namespace VNVectors
          * @param vector_2 A reference to the second vector of NVectors being
          * compared.
         */
-        friend bool operator == (VNVectors<T>& vector_1, VNVectors<T>& vector_2)
+        friend bool operator == (
+            const VNVectors<T>& vector_1, const VNVectors<T>& vector_2
+        )
         {   
             // Auxiliary variables.
             bool valid = ValidationGeneral::validateDimensions(
-                vector_1.size(), vector_2.size(), false
+                vector_1.vsize, vector_2.vsize, false
             );
 
             valid = valid && ValidationGeneral::validateDimensions(
-                vector_1[0].size(), vector_2[0].size(), false
+                vector_1.dimension, vector_2.dimension, false
             );
 
-            // Check item by item.
-            for(size_t i = 0; valid && i < vector_1.size(); ++i)
-                valid = valid && vector_1[i] == vector_2[i];
-                
-            return valid;
+            // Check NVector by NVector.
+            return valid && vector_1.container == vector_2.container;
         }
 
 
@@ -392,6 +728,31 @@ namespace VNVectors
             // Auxiliary variables.
             size_t lower{0}, upper{vsize - 1};
 
+            // An empty vector of NVectors has no valid indexes.
+            if(vsize == 0)
+                throw ExceptionsGeneral::IndexOutOfRange(lower, lower, index);
+
+            // Validate the index is in range.
+            ValidationGeneral::validateInRange(index, lower, upper, true);
+
+            return container[index];
+        }
+
+
+        /**
+         * Index operator overload, for constant vectors of NVectors.
+         * 
+         * @param index The requested index to be accessed.
+        */
+        const NVector::NVector<T>& operator [] (size_t index) const
+        {   
+            // Auxiliary variables.
+            size_t lower{0}, upper{vsize - 1};
+
+            // An empty vector of NVectors has no valid indexes.
+            if(vsize == 0)
+                throw ExceptionsGeneral::IndexOutOfRange(lower, lower, index);
+
             // Validate the index is in range.
             ValidationGeneral::validateInRange(index, lower, upper, true);
 
@@ -412,7 +773,7 @@ namespace VNVectors
          * VNVectors will have; the dimension must be greater than zero.
          * 
          * @param quantity The number of NVectors in the vector of NVectors;
-         * the size cannot be changed, must be greater than zero.
+         * must be greater than zero, more NVectors can be appended later.
         */
         VNVectors(size_t dimensions, size_t size) :
         dimension{dimensions},
@@ -431,66 +792,2216 @@ namespace VNVectors
 
 
         /**
-         * Destructs the given object pointer.
+         * Constructs a new, empty, vector of NVectors; to be filled with the
+         * growing functions.
+         * 
+         * @param dimensions The number of entries the NVectors in the
+         * VNVectors will have; the dimension must be greater than zero.
         */
-        ~VNVectors(){}
-
-
-        //######################################################################
-        // Functions
-        //######################################################################
-        
-
-        ////////////////////////////////////////////////////////////////////////
-        // Non-Template Functions
-        ////////////////////////////////////////////////////////////////////////
+        explicit VNVectors(size_t dimensions) :
+        dimension{dimensions}
+        {
+            // Validate the quantities.
+            ValidationNumerical::rangeGreater<size_t>(0, dimension, true);
+            ValidationNumerical::isFloating<T>((T) 1, true);
+        }
 
 
         /**
-         * Returns the current size of the container.
+         * Constructs a new vector of NVectors, whose NVectors entries are not
+         * initialized; to be used when all the entries are going to be
+         * overwritten.
          * 
-         * @return The current size of the container.
+         * @param dimensions The number of entries the NVectors in the
+         * VNVectors will have; the dimension must be greater than zero.
+         * 
+         * @param size The number of NVectors in the vector of NVectors, must
+         * be greater than zero.
         */
-        size_t size()
+        VNVectors(size_t dimensions, size_t size, NVector::Uninitialized) :
+        VNVectors(dimensions)
         {
-            return vsize;
-        }
+            // Validate the quantities.
+            ValidationNumerical::rangeGreater<size_t>(0, size, true);
 
+            // Create each NVector, without setting its entries.
+            container.reserve(size);
+            for(size_t i = 0; i < size; ++i)
+                container.emplace_back(dimension, NVector::uninitialized);
 
-        ////////////////////////////////////////////////////////////////////////
-        // Non-Template Functions
-        ////////////////////////////////////////////////////////////////////////
+            vsize = size;
+        }
+
+
+        /**
+         * Constructs a new vector of NVectors, whose entries are given by the
+         * generator, without initializing them first.
+         * 
+         * @param dimensions The number of entries the NVectors in the
+         * VNVectors will have; the dimension must be greater than zero.
+         * 
+         * @param size The number of NVectors in the vector of NVectors, must
+         * be greater than zero.
+         * 
+         * @param generator The function, with signature T generator(size_t
+         * index, size_t entry), that returns the value of the given entry of
+         * the NVector with the given index.
+        */
+        template <
+            typename G,
+            std::enable_if_t<
+                std::is_invocable_r_v<T, G&, size_t, size_t>, int
+            > = 0
+        >
+        VNVectors(size_t dimensions, size_t size, G generator) :
+        VNVectors(dimensions, size, NVector::uninitialized)
+        {
+            // Set the entries.
+            for(size_t i = 0; i < vsize; ++i)
+            {
+                T* entries = container[i].data();
+                for(size_t j = 0; j < dimension; ++j)
+                    entries[j] = generator(i, j);
+            }
+        }
+
+
+        /**
+         * Constructs a new vector of NVectors with the values of the given
+         * range, given NVector after NVector; without initializing the
+         * entries first.
+         * 
+         * @param dimensions The number of entries the NVectors in the
+         * VNVectors will have; the dimension must be greater than zero.
+         * 
+         * @param first The iterator to the first value.
+         * 
+         * @param last The iterator after the last value; the number of values
+         * must be a multiple of the dimension.
+        */
+        template <
+            typename I,
+            std::enable_if_t<
+                std::is_base_of_v<
+                    std::forward_iterator_tag,
+                    typename std::iterator_traits<I>::iterator_category
+                >, int
+            > = 0
+        >
+        VNVectors(size_t dimensions, I first, I last) :
+        VNVectors(dimensions)
+        {
+            append(first, last);
+        }
+
+
+        /**
+         * Constructs a copy of the given vector of NVectors.
+         * 
+         * @param vector The vector of NVectors to be copied.
+        */
+        VNVectors(const VNVectors<T>& vector) = default;
+
+
+        /**
+         * Constructs a vector of NVectors by taking the storage of the given
+         * vector of NVectors. The given vector of NVectors is left empty,
+         * i.e., without NVectors and with zero dimensions.
+         * 
+         * @param vector The vector of NVectors whose storage will be taken.
+        */
+        VNVectors(VNVectors<T>&& vector) noexcept :
+        container{std::move(vector.container)},
+        dimension{vector.dimension},
+        vsize{vector.vsize}
+        {
+            // The storage is gone, its sizes too.
+            vector.container.clear();
+            vector.dimension = 0;
+            vector.vsize = 0;
+        }
+
+
+        /**
+         * Destructs the given object pointer.
+        */
+        ~VNVectors(){}
+
+
+        //######################################################################
+        // Assignment
+        //######################################################################
+
+
+        /**
+         * Copy assignment operator.
+         * 
+         * @param vector The vector of NVectors to be copied.
+         * 
+         * @return A reference to the vector of NVectors itself.
+        */
+        VNVectors<T>& operator = (const VNVectors<T>& vector) = default;
+
+
+        /**
+         * Move assignment operator. The storage of the given vector of
+         * NVectors is taken and the given vector of NVectors is left empty,
+         * i.e., without NVectors and with zero dimensions.
+         * 
+         * @param vector The vector of NVectors whose storage will be taken.
+         * 
+         * @return A reference to the vector of NVectors itself.
+        */
+        VNVectors<T>& operator = (VNVectors<T>&& vector) noexcept
+        {
+            // Moving a vector of NVectors onto itself keeps it.
+            if(this == &vector) return *this;
+
+            container = std::move(vector.container);
+            dimension = vector.dimension;
+            vsize = vector.vsize;
+
+            // The storage is gone, its sizes too.
+            vector.container.clear();
+            vector.dimension = 0;
+            vector.vsize = 0;
+
+            return *this;
+        }
+
+
+        //######################################################################
+        // Functions
+        //######################################################################
+        
+
+        ////////////////////////////////////////////////////////////////////////
+        // Non-Template Functions
+        ////////////////////////////////////////////////////////////////////////
+
+
+        /**
+         * Appends the NVectors of the given vector of NVectors at the end of
+         * the vector of NVectors.
+         * 
+         * @param vector The vector of NVectors to be appended; it can be the
+         * vector of NVectors itself.
+        */
+        void append(VNVectors<T>& vector)
+        {
+            // Validate the dimensions are the same.
+            ValidationGeneral::validateDimensions(
+                dimension, vector.dimension, true
+            );
+
+            // Auxiliary variables.
+            size_t count = vector.size();
+
+            // Copy the NVectors; the count is kept in case of self appending,
+            // and the source is only read by index after growing, such that
+            // the growth does not leave dangling references.
+            grow(vsize + count);
+            for(size_t i = 0; i < count; ++i)
+                container.push_back(vector.container[i]);
+
+            vsize = container.size();
+        }
+
+
+        /**
+         * Returns the permutation that sorts the NVectors by the given entry,
+         * in increasing order; ties keep their original order.
+         * 
+         * @param component The index of the entry used as the key.
+         * 
+         * @param parallel True, if the sorting must be split among several
+         * threads; False, otherwise.
+         * 
+         * @return The permutation index, i.e., the indexes of the NVectors in
+         * sorted order.
+        */
+        std::vector<size_t> argsortByComponent(
+            size_t component, bool parallel
+        ) const
+        {
+            // Validate the entry exists.
+            ValidationGeneral::validateInRange(
+                component, 0, dimension - 1, true
+            );
+
+            return argsort([component](const NVector::NVector<T>& vector)
+            {
+                return vector.data()[component];
+            }, parallel);
+        }
+
+
+        /**
+         * Returns the permutation that sorts the NVectors by their dot
+         * product with the given query, in increasing order; ties keep their
+         * original order.
+         * 
+         * @param query The NVector whose dot products are used as the key.
+         * 
+         * @param parallel True, if the sorting must be split among several
+         * threads; False, otherwise.
+         * 
+         * @return The permutation index, i.e., the indexes of the NVectors in
+         * sorted order.
+        */
+        std::vector<size_t> argsortByDotProduct(
+            const NVector::NVector<T>& query, bool parallel
+        ) const
+        {
+            // Validate the dimensions.
+            ValidationGeneral::validateDimensions(
+                dimension, query.size(), true
+            );
+
+            return argsort([&query](const NVector::NVector<T>& vector)
+            {
+                return vector.dotProduct(query);
+            }, parallel);
+        }
+
+
+        /**
+         * Returns the permutation that sorts the NVectors by their norm, in
+         * increasing order; ties keep their original order.
+         * 
+         * @param parallel True, if the sorting must be split among several
+         * threads; False, otherwise.
+         * 
+         * @return The permutation index, i.e., the indexes of the NVectors in
+         * sorted order.
+        */
+        std::vector<size_t> argsortByNorm(bool parallel) const
+        {
+            // The squared norm has the same order and avoids the roots.
+            return argsort([](const NVector::NVector<T>& vector)
+            {
+                return vector.normSquared();
+            }, parallel);
+        }
+
+
+        /**
+         * Returns the permutation that sorts the NVectors lexicographically,
+         * i.e., by their first entry, then by their second entry, and so on;
+         * ties keep their original order.
+         * 
+         * @param parallel True, if the sorting must be split among several
+         * threads; False, otherwise.
+         * 
+         * @return The permutation index, i.e., the indexes of the NVectors in
+         * sorted order.
+        */
+        std::vector<size_t> argsortLexicographic(bool parallel) const
+        {
+            // Auxiliary variables.
+            std::vector<size_t> indexes(vsize);
+            std::iota(indexes.begin(), indexes.end(), (size_t) 0);
+
+            // Compare the entries directly, there is no key to project.
+            auto compare = [this](size_t i, size_t j)
+            {
+                const T* a = container[i].data();
+                const T* b = container[j].data();
+
+                bool less = std::lexicographical_compare(
+                    a, a + dimension, b, b + dimension
+                );
+                bool greater = std::lexicographical_compare(
+                    b, b + dimension, a, a + dimension
+                );
+
+                return less || (!greater && i < j);
+            };
+
+            ParallelGeneral::parallelSort(
+                indexes.begin(), indexes.end(),
+                parallel ? parallelGrain : std::max<size_t>(vsize, 1), compare
+            );
+
+            return indexes;
+        }
+
+
+        /**
+         * Returns an iterator to the first NVector, for the standard
+         * algorithms and execution policies; the NVectors are only read.
+         * 
+         * @return A random access iterator to the first NVector.
+        */
+        const_iterator begin() const
+        {
+            return container.begin();
+        }
+
+
+        /**
+         * Returns the number of NVectors that the vector of NVectors can
+         * hold before it needs to grow.
+         * 
+         * @return The number of NVectors that can be held.
+        */
+        size_t capacity() const
+        {
+            return container.capacity();
+        }
+
+
+        /**
+         * Returns an iterator to the first NVector, that can not write the
+         * NVectors.
+         * 
+         * @return A random access iterator to the first NVector.
+        */
+        const_iterator cbegin() const
+        {
+            return container.cbegin();
+        }
+
+
+        /**
+         * Returns an iterator after the last NVector, that can not write the
+         * NVectors.
+         * 
+         * @return A random access iterator after the last NVector.
+        */
+        const_iterator cend() const
+        {
+            return container.cend();
+        }
+
+
+        /**
+         * Removes the repeated NVectors, keeping the first occurrence of each
+         * distinct NVector in its original order.
+        */
+        void deduplicateIP()
+        {
+            // Auxiliary variables.
+            std::vector<size_t> indexes = uniqueIndexes();
+
+            // Move the kept NVectors to the front.
+            for(size_t i = 0; i < indexes.size(); ++i)
+                if(indexes[i] != i)
+                    container[i] = std::move(container[indexes[i]]);
+
+            container.erase(
+                container.begin() + indexes.size(), container.end()
+            );
+            vsize = container.size();
+        }
+
+
+        /**
+         * Returns the number of entries of the NVectors.
+         * 
+         * @return The number of entries of the NVectors.
+        */
+        size_t dimensions() const
+        {
+            return dimension;
+        }
+
+
+        /**
+         * Appends an NVector at the end of the vector of NVectors, constructed
+         * with the given arguments; they can refer to the NVectors of the
+         * vector of NVectors itself, since the NVector is constructed before
+         * the container grows.
+         * 
+         * @param args The arguments of the constructor of the NVector; the
+         * constructed NVector must have the dimension of the vector of
+         * NVectors.
+         * 
+         * @return A reference to the appended NVector.
+        */
+        template <typename... Args>
+        NVector::NVector<T>& emplace_back(Args&&... args)
+        {
+            // Construct the NVector, before any reallocation.
+            NVector::NVector<T> vector(std::forward<Args>(args)...);
+
+            // Validate the dimension.
+            ValidationGeneral::validateDimensions(
+                dimension, vector.size(), true
+            );
+
+            // Move the NVector in, its entries are not copied.
+            grow(vsize + 1);
+            container.push_back(std::move(vector));
+            ++vsize;
+
+            return container.back();
+        }
+
+
+        /**
+         * Returns an iterator after the last NVector, for the standard
+         * algorithms and execution policies; the NVectors are only read.
+         * 
+         * @return A random access iterator after the last NVector.
+        */
+        const_iterator end() const
+        {
+            return container.end();
+        }
+
+
+        /**
+         * Orthonormalizes the NVectors, in place, with the modified
+         * Gram-Schmidt process, i.e., vector = Q and the original NVectors
+         * are the rows of R^T * Q. The NVectors are processed in panels: each
+         * panel is orthonormalized, and then its NVectors are projected out of
+         * all the following NVectors, which are independent of each other.
+         * 
+         * @param r The vector of NVectors where the upper triangular
+         * coefficients will be stored, i.e., r[i][j] = <q_i, vector_j>; it
+         * must have as many NVectors, of that dimension, as the vector of
+         * NVectors. The coefficients are not stored if it is a null pointer.
+         * 
+         * @param parallel True, if the projections of each panel must be split
+         * among several threads; False, otherwise.
+         * 
+         * @throw ExceptionsGeneral::DivisionByZero, if the NVectors are
+         * linearly dependent, i.e., an NVector vanishes, up to the rounding,
+         * after the previous ones are projected out of it.
+        */
+        void gramSchmidtIP(VNVectors<T>* r, bool parallel)
+        {
+            // Validate the coefficients.
+            if(r != nullptr)
+            {
+                ValidationGeneral::validateDimensions(
+                    vsize, r->dimension, true
+                );
+                ValidationGeneral::validateDimensions(vsize, r->vsize, true);
+            }
+
+            // Auxiliary variables.
+            T tolerance = (T) dimension * std::numeric_limits<T>::epsilon();
+            size_t grain =
+                std::max<size_t>(parallelGrain / gramSchmidtPanel, 1);
+            std::vector<T*> rows(vsize), coefficients(vsize, nullptr);
+            std::vector<T> norms(vsize, (T) 0);
+
+            // Gather the storage, such that the threads only use pointers.
+            for(size_t i = 0; i < vsize; ++i)
+            {
+                rows[i] = container[i].data();
+
+                if(r == nullptr) continue;
+                coefficients[i] = r->container[i].data();
+                std::fill_n(coefficients[i], vsize, (T) 0);
+            }
+
+            // The original squared norms determine when an NVector vanishes.
+            for(size_t i = 0; i < vsize; ++i)
+                for(size_t k = 0; k < dimension; ++k)
+                    norms[i] += rows[i][k] * rows[i][k];
+
+            for(size_t first = 0; first < vsize; first += gramSchmidtPanel)
+            {
+                size_t last = std::min(vsize, first + gramSchmidtPanel);
+
+                // Orthonormalize the NVectors of the panel.
+                for(size_t j = first; j < last; ++j)
+                {
+                    gramSchmidtKernel(
+                        rows.data(), coefficients.data(), first, j, j
+                    );
+
+                    // Normalize the remaining component.
+                    T vnorm = (T) 0;
+                    for(size_t k = 0; k < dimension; ++k)
+                        vnorm += rows[j][k] * rows[j][k];
+
+                    if(!(vnorm > tolerance * tolerance * norms[j]))
+                        throw ExceptionsGeneral::DivisionByZero();
+
+                    vnorm = std::sqrt(vnorm);
+                    for(size_t k = 0; k < dimension; ++k) rows[j][k] /= vnorm;
+                    if(r != nullptr) coefficients[j][j] = vnorm;
+                }
+
+                // Project the panel out of the following NVectors.
+                auto update = [&](size_t begin, size_t end)
+                {
+                    for(size_t j = begin; j < end; ++j)
+                        gramSchmidtKernel(
+                            rows.data(), coefficients.data(), first, last, j
+                        );
+                };
+
+                if(parallel)
+                    ParallelGeneral::parallelFor(last, vsize, grain, update);
+                else
+                    update(last, vsize);
+            }
+        }
+
+
+        /**
+         * Returns the hash of the NVectors; vectors of NVectors that are equal
+         * have the same hash.
+         * 
+         * @return The hash of the NVectors.
+        */
+        size_t hash() const
+        {
+            // Auxiliary variables.
+            HashingGeneral::Hasher hasher = HashingGeneral::Hasher(dimension);
+
+            for(const NVector::NVector<T>& vector : container)
+                hasher.add(vector.hash());
+
+            return (size_t) hasher.digest();
+        }
+
+
+        /**
+         * Determines if the vector of NVectors is close to the given vector of
+         * NVectors, entry by entry, i.e., |a - b| <= max(absolute, relative *
+         * max(|a|, |b|)); stops at the first NVector that is not close.
+         * 
+         * @param vector The vector of NVectors to be compared.
+         * 
+         * @param absolute The absolute tolerance.
+         * 
+         * @param relative The tolerance relative to the magnitude of the
+         * entries.
+         * 
+         * @return True, if the vectors of NVectors have the same size and
+         * dimension and all the NVectors are close; False, otherwise.
+        */
+        bool isClose(VNVectors<T>& vector, T absolute, T relative)
+        {
+            // Auxiliary variables.
+            bool valid = vsize == vector.vsize && dimension == vector.dimension;
+
+            for(size_t i = 0; valid && i < vsize; ++i)
+                valid = container[i].isClose(
+                    vector.container[i], absolute, relative
+                );
+
+            return valid;
+        }
+
+
+        /**
+         * Determines if the vector of NVectors is close to the given vector of
+         * NVectors, entry by entry, where the entries can differ in up to the
+         * given number of units in the last place; stops at the first NVector
+         * that is not close. Only for single and double precision, checked
+         * when it is used.
+         * 
+         * @param vector The vector of NVectors to be compared.
+         * 
+         * @param ulps The maximum number of representable numbers between
+         * the entries.
+         * 
+         * @return True, if the vectors of NVectors have the same size and
+         * dimension and all the NVectors are close; False, otherwise.
+        */
+        template <typename F = T>
+        bool isCloseULP(VNVectors<T>& vector, uint64_t ulps)
+        {
+            // Auxiliary variables.
+            bool valid = vsize == vector.vsize && dimension == vector.dimension;
+
+            for(size_t i = 0; valid && i < vsize; ++i)
+                valid = container[i].template isCloseULP<F>(
+                    vector.container[i], ulps
+                );
+
+            return valid;
+        }
+
+
+        /**
+         * Reorders the NVectors with the given permutation, storing the
+         * results in the given output, i.e.,
+         * output[i] = vector[permutation[i]].
+         * 
+         * @param permutation The permutation index, with each of the indexes
+         * of the NVectors exactly once, e.g., the result of an argsort.
+         * 
+         * @param output The vector of NVectors where the results will be
+         * stored; it can be the vector of NVectors itself.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+        */
+        void permute(
+            std::vector<size_t>& permutation, VNVectors<T>& output,
+            bool parallel
+        )
+        {
+            // Validate the output and the permutation.
+            validateTransform(dimension, output);
+            validatePermutation(permutation);
+
+            // Reordering the vector itself cannot copy.
+            if(&output == this)
+            {
+                permuteKernel(permutation);
+                return;
+            }
+
+            // Copy the entries into the existing NVectors, without allocating.
+            auto copy = [&](size_t first, size_t last)
+            {
+                for(size_t i = first; i < last; ++i)
+                {
+                    const T* entries =
+                        std::as_const(container[permutation[i]]).data();
+                    std::copy(
+                        entries, entries + dimension,
+                        output.container[i].data()
+                    );
+                }
+            };
+
+            if(parallel)
+                ParallelGeneral::parallelFor(0, vsize, parallelGrain, copy);
+            else
+                copy(0, vsize);
+        }
+
+
+        /**
+         * Reorders the NVectors with the given permutation, in place, i.e.,
+         * vector[i] = old vector[permutation[i]]. The NVectors are moved
+         * along the cycles of the permutation, so no entries are copied.
+         * 
+         * @param permutation The permutation index, with each of the indexes
+         * of the NVectors exactly once, e.g., the result of an argsort.
+        */
+        void permuteIP(std::vector<size_t>& permutation)
+        {
+            // Validate the permutation.
+            validatePermutation(permutation);
+
+            permuteKernel(permutation);
+        }
+
+
+        /**
+         * Appends a copy of the given NVector at the end of the vector of
+         * NVectors.
+         * 
+         * @param vector The NVector to be appended; it must have the dimension
+         * of the vector of NVectors.
+        */
+        void push_back(NVector::NVector<T> vector)
+        {
+            emplace_back(std::move(vector));
+        }
+
+
+        /**
+         * Reserves space for the given number of NVectors, such that the
+         * vector of NVectors can grow up to that size without reallocating.
+         * 
+         * @param size The number of NVectors to be reserved.
+        */
+        void reserve(size_t size)
+        {
+            container.reserve(size);
+        }
+
+
+        /**
+         * Returns the current size of the container.
+         * 
+         * @return The current size of the container.
+        */
+        size_t size() const
+        {
+            return vsize;
+        }
+
+
+        /**
+         * Returns the indexes of the first occurrence of each distinct
+         * NVector, in increasing order; the NVectors are hashed once and
+         * compared only when their hashes collide.
+         * 
+         * @return The indexes of the first occurrence of each distinct
+         * NVector.
+        */
+        std::vector<size_t> uniqueIndexes()
+        {
+            // Auxiliary variables.
+            std::vector<size_t> hashes(vsize);
+            std::vector<size_t> indexes;
+
+            for(size_t i = 0; i < vsize; ++i) hashes[i] = container[i].hash();
+
+            // The set stores indexes, keyed by the NVectors they refer to.
+            auto hasher = [&hashes](size_t i){ return hashes[i]; };
+            auto equal = [this](size_t i, size_t j){
+                return container[i] == container[j];
+            };
+            std::unordered_set<size_t, decltype(hasher), decltype(equal)>
+                seen(vsize, hasher, equal);
+
+            for(size_t i = 0; i < vsize; ++i)
+                if(seen.insert(i).second) indexes.push_back(i);
+
+            return indexes;
+        }
+
+
+        ////////////////////////////////////////////////////////////////////////
+        // Template Functions
+        ////////////////////////////////////////////////////////////////////////
+
+
+        /**
+         * Appends the NVectors with the values of the given range, given
+         * NVector after NVector, at the end of the vector of NVectors.
+         * 
+         * @param first The iterator to the first value.
+         * 
+         * @param last The iterator after the last value; the number of values
+         * must be a multiple of the dimension.
+        */
+        template <typename I>
+        void append(I first, I last)
+        {
+            // Auxiliary variables.
+            size_t values = (size_t) std::distance(first, last);
+            size_t count = values / dimension;
+
+            // Validate the number of values is a multiple of the dimension.
+            ValidationGeneral::validateDimensions(
+                count * dimension, values, true
+            );
+
+            // Create each NVector directly from its values; the growth moves
+            // the NVectors, whose entries, and iterators, stay in place.
+            grow(vsize + count);
+            for(size_t i = 0; i < count; ++i)
+            {
+                I next = std::next(first, dimension);
+                container.emplace_back(first, next);
+                first = next;
+            }
+
+            vsize = container.size();
+        }
+
+
+        /**
+         * Returns the permutation that sorts the NVectors by the given key, in
+         * increasing order; ties keep their original order. The key of each
+         * NVector is computed only once, and the sorting is a merge sort.
+         * 
+         * @param key The projection of the NVectors to the keys, with
+         * signature key(const NVector&), whose results are ordered with <; it must be
+         * safe to call from several threads, and the keys cannot be NaN.
+         * 
+         * @param parallel True, if the keys and the sorting must be split
+         * among several threads; False, otherwise.
+         * 
+         * @return The permutation index, i.e., the indexes of the NVectors in
+         * sorted order.
+        */
+        template <typename K>
+        std::vector<size_t> argsort(K key, bool parallel) const
+        {
+            // Auxiliary variables.
+            typedef std::decay_t<
+                std::invoke_result_t<K&, const NVector::NVector<T>&>
+            > R;
+            std::vector<std::pair<R, size_t>> keys(vsize);
+            std::vector<size_t> indexes(vsize);
+            size_t grain =
+                parallel ? parallelGrain : std::max<size_t>(vsize, 1);
+
+            // Project each of the NVectors.
+            ParallelGeneral::parallelFor(0, vsize, grain,
+                [&](size_t first, size_t last)
+                {
+                    for(size_t i = first; i < last; ++i)
+                        keys[i] = std::pair<R, size_t>(key(container[i]), i);
+                }
+            );
+
+            // Sort by key, and then by index.
+            ParallelGeneral::parallelSort(keys.begin(), keys.end(), grain,
+                [](const std::pair<R, size_t>& a, const std::pair<R, size_t>& b)
+                {
+                    if(a.first < b.first) return true;
+
+                    return !(b.first < a.first) && a.second < b.second;
+                }
+            );
+
+            for(size_t i = 0; i < vsize; ++i) indexes[i] = keys[i].second;
+
+            return indexes;
+        }
+
+
+        /**
+         * Combines each of the entries of the vector of NVectors with the
+         * entry of the given column that corresponds to its NVector, in
+         * place, i.e., vector[i][j] = function(vector[i][j], column[i]).
+         * 
+         * @param column The NVector with one entry per NVector of the vector
+         * of NVectors.
+         * 
+         * @param function The element-wise function, with signature
+         * function(T entry, T operand), that returns the new entry.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+        */
+        template <typename F>
+        void broadcastColumnsIP(
+            NVector::NVector<T>& column, F function, bool parallel
+        )
+        {
+            // Validate there is an entry per NVector.
+            ValidationGeneral::validateDimensions(vsize, column.size(), true);
+
+            // Copy the column, it could be stored in the vector of NVectors.
+            std::vector<T> operands(column.data(), column.data() + vsize);
+            const T* entries = operands.data();
+
+            broadcastRange(
+                [entries](size_t i){ return entries + i; }, false, function,
+                parallel
+            );
+        }
+
+
+        /**
+         * Combines each of the entries of the vector of NVectors with the
+         * given value, in place, i.e., vector[i][j] = function(vector[i][j],
+         * value).
+         * 
+         * @param value The value to be broadcast to every entry.
+         * 
+         * @param function The element-wise function, with signature
+         * function(T entry, T operand), that returns the new entry.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+        */
+        template <typename F>
+        void broadcastIP(T value, F function, bool parallel)
+        {
+            // Auxiliary variables.
+            const T* entry = &value;
+
+            broadcastRange(
+                [entry](size_t){ return entry; }, false, function, parallel
+            );
+        }
+
+
+        /**
+         * Combines each of the entries of the vector of NVectors with the
+         * corresponding entry of the given vector of NVectors, in place, i.e.,
+         * vector[i][j] = function(vector[i][j], other[i][j]).
+         * 
+         * @param vector The vector of NVectors with the operands; it must
+         * have the same size and dimension, and it can be the vector of
+         * NVectors itself.
+         * 
+         * @param function The element-wise function, with signature
+         * function(T entry, T operand), that returns the new entry.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+        */
+        template <typename F>
+        void broadcastIP(VNVectors<T>& vector, F function, bool parallel)
+        {
+            // Validate the dimensions and the sizes.
+            validateTransform(vector.dimension, vector);
+
+            // Auxiliary variables.
+            std::vector<const T*> rows(vsize);
+
+            // Gather the storage, such that the threads only use pointers.
+            for(size_t i = 0; i < vsize; ++i)
+                rows[i] = vector.container[i].data();
+
+            broadcastRange(
+                [&rows](size_t i){ return rows[i]; }, true, function, parallel
+            );
+        }
+
+
+        /**
+         * Combines each of the NVectors of the vector of NVectors with the
+         * given row, entry by entry, in place, i.e., vector[i][j] =
+         * function(vector[i][j], row[j]).
+         * 
+         * @param row The NVector to be broadcast to every NVector.
+         * 
+         * @param function The element-wise function, with signature
+         * function(T entry, T operand), that returns the new entry.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+        */
+        template <typename F>
+        void broadcastRowsIP(
+            NVector::NVector<T>& row, F function, bool parallel
+        )
+        {
+            // Validate the dimensions.
+            ValidationGeneral::validateDimensions(dimension, row.size(), true);
+
+            // Copy the row, it could be one of the NVectors.
+            std::vector<T> operands(row.data(), row.data() + dimension);
+            const T* entries = operands.data();
+
+            broadcastRange(
+                [entries](size_t){ return entries; }, true, function, parallel
+            );
+        }
+
+
+        /**
+         * Returns the cross products between the NVectors of the vector of
+         * NVectors and the NVectors of the given vector of NVectors, entry by
+         * entry.
+         * 
+         * @param vector The vector of NVectors whose entries will be used as
+         * the second argument of the cross products.
+         * 
+         * @return A vector of NVectors with the cross products.
+        */
+        VNVectors<T> crossProduct(VNVectors<T>& vector)
+        {
+            // Auxiliary variables.
+            VNVectors<T> output = VNVectors<T>(
+                dimension, vsize, NVector::uninitialized
+            );
+
+            crossProduct(vector, output);
+
+            return output;
+        }
+
+
+        /**
+         * Calculates the cross products between the NVectors of the vector of
+         * NVectors and the NVectors of the given vector of NVectors, entry by
+         * entry, and stores them in the given, preallocated, output.
+         * 
+         * @param vector The vector of NVectors whose entries will be used as
+         * the second argument of the cross products.
+         * 
+         * @param output The vector of NVectors where the results will be
+         * stored; it can be the vector of NVectors itself or the given one.
+        */
+        void crossProduct(VNVectors<T>& vector, VNVectors<T>& output)
+        {
+            // Validate the dimensions are 3 and the sizes are the same.
+            validateCrossProduct(output);
+            ValidationGeneral::validateDimensions(3, vector.dimension, true);
+            ValidationGeneral::validateDimensions(vsize, vector.size(), true);
+
+            crossProductKernel(vector, output);
+        }
+
+
+        /**
+         * Returns the cross products between the NVectors of the vector of
+         * NVectors and the given NVector.
+         * 
+         * @param vector The NVector that will be used as the second argument
+         * of the cross products.
+         * 
+         * @return A vector of NVectors with the cross products.
+        */
+        VNVectors<T> crossProduct(NVector::NVector<T>& vector)
+        {
+            // Auxiliary variables.
+            VNVectors<T> output = VNVectors<T>(
+                dimension, vsize, NVector::uninitialized
+            );
+
+            crossProduct(vector, output);
+
+            return output;
+        }
+
+
+        /**
+         * Calculates the cross products between the NVectors of the vector of
+         * NVectors and the given NVector, and stores them in the given,
+         * preallocated, output.
+         * 
+         * @param vector The NVector that will be used as the second argument
+         * of the cross products.
+         * 
+         * @param output The vector of NVectors where the results will be
+         * stored; it can be the vector of NVectors itself.
+        */
+        void crossProduct(NVector::NVector<T>& vector, VNVectors<T>& output)
+        {
+            // Validate the dimensions are 3 and the sizes are the same.
+            validateCrossProduct(output);
+            ValidationGeneral::validateDimensions(3, vector.size(), true);
+
+            crossProductKernel(vector, output);
+        }
+
+
+        /**
+         * Runs the given function on each of the NVectors, splitting the
+         * NVectors among several threads if requested.
+         * 
+         * @param function The function, with signature
+         * function(NVector::NVector<T>& vector); it must only modify the
+         * NVector it is given and keep its dimension.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+         * 
+         * @throw ExceptionsGeneral::Dimensions, if the function changes the
+         * dimension of an NVector.
+        */
+        template <typename F>
+        void forEach(F function, bool parallel)
+        {
+            // Auxiliary variables.
+            auto kernel = [&](size_t first, size_t last)
+            {
+                for(size_t i = first; i < last; ++i)
+                {
+                    function(container[i]);
+
+                    // Validate the NVector kept its dimension.
+                    ValidationGeneral::validateDimensions(
+                        dimension, container[i].size(), true
+                    );
+                }
+            };
+
+            if(parallel)
+                ParallelGeneral::parallelFor(0, vsize, parallelGrain, kernel);
+            else
+                kernel(0, vsize);
+        }
 
 
         /**
          * Projects the vector along the normalized given vector.
          * 
-         * @param vector The vector along which the projection will happen.
+         * @param vector The vector along which the projection will happen.
+         * 
+         * @return The projetion of the vector along the normalized given 
+         * vector.
+        */ 
+        VNVectors<T> projection(NVector::NVector<T> vector, bool normalize)
+        {
+            // Auxiliary variables.
+            VNVectors<T> nvector = *this;
+
+            projection(vector, normalize, nvector, false);
+            
+            return nvector;
+        }
+
+
+        /**
+         * Projects each of the NVectors along the given vector, i.e.,
+         * output[i] = <vector[i], u> u, with u the given vector, normalized if
+         * required, and stores the results in the given output. The given
+         * vector is copied once, such that it can be one of the outputs, and
+         * normalizing it only scales the coefficients.
+         * 
+         * @param vector The vector along which the projections will happen.
+         * 
+         * @param normalize True, if the given vector must be normalized;
+         * False, if it is already normalized.
+         * 
+         * @param output The vector of NVectors where the results will be
+         * stored; it can be the vector of NVectors itself.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+        */
+        void projection(
+            NVector::NVector<T>& vector, bool normalize, VNVectors<T>& output,
+            bool parallel
+        )
+        {
+            // Validate the dimensions and the sizes.
+            validateTransform(vector.size(), output);
+
+            // Auxiliary variables.
+            T scale = (T) 1;
+
+            // Normalizing the vector divides the coefficients by its norm,
+            // squared, since the vector appears twice.
+            if(normalize)
+            {
+                T vnorm = vector.norm();
+                ValidationGeneral::isNotDivingByZero(vnorm, true);
+                scale = (T) 1 / (vnorm * vnorm);
+            }
+
+            // Copy the direction, the output can overwrite the given vector.
+            std::vector<T> copy(vector.data(), vector.data() + dimension);
+            const T* direction = copy.data();
+
+            projectionRange(&direction, 1, &scale, output, parallel);
+        }
+
+
+        /**
+         * Projects each of the NVectors onto the subspace spanned by the given
+         * NVectors, i.e., output[i] = sum_k <vector[i], q_k> q_k, with q_k the
+         * orthonormalized basis, and stores the results in the given output.
+         * All the coefficients of an NVector are computed in the same pass.
+         * 
+         * @param basis The NVectors that span the subspace.
+         * 
+         * @param orthonormalize True, if the basis must be orthonormalized,
+         * which is done once on a copy; False, if it is already orthonormal.
+         * 
+         * @param output The vector of NVectors where the results will be
+         * stored; it can be the vector of NVectors itself.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+         * 
+         * @throw ExceptionsGeneral::DivisionByZero, if the basis must be
+         * orthonormalized and its NVectors are linearly dependent.
+        */
+        void projection(
+            VNVectors<T>& basis, bool orthonormalize, VNVectors<T>& output,
+            bool parallel
+        )
+        {
+            // Validate the dimensions and the sizes.
+            validateTransform(basis.dimension, output);
+
+            // Auxiliary variables.
+            bool copy = orthonormalize || &basis == &output;
+            VNVectors<T> orthonormal = VNVectors<T>(dimension);
+            VNVectors<T>& q = copy ? orthonormal : basis;
+            std::vector<T> scales(basis.vsize, (T) 1);
+            std::vector<const T*> directions(basis.vsize);
+
+            // Copy the basis if it will be overwritten or orthonormalized.
+            if(copy) orthonormal = basis;
+            if(orthonormalize) orthonormal.gramSchmidtIP(nullptr, false);
+
+            // Gather the basis once, such that the threads only use pointers.
+            for(size_t k = 0; k < q.vsize; ++k)
+                directions[k] = q.container[k].data();
+
+            projectionRange(
+                directions.data(), q.vsize, scales.data(), output, parallel
+            );
+        }
+
+
+        /**
+         * Projects each of the NVectors along the given vector, in place.
+         * 
+         * @param vector The vector along which the projections will happen.
+         * 
+         * @param normalize True, if the given vector must be normalized;
+         * False, if it is already normalized.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+        */
+        void projectionIP(
+            NVector::NVector<T>& vector, bool normalize, bool parallel
+        )
+        {
+            projection(vector, normalize, *this, parallel);
+        }
+
+
+        /**
+         * Projects each of the NVectors onto the subspace spanned by the given
+         * NVectors, in place.
+         * 
+         * @param basis The NVectors that span the subspace.
+         * 
+         * @param orthonormalize True, if the basis must be orthonormalized,
+         * which is done once on a copy; False, if it is already orthonormal.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+         * 
+         * @throw ExceptionsGeneral::DivisionByZero, if the basis must be
+         * orthonormalized and its NVectors are linearly dependent.
+        */
+        void projectionIP(
+            VNVectors<T>& basis, bool orthonormalize, bool parallel
+        )
+        {
+            projection(basis, orthonormalize, *this, parallel);
+        }
+
+
+        /**
+         * Applies the given matrix and translation to each of the NVectors of
+         * the vector of NVectors, i.e., output[i] = matrix * vector[i] +
+         * translation, and stores the results in the given output.
+         * 
+         * @param matrix The square matrix to be applied, given by rows; its
+         * size must match the dimension of the NVectors.
+         * 
+         * @param translation The translation to be added after the matrix has
+         * been applied.
+         * 
+         * @param output The vector of NVectors where the results will be
+         * stored; it can be the vector of NVectors itself.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+        */
+        template <size_t N>
+        void transform(
+            const std::array<std::array<T, N>, N>& matrix,
+            const std::array<T, N>& translation, VNVectors<T>& output,
+            bool parallel
+        )
+        {
+            // Validate the dimensions and the sizes.
+            validateTransform(N, output);
+
+            // Apply the transformation, without a perspective division.
+            transformRange<N>(
+                matrix, translation, nullptr, (T) 1, output, parallel
+            );
+        }
+
+
+        /**
+         * Applies the given matrix to each of the NVectors of the vector of
+         * NVectors, i.e., output[i] = matrix * vector[i], and stores the
+         * results in the given output.
+         * 
+         * @param matrix The square matrix to be applied, given by rows; its
+         * size must match the dimension of the NVectors.
+         * 
+         * @param output The vector of NVectors where the results will be
+         * stored; it can be the vector of NVectors itself.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+        */
+        template <size_t N>
+        void transform(
+            const std::array<std::array<T, N>, N>& matrix,
+            VNVectors<T>& output, bool parallel
+        )
+        {
+            // Auxiliary variables.
+            std::array<T, N> translation;
+            translation.fill((T) 0);
+
+            transform<N>(matrix, translation, output, parallel);
+        }
+
+
+        /**
+         * Applies the given homogeneous matrix to each of the NVectors of the
+         * vector of NVectors, where the NVectors are extended with a unit
+         * entry, and stores the results in the given output. If the last row
+         * of the matrix is not (0, ..., 0, 1), the results are divided by the
+         * resulting homogeneous coordinate.
+         * 
+         * @param matrix The square homogeneous matrix to be applied, given by
+         * rows; its size must be the dimension of the NVectors plus one.
+         * 
+         * @param output The vector of NVectors where the results will be
+         * stored; it can be the vector of NVectors itself.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+        */
+        template <size_t M>
+        void transformHomogeneous(
+            const std::array<std::array<T, M>, M>& matrix,
+            VNVectors<T>& output, bool parallel
+        )
+        {
+            // Validate the dimensions and the sizes.
+            static_assert(M > 1, "The homogeneous matrix must be 2x2 or more.");
+            constexpr size_t N = M - 1;
+            validateTransform(N, output);
+
+            // Auxiliary variables.
+            std::array<std::array<T, N>, N> linear;
+            std::array<T, N> translation, perspective;
+            bool affine = matrix[N][N] == (T) 1;
+
+            // Split the matrix into its linear, translation and perspective
+            // parts.
+            for(size_t i = 0; i < N; ++i)
+            {
+                for(size_t j = 0; j < N; ++j) linear[i][j] = matrix[i][j];
+                translation[i] = matrix[i][N];
+                perspective[i] = matrix[N][i];
+                affine = affine && perspective[i] == (T) 0;
+            }
+
+            // Apply the transformation.
+            transformRange<N>(
+                linear, translation, affine ? nullptr : perspective.data(),
+                matrix[N][N], output, parallel
+            );
+        }
+
+
+        /**
+         * Applies the given homogeneous matrix to each of the NVectors of the
+         * vector of NVectors, in place.
+         * 
+         * @param matrix The square homogeneous matrix to be applied, given by
+         * rows; its size must be the dimension of the NVectors plus one.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+        */
+        template <size_t M>
+        void transformHomogeneousIP(
+            const std::array<std::array<T, M>, M>& matrix, bool parallel
+        )
+        {
+            transformHomogeneous<M>(matrix, *this, parallel);
+        }
+
+
+        /**
+         * Applies the given matrix and translation to each of the NVectors of
+         * the vector of NVectors, in place.
+         * 
+         * @param matrix The square matrix to be applied, given by rows; its
+         * size must match the dimension of the NVectors.
+         * 
+         * @param translation The translation to be added after the matrix has
+         * been applied.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+        */
+        template <size_t N>
+        void transformIP(
+            const std::array<std::array<T, N>, N>& matrix,
+            const std::array<T, N>& translation, bool parallel
+        )
+        {
+            transform<N>(matrix, translation, *this, parallel);
+        }
+
+
+        /**
+         * Applies the given matrix to each of the NVectors of the vector of
+         * NVectors, in place.
+         * 
+         * @param matrix The square matrix to be applied, given by rows; its
+         * size must match the dimension of the NVectors.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+        */
+        template <size_t N>
+        void transformIP(
+            const std::array<std::array<T, N>, N>& matrix, bool parallel
+        )
+        {
+            transform<N>(matrix, *this, parallel);
+        }
+
+
+        /**
+         * Transforms each of the NVectors into a value and reduces the values
+         * into one, splitting the NVectors among several threads if
+         * requested. Each thread reduces its contiguous NVectors, and the
+         * partial results are reduced in the order of the NVectors, such that
+         * the result is the same for every run with the same threads.
+         * 
+         * @param initial The value the reduction starts with.
          * 
-         * @return The projetion of the vector along the normalized given 
-         * vector.
-        */ 
-        VNVectors<T> projection(NVector::NVector<T> vector, bool normalize)
+         * @param reduce The associative function, with signature
+         * reduce(U a, U b), that combines two values.
+         * 
+         * @param transform The function, with signature
+         * transform(NVector::NVector<T>& vector), that returns the value of
+         * an NVector; it must not modify other NVectors.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+         * 
+         * @return The reduction of the initial value and all the values.
+        */
+        template <typename U, typename R, typename F>
+        U transformReduce(U initial, R reduce, F transform, bool parallel)
         {
-            // Normalize the vector, if required.
-            if(normalize) vector.normalizeIP();
-            
-            VNVectors<T> nvector = *this;
+            // Auxiliary variables.
+            std::vector<std::pair<size_t, U>> partials;
+            std::mutex lock;
+
+            auto kernel = [&](size_t first, size_t last)
+            {
+                if(first >= last) return;
+
+                U partial = transform(container[first]);
+                for(size_t i = first + 1; i < last; ++i)
+                    partial = reduce(partial, transform(container[i]));
+
+                std::lock_guard<std::mutex> guard(lock);
+                partials.emplace_back(first, std::move(partial));
+            };
+
+            if(parallel)
+                ParallelGeneral::parallelFor(0, vsize, parallelGrain, kernel);
+            else
+                kernel(0, vsize);
+
+            // Reduce the partial results in the order of the NVectors.
+            std::sort(
+                partials.begin(), partials.end(),
+                [](const auto& a, const auto& b){ return a.first < b.first; }
+            );
 
-            // Set the components to the appropriate values.
-            for(size_t i = 0; i < nvector.size(); ++i) 
-                nvector[i] = nvector[i].projection(vector, false);
-            
-            return nvector;
+            for(auto& partial : partials)
+                initial = reduce(initial, partial.second);
+
+            return initial;
+        }
+
+
+        ////////////////////////////////////////////////////////////////////////
+        // Non-Throwing Functions
+        ////////////////////////////////////////////////////////////////////////
+
+
+        /**
+         * Returns a pointer to the NVector with the given index, reporting an
+         * index out of range as an error instead of throwing.
+         * 
+         * @param index The requested index to be accessed.
+         * 
+         * @return A pointer to the NVector or
+         * ExceptionsResults::Error::IndexOutOfRange.
+        */
+        ExceptionsResults::Result<NVector::NVector<T>*> tryAt(
+            size_t index
+        ) noexcept
+        {
+            // Validate the index is in range.
+            if(index >= vsize) return ExceptionsResults::Error::IndexOutOfRange;
+
+            return &container[index];
+        }
+
+
+        /**
+         * Calculates the cross products between the NVectors of the vector of
+         * NVectors and the NVectors of the given vector of NVectors, entry by
+         * entry, and stores them in the given, preallocated, output; reporting
+         * the errors instead of throwing.
+         * 
+         * @param vector The vector of NVectors whose entries will be used as
+         * the second argument of the cross products.
+         * 
+         * @param output The vector of NVectors where the results will be
+         * stored; it can be the vector of NVectors itself or the given one.
+         * 
+         * @return ExceptionsResults::Error::None, if the cross products were
+         * calculated; ExceptionsResults::Error::Dimensions, if the NVectors
+         * are not of size 3 or the sizes are not the same.
+        */
+        ExceptionsResults::Error tryCrossProduct(
+            VNVectors<T>& vector, VNVectors<T>& output
+        ) noexcept
+        {
+            // Validate the dimensions are 3 and the sizes are the same.
+            if(!isCrossProduct(output) || vector.dimension != 3)
+                return ExceptionsResults::Error::Dimensions;
+
+            if(vector.size() != vsize)
+                return ExceptionsResults::Error::Dimensions;
+
+            crossProductKernel(vector, output);
+
+            return ExceptionsResults::Error::None;
+        }
+
+
+        /**
+         * Calculates the cross products between the NVectors of the vector of
+         * NVectors and the given NVector, and stores them in the given,
+         * preallocated, output; reporting the errors instead of throwing.
+         * 
+         * @param vector The NVector that will be used as the second argument
+         * of the cross products.
+         * 
+         * @param output The vector of NVectors where the results will be
+         * stored; it can be the vector of NVectors itself.
+         * 
+         * @return ExceptionsResults::Error::None, if the cross products were
+         * calculated; ExceptionsResults::Error::Dimensions, if the NVectors
+         * are not of size 3 or the sizes are not the same.
+        */
+        ExceptionsResults::Error tryCrossProduct(
+            NVector::NVector<T>& vector, VNVectors<T>& output
+        ) noexcept
+        {
+            // Validate the dimensions are 3 and the sizes are the same.
+            if(!isCrossProduct(output) || vector.size() != 3)
+                return ExceptionsResults::Error::Dimensions;
+
+            crossProductKernel(vector, output);
+
+            return ExceptionsResults::Error::None;
         }
 
 
         private:
+        //######################################################################
+        // Functions
+        //######################################################################
+
+
+        /**
+         * Calculates the cross products between the NVectors of the vector of
+         * NVectors and the NVectors of the given vector of NVectors, without
+         * validating the dimensions. The entries are gathered in blocks into
+         * a structure of arrays layout, such that the products can be
+         * vectorized.
+         * 
+         * @param vector The vector of NVectors whose entries will be used as
+         * the second argument of the cross products.
+         * 
+         * @param output The vector of NVectors where the results will be
+         * stored.
+        */
+        void crossProductKernel(
+            VNVectors<T>& vector, VNVectors<T>& output
+        ) noexcept
+        {
+            // Auxiliary variables.
+            T ax[kernelBlock], ay[kernelBlock], az[kernelBlock];
+            T bx[kernelBlock], by[kernelBlock], bz[kernelBlock];
+            T cx[kernelBlock], cy[kernelBlock], cz[kernelBlock];
+
+            for(size_t i = 0; i < vsize; i += kernelBlock)
+            {
+                // Number of entries in the current block.
+                size_t length = std::min(kernelBlock, vsize - i);
+
+                // Gather the block.
+                for(size_t j = 0; j < length; ++j)
+                {
+                    const T* a = container[i + j].data();
+                    const T* b = vector.container[i + j].data();
+                    ax[j] = a[0]; ay[j] = a[1]; az[j] = a[2];
+                    bx[j] = b[0]; by[j] = b[1]; bz[j] = b[2];
+                }
+
+                // Calculate the cross products.
+                for(size_t j = 0; j < length; ++j)
+                {
+                    cx[j] = ay[j] * bz[j] - az[j] * by[j];
+                    cy[j] = az[j] * bx[j] - ax[j] * bz[j];
+                    cz[j] = ax[j] * by[j] - ay[j] * bx[j];
+                }
+
+                // Scatter the block.
+                for(size_t j = 0; j < length; ++j)
+                {
+                    T* c = output.container[i + j].data();
+                    c[0] = cx[j]; c[1] = cy[j]; c[2] = cz[j];
+                }
+            }
+        }
+
+
+        /**
+         * Calculates the cross products between the NVectors of the vector of
+         * NVectors and the given NVector, without validating the dimensions.
+         * The entries are gathered in blocks into a structure of arrays
+         * layout, such that the products can be vectorized.
+         * 
+         * @param vector The NVector that will be used as the second argument
+         * of the cross products.
+         * 
+         * @param output The vector of NVectors where the results will be
+         * stored.
+        */
+        void crossProductKernel(
+            NVector::NVector<T>& vector, VNVectors<T>& output
+        ) noexcept
+        {
+            // Auxiliary variables.
+            const T bx = vector.data()[0];
+            const T by = vector.data()[1];
+            const T bz = vector.data()[2];
+            T ax[kernelBlock], ay[kernelBlock], az[kernelBlock];
+            T cx[kernelBlock], cy[kernelBlock], cz[kernelBlock];
+
+            for(size_t i = 0; i < vsize; i += kernelBlock)
+            {
+                // Number of entries in the current block.
+                size_t length = std::min(kernelBlock, vsize - i);
+
+                // Gather the block.
+                for(size_t j = 0; j < length; ++j)
+                {
+                    const T* a = container[i + j].data();
+                    ax[j] = a[0]; ay[j] = a[1]; az[j] = a[2];
+                }
+
+                // Calculate the cross products.
+                for(size_t j = 0; j < length; ++j)
+                {
+                    cx[j] = ay[j] * bz - az[j] * by;
+                    cy[j] = az[j] * bx - ax[j] * bz;
+                    cz[j] = ax[j] * by - ay[j] * bx;
+                }
+
+                // Scatter the block.
+                for(size_t j = 0; j < length; ++j)
+                {
+                    T* c = output.container[i + j].data();
+                    c[0] = cx[j]; c[1] = cy[j]; c[2] = cz[j];
+                }
+            }
+        }
+
+
+        /**
+         * Determines if the vector of NVectors and the given output are made
+         * of 3 dimensional NVectors and have the same size.
+         * 
+         * @param output The vector of NVectors where the results of the cross
+         * products will be stored.
+         * 
+         * @return True, if the cross products can be calculated; False,
+         * otherwise.
+        */
+        bool isCrossProduct(VNVectors<T>& output) noexcept
+        {
+            return dimension == 3 && output.dimension == 3 &&
+                output.vsize == vsize;
+        }
+
+
+        /**
+         * Combines the entries of the NVectors in the given range with the
+         * given operands, in place. The operands of each NVector are either a
+         * row, read with unit stride, or a single value, read with zero
+         * stride, such that the inner loop is a plain loop over contiguous
+         * storage in both cases.
+         * 
+         * @param operands The function, with signature operands(size_t i),
+         * that returns the pointer to the operands of the i-th NVector.
+         * 
+         * @param row True, if the operands are a row of entries; False, if
+         * they are a single value.
+         * 
+         * @param function The element-wise function.
+         * 
+         * @param first The index of the first NVector to be combined.
+         * 
+         * @param last The index after the last NVector to be combined.
+        */
+        template <typename O, typename F>
+        void broadcastKernel(
+            O& operands, bool row, F& function, size_t first, size_t last
+        )
+        {
+            for(size_t i = first; i < last; ++i)
+            {
+                // Auxiliary variables.
+                T* entries = container[i].data();
+                const T* b = operands(i);
+
+                if(row)
+                {
+                    for(size_t j = 0; j < dimension; ++j)
+                        entries[j] = function(entries[j], b[j]);
+                }
+                else
+                {
+                    T value = *b;
+                    for(size_t j = 0; j < dimension; ++j)
+                        entries[j] = function(entries[j], value);
+                }
+            }
+        }
+
+
+        /**
+         * Combines all the NVectors with the given operands, in place,
+         * splitting the NVectors among several threads if required.
+         * 
+         * @param operands The function, with signature operands(size_t i),
+         * that returns the pointer to the operands of the i-th NVector.
+         * 
+         * @param row True, if the operands are a row of entries; False, if
+         * they are a single value.
+         * 
+         * @param function The element-wise function.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+        */
+        template <typename O, typename F>
+        void broadcastRange(O operands, bool row, F function, bool parallel)
+        {
+            // Combine all the NVectors in the calling thread.
+            if(!parallel)
+            {
+                broadcastKernel(operands, row, function, 0, vsize);
+                return;
+            }
+
+            // Split the NVectors among the threads.
+            ParallelGeneral::parallelFor(0, vsize, parallelGrain,
+                [&](size_t first, size_t last)
+                {
+                    broadcastKernel(operands, row, function, first, last);
+                }
+            );
+        }
+
+
+        /**
+         * Makes sure the vector of NVectors can hold the required number of
+         * NVectors, growing its capacity geometrically, such that appending
+         * one NVector at a time takes amortized constant time.
+         * 
+         * @param required The number of NVectors to be held.
+        */
+        void grow(size_t required)
+        {
+            if(required > container.capacity())
+                container.reserve(
+                    std::max(required, 2 * container.capacity())
+                );
+        }
+
+
+        /**
+         * Projects the given orthonormal NVectors out of the given NVector,
+         * one after the other, as the modified Gram-Schmidt process requires.
+         * 
+         * @param rows The entries of each of the NVectors.
+         * 
+         * @param coefficients The entries of each of the rows of R, or null
+         * pointers if the coefficients are not stored.
+         * 
+         * @param first The index of the first orthonormal NVector.
+         * 
+         * @param last The index after the last orthonormal NVector.
+         * 
+         * @param index The index of the NVector to be updated.
+        */
+        void gramSchmidtKernel(
+            T** rows, T** coefficients, size_t first, size_t last, size_t index
+        ) noexcept
+        {
+            // Auxiliary variables.
+            T* entries = rows[index];
+
+            for(size_t i = first; i < last; ++i)
+            {
+                const T* q = rows[i];
+                T coefficient = (T) 0;
+
+                for(size_t k = 0; k < dimension; ++k)
+                    coefficient += q[k] * entries[k];
+
+                for(size_t k = 0; k < dimension; ++k)
+                    entries[k] -= coefficient * q[k];
+
+                if(coefficients[i] != nullptr)
+                    coefficients[i][index] = coefficient;
+            }
+        }
+
+
+        /**
+         * Validates that the vector of NVectors and the given output are made
+         * of 3 dimensional NVectors and have the same size.
+         * 
+         * @param output The vector of NVectors where the results of the cross
+         * products will be stored.
+        */
+        void validateCrossProduct(VNVectors<T>& output)
+        {
+            ValidationGeneral::validateDimensions(3, dimension, true);
+            ValidationGeneral::validateDimensions(3, output.dimension, true);
+            ValidationGeneral::validateDimensions(vsize, output.size(), true);
+        }
+
+
+        /**
+         * Applies the given affine transformation, and optional perspective
+         * division, to the NVectors in the range [first, last). The NVectors
+         * are gathered in blocks into a structure of arrays layout and the
+         * matrix is copied into local storage, such that it can be kept in
+         * registers while the block is being transformed.
+         * 
+         * @param matrix The square matrix to be applied, given by rows.
+         * 
+         * @param translation The translation to be added.
+         * 
+         * @param perspective The perspective row of the homogeneous matrix;
+         * nullptr, if there is no perspective division.
+         * 
+         * @param scale The last entry of the homogeneous matrix.
+         * 
+         * @param output The vector of NVectors where the results will be
+         * stored.
+         * 
+         * @param first The index of the first NVector to be transformed.
+         * 
+         * @param last The index after the last NVector to be transformed.
+        */
+        template <size_t N>
+        void transformBlocks(
+            const std::array<std::array<T, N>, N>& matrix,
+            const std::array<T, N>& translation, const T* perspective,
+            T scale, VNVectors<T>& output, size_t first, size_t last
+        )
+        {
+            // Auxiliary variables.
+            T m[N][N], t[N], p[N];
+            T in[N][kernelBlock], out[N][kernelBlock], w[kernelBlock];
+
+            // Copy the matrix into local storage.
+            for(size_t r = 0; r < N; ++r)
+            {
+                for(size_t c = 0; c < N; ++c) m[r][c] = matrix[r][c];
+                t[r] = translation[r];
+                p[r] = perspective ? perspective[r] : (T) 0;
+            }
+
+            for(size_t i = first; i < last; i += kernelBlock)
+            {
+                // Number of entries in the current block.
+                size_t length = std::min(kernelBlock, last - i);
+
+                // Gather the block.
+                for(size_t j = 0; j < length; ++j)
+                {
+                    const T* a = container[i + j].data();
+                    for(size_t c = 0; c < N; ++c) in[c][j] = a[c];
+                }
+
+                // Transform the block, row by row of the matrix.
+                for(size_t r = 0; r < N; ++r)
+                {
+                    for(size_t j = 0; j < length; ++j) out[r][j] = t[r];
+                    for(size_t c = 0; c < N; ++c)
+                        for(size_t j = 0; j < length; ++j)
+                            out[r][j] += m[r][c] * in[c][j];
+                }
+
+                // Perform the perspective division, if needed.
+                if(perspective)
+                {
+                    for(size_t j = 0; j < length; ++j) w[j] = scale;
+                    for(size_t c = 0; c < N; ++c)
+                        for(size_t j = 0; j < length; ++j)
+                            w[j] += p[c] * in[c][j];
+                    for(size_t r = 0; r < N; ++r)
+                        for(size_t j = 0; j < length; ++j)
+                            out[r][j] /= w[j];
+                }
+
+                // Scatter the block.
+                for(size_t j = 0; j < length; ++j)
+                {
+                    T* b = output.container[i + j].data();
+                    for(size_t r = 0; r < N; ++r) b[r] = out[r][j];
+                }
+            }
+        }
+
+
+        /**
+         * Applies the given affine transformation, and optional perspective
+         * division, to all the NVectors; splitting them among several threads
+         * if requested.
+         * 
+         * @param matrix The square matrix to be applied, given by rows.
+         * 
+         * @param translation The translation to be added.
+         * 
+         * @param perspective The perspective row of the homogeneous matrix;
+         * nullptr, if there is no perspective division.
+         * 
+         * @param scale The last entry of the homogeneous matrix.
+         * 
+         * @param output The vector of NVectors where the results will be
+         * stored.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+        */
+        template <size_t N>
+        void transformRange(
+            const std::array<std::array<T, N>, N>& matrix,
+            const std::array<T, N>& translation, const T* perspective,
+            T scale, VNVectors<T>& output, bool parallel
+        )
+        {
+            // Process all the NVectors in the calling thread.
+            if(!parallel)
+            {
+                transformBlocks<N>(
+                    matrix, translation, perspective, scale, output, 0, vsize
+                );
+                return;
+            }
+
+            // Split the NVectors among the threads.
+            ParallelGeneral::parallelFor(0, vsize, parallelGrain,
+                [&](size_t first, size_t last)
+                {
+                    transformBlocks<N>(
+                        matrix, translation, perspective, scale, output, first,
+                        last
+                    );
+                }
+            );
+        }
+
+
+        /**
+         * Reorders the NVectors with the given permutation, in place, without
+         * validating the permutation; each cycle of the permutation is
+         * followed once, moving the NVectors.
+         * 
+         * @param permutation The permutation index.
+        */
+        void permuteKernel(std::vector<size_t>& permutation)
+        {
+            // Auxiliary variables.
+            std::vector<bool> placed(vsize, false);
+
+            for(size_t i = 0; i < vsize; ++i)
+            {
+                // Skip the cycles that were already followed.
+                if(placed[i]) continue;
+
+                // Follow the cycle, where the first NVector goes last.
+                NVector::NVector<T> first = std::move(container[i]);
+                size_t j = i;
+
+                while(permutation[j] != i)
+                {
+                    container[j] = std::move(container[permutation[j]]);
+                    placed[j] = true;
+                    j = permutation[j];
+                }
+
+                container[j] = std::move(first);
+                placed[j] = true;
+            }
+        }
+
+
+        /**
+         * Projects the NVectors in the given range onto the span of the given
+         * directions, i.e., output[i] = sum_k scale_k <vector[i], d_k> d_k,
+         * without validating the dimensions. The coefficients of each NVector
+         * are computed before its output is written, such that the output can
+         * be the vector of NVectors itself.
+         * 
+         * @param directions The entries of each of the directions.
+         * 
+         * @param count The number of directions.
+         * 
+         * @param scales The factor of the coefficient of each direction.
+         * 
+         * @param output The vector of NVectors where the results will be
+         * stored.
+         * 
+         * @param first The index of the first NVector to be projected.
+         * 
+         * @param last The index after the last NVector to be projected.
+        */
+        void projectionKernel(
+            const T* const* directions, size_t count, const T* scales,
+            VNVectors<T>& output, size_t first, size_t last
+        )
+        {
+            // Auxiliary variables.
+            std::vector<T> coefficients(count);
+
+            for(size_t i = first; i < last; ++i)
+            {
+                const T* entries = container[i].data();
+                T* result = output.container[i].data();
+
+                // Compute all the coefficients of the NVector.
+                for(size_t k = 0; k < count; ++k)
+                {
+                    const T* d = directions[k];
+                    T accum = (T) 0;
+
+                    for(size_t j = 0; j < dimension; ++j)
+                        accum += entries[j] * d[j];
+
+                    coefficients[k] = accum * scales[k];
+                }
+
+                // Write the combination of the directions.
+                std::fill_n(result, dimension, (T) 0);
+                for(size_t k = 0; k < count; ++k)
+                {
+                    const T* d = directions[k];
+                    T coefficient = coefficients[k];
+
+                    for(size_t j = 0; j < dimension; ++j)
+                        result[j] += coefficient * d[j];
+                }
+            }
+        }
+
+
+        /**
+         * Projects all the NVectors onto the span of the given directions,
+         * splitting the NVectors among several threads if required.
+         * 
+         * @param directions The entries of each of the directions.
+         * 
+         * @param count The number of directions.
+         * 
+         * @param scales The factor of the coefficient of each direction.
+         * 
+         * @param output The vector of NVectors where the results will be
+         * stored.
+         * 
+         * @param parallel True, if the NVectors must be split among several
+         * threads; False, otherwise.
+        */
+        void projectionRange(
+            const T* const* directions, size_t count, const T* scales,
+            VNVectors<T>& output, bool parallel
+        )
+        {
+            // Project all the NVectors in the calling thread.
+            if(!parallel)
+            {
+                projectionKernel(directions, count, scales, output, 0, vsize);
+                return;
+            }
+
+            // Split the NVectors among the threads.
+            ParallelGeneral::parallelFor(0, vsize, parallelGrain,
+                [&](size_t first, size_t last)
+                {
+                    projectionKernel(
+                        directions, count, scales, output, first, last
+                    );
+                }
+            );
+        }
+
+
+        /**
+         * Validates that none of the entries of the vector of NVectors is
+         * zero, such that they can be used as divisors.
+         * 
+         * @throw ExceptionsGeneral::DivisionByZero, if any of the entries is
+         * zero.
+        */
+        void validateDivisors()
+        {
+            for(size_t i = 0; i < vsize; ++i)
+            {
+                const T* entries = container[i].data();
+
+                for(size_t j = 0; j < dimension; ++j)
+                    ValidationGeneral::isNotDivingByZero(entries[j], true);
+            }
+        }
+
+
+        /**
+         * Validates that the given indexes are a permutation of the indexes
+         * of the NVectors.
+         * 
+         * @param permutation The permutation index.
+         * 
+         * @throw ExceptionsNVector::Permutation, if an index appears more than
+         * once.
+        */
+        void validatePermutation(std::vector<size_t>& permutation)
+        {
+            // Auxiliary variables.
+            std::vector<bool> seen(vsize, false);
+
+            ValidationGeneral::validateDimensions(
+                vsize, permutation.size(), true
+            );
+
+            for(size_t index : permutation)
+            {
+                ValidationGeneral::validateInRange(index, 0, vsize - 1, true);
+
+                if(seen[index]) throw ExceptionsNVector::Permutation(index);
+                seen[index] = true;
+            }
+        }
+
+
+        /**
+         * Validates that the vector of NVectors and the given output have the
+         * dimension of the transformation and the same size.
+         * 
+         * @param dimensions The dimension of the transformation.
+         * 
+         * @param output The vector of NVectors where the results of the
+         * transformation will be stored.
+        */
+        void validateTransform(size_t dimensions, VNVectors<T>& output)
+        {
+            ValidationGeneral::validateDimensions(dimensions, dimension, true);
+            ValidationGeneral::validateDimensions(
+                dimensions, output.dimension, true
+            );
+            ValidationGeneral::validateDimensions(vsize, output.size(), true);
+        }
+
+
         //######################################################################
         // Variables
         //######################################################################
 
 
+        // Number of NVectors that the Gram-Schmidt process orthonormalizes
+        // before projecting them out of the following NVectors.
+        static constexpr size_t gramSchmidtPanel{32};
+
+
+        // Number of NVectors that the bulk kernels process per block.
+        static constexpr size_t kernelBlock{64};
+
+
+        // Minimum number of NVectors that each thread must process.
+        static constexpr size_t parallelGrain{4096};
+
+
         // Vector that contains the variables.
         std::vector<NVector::NVector<T>> container;
 
@@ -502,4 +3013,46 @@ namespace VNVectors
         // Size of the vector of NVectors.
         size_t vsize{0};
     };
-}
\ No newline at end of file
+}
+
+
+//##############################################################################
+// Specializations
+//##############################################################################
+
+
+/**
+ * Hash of the vectors of NVectors, such that they can be used as keys of the
+ * unordered containers.
+*/
+namespace std
+{
+template <typename T>
+struct hash<VNVectors::VNVectors<T>>
+{
+    /**
+     * Returns the hash of the given vector of NVectors.
+     * 
+     * @param vector The vector of NVectors to be hashed.
+     * 
+     * @return The hash of the NVectors.
+    */
+    size_t operator () (const VNVectors::VNVectors<T>& vector) const
+    {
+        return vector.hash();
+    }
+};
+}
+
+
+//##############################################################################
+// Explicit Instantiations
+//##############################################################################
+
+
+// Instantiated in the library, like the NVectors, only if requested.
+#ifdef NVECTORS_USE_LIBRARY
+extern template class VNVectors::VNVectors<float>;
+extern template class VNVectors::VNVectors<double>;
+extern template class VNVectors::VNVectors<long double>;
+#endif